@@ -0,0 +1,71 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+
+#include "ramses-logic/LogicEngine.h"
+#include "ramses-logic/TimerNode.h"
+#include "ramses-logic/Property.h"
+#include "impl/LogicEngineImpl.h"
+#include "internals/LogicNodeDependencies.h"
+
+namespace rlogic
+{
+    // Creates given number of nodes, each linked to previously created one (data flows from last created to first created node)
+    static std::vector<TimerNode*> CreateLinkedNodes(LogicEngine& logicEngine, size_t nodeCount)
+    {
+        logicEngine.reserve(nodeCount);
+        std::vector<TimerNode*> nodes(nodeCount);
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            nodes[i] = logicEngine.createTimerNode();
+            if (i >= 1)
+                logicEngine.link(*nodes[i]->getOutputs()->getChild("ticker_us"), *nodes[i - 1]->getInputs()->getChild("ticker_us"));
+        }
+
+        return nodes;
+    }
+
+    static void BM_DAG_SortNodes(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+        const auto nodeCount = static_cast<size_t>(state.range(0));
+        CreateLinkedNodes(logicEngine, nodeCount);
+
+        const internal::LogicNodeDependencies& dependencies = logicEngine.m_impl->getApiObjects().getLogicNodeDependencies();
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            benchmark::DoNotOptimize(dependencies.sortNodesIgnoring({}));
+        }
+    }
+
+    // Measures time to topologically sort whole graph of linked nodes (sorting order is opposite to order of creation)
+    // ARG: number of nodes
+    BENCHMARK(BM_DAG_SortNodes)->Arg(1000)->Arg(100000)->Unit(benchmark::TimeUnit::kMicrosecond);
+
+    static void BM_DAG_LinkUnlink(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+        const auto nodeCount = static_cast<size_t>(state.range(0));
+        const std::vector<TimerNode*> nodes = CreateLinkedNodes(logicEngine, nodeCount);
+
+        // remove and restore one of the links in the middle of the chain
+        const Property& source = *nodes[nodeCount / 2 + 1]->getOutputs()->getChild("ticker_us");
+        const Property& target = *nodes[nodeCount / 2]->getInputs()->getChild("ticker_us");
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.unlink(source, target);
+            logicEngine.link(source, target);
+        }
+    }
+
+    // Measures time to create and remove a link (i.e. edge between two nodes) in a large graph
+    // ARG: number of nodes
+    BENCHMARK(BM_DAG_LinkUnlink)->Arg(1000)->Arg(100000);
+}
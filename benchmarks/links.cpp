@@ -109,5 +109,51 @@ namespace rlogic
     // Same as BM_Links_CreateDestroyLink, but tests with many scripts (how fast is link (re)creation depending on scripts count)
     // ARG: script count
     BENCHMARK(BM_Links_CreateDestroyLink_ManyScripts)->Arg(8)->Arg(32)->Arg(128);
+
+    static void BM_Links_GetPropertyLinks(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const int64_t scriptCount = state.range(0);
+
+        const std::string scriptSrc = R"(
+            function interface(IN,OUT)
+                for i = 0,20,1 do
+                    IN["dest"..tostring(i)] = Type:Int32()
+                    OUT["src"..tostring(i)] = Type:Int32()
+                end
+            end
+            function run(IN,OUT)
+            end
+        )";
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+
+        std::vector<LuaScript*> scripts(scriptCount);
+        for (int64_t i = 0; i < scriptCount; ++i)
+        {
+            scripts[i] = logicEngine.createLuaScript(scriptSrc, config);
+
+            if (i >= 1)
+            {
+                for (int64_t link = 0; link < 20; ++link)
+                {
+                    auto target = scripts[i]->getInputs()->getChild(fmt::format("dest{}", link));
+                    auto src = scripts[i-1]->getOutputs()->getChild(fmt::format("src{}", link));
+                    logicEngine.link(*src, *target);
+                }
+            }
+        }
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            benchmark::DoNotOptimize(logicEngine.getPropertyLinks().size());
+        }
+    }
+
+    // Measures time to query all links of unchanged link graph, as done e.g. by tools visualizing the graph every frame
+    // ARG: script count
+    BENCHMARK(BM_Links_GetPropertyLinks)->Arg(8)->Arg(128);
 }
 
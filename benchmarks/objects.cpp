@@ -0,0 +1,100 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+
+#include "ramses-logic/LogicEngine.h"
+#include "ramses-logic/TimerNode.h"
+
+#include "fmt/format.h"
+
+namespace rlogic
+{
+    static void BM_CreateAndDestroyObjects(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const auto objectCount = static_cast<size_t>(state.range(0));
+        std::vector<TimerNode*> timers(objectCount);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (auto& timer : timers)
+                timer = logicEngine.createTimerNode();
+            // destroy in reverse order of creation, as typically done when tearing down content
+            for (auto it = timers.rbegin(); it != timers.rend(); ++it)
+                logicEngine.destroy(**it);
+        }
+    }
+
+    // Measures time to create given number of objects and destroy them one by one
+    // ARG: number of objects
+    BENCHMARK(BM_CreateAndDestroyObjects)->Arg(1000)->Arg(10000);
+
+    static void BM_CreateAndDestroyObjects_Bulk(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const auto objectCount = static_cast<size_t>(state.range(0));
+        std::vector<LogicObject*> timers(objectCount);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (auto& timer : timers)
+                timer = logicEngine.createTimerNode();
+            logicEngine.destroy(timers);
+        }
+    }
+
+    // Measures time to create given number of objects and destroy them all at once
+    // ARG: number of objects
+    BENCHMARK(BM_CreateAndDestroyObjects_Bulk)->Arg(1000)->Arg(10000);
+
+    static void BM_CreateObjects(benchmark::State& state)
+    {
+        const auto objectCount = static_cast<size_t>(state.range(0));
+        const bool reserve = (state.range(1) != 0);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            LogicEngine logicEngine;
+            if (reserve)
+                logicEngine.reserve(objectCount);
+            for (size_t i = 0; i < objectCount; ++i)
+                logicEngine.createTimerNode();
+        }
+    }
+
+    // Measures time to create given number of objects in empty logic engine, with or without reserving storage upfront
+    // ARG: number of objects
+    // ARG: 1 to reserve storage, 0 otherwise
+    BENCHMARK(BM_CreateObjects)->Args({ 10000, 0 })->Args({ 10000, 1 });
+
+    static void BM_FindByName(benchmark::State& state)
+    {
+        LogicEngine logicEngine;
+
+        const auto objectCount = static_cast<size_t>(state.range(0));
+        std::vector<std::string> names(objectCount);
+        for (size_t i = 0; i < objectCount; ++i)
+        {
+            names[i] = fmt::format("timer_node_{}", i);
+            logicEngine.createTimerNode(names[i]);
+        }
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (const auto& name : names)
+                benchmark::DoNotOptimize(logicEngine.findByName<TimerNode>(name));
+        }
+    }
+
+    // Measures time to look up each of given number of objects by name once
+    // ARG: number of objects
+    BENCHMARK(BM_FindByName)->Arg(100)->Arg(3000);
+}
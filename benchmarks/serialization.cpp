@@ -16,9 +16,14 @@
 #include "fmt/format.h"
 #include <fstream>
 
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace rlogic
 {
-    static std::vector<char> CreateLargeLogicEngineBuffer(std::string_view fileName, int64_t scriptCount)
+    static std::vector<char> CreateLargeLogicEngineBuffer(std::string_view fileName, int64_t scriptCount, EFileCompression compression = EFileCompression::None)
     {
         Logger::SetLogVerbosityLimit(ELogMessageType::Off);
 
@@ -56,6 +61,7 @@ namespace rlogic
 
         SaveFileConfig configNoValidation;
         configNoValidation.setValidationEnabled(false);
+        configNoValidation.setCompression(compression);
         logicEngine.saveToFile(fileName, configNoValidation);
 
         std::ifstream fileStream(std::string(fileName), std::ifstream::binary);
@@ -101,5 +107,196 @@ namespace rlogic
 
     // ARG: script count
     BENCHMARK(BM_LoadFromBuffer_WithoutVerifier)->Arg(8)->Arg(32)->Arg(128)->Unit(benchmark::kMicrosecond);
-}
 
+    static void BM_LoadFromBuffer_WithVerificationCache(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+
+        const std::vector<char> buffer = CreateLargeLogicEngineBuffer("largeFile.bin", scriptCount);
+
+        LogicEngine logicEngine;
+        logicEngine.enableVerificationCache(true);
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.loadFromBuffer(buffer.data(), buffer.size(), nullptr, true);
+        }
+    }
+
+    // ARG: script count
+    BENCHMARK(BM_LoadFromBuffer_WithVerificationCache)->Arg(8)->Arg(32)->Arg(128)->Unit(benchmark::kMicrosecond);
+
+    // drops cached pages of the file so that next load has to read it from storage (Linux only, no-op elsewhere)
+    static void EvictFileFromPageCache(const char* fileName)
+    {
+#if defined(__linux__)
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) system call
+        const int fd = ::open(fileName, O_RDONLY);
+        if (fd >= 0)
+        {
+            fdatasync(fd);
+            posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+            ::close(fd);
+        }
+#else
+        (void)fileName;
+#endif
+    }
+
+    // ARG0: script count, ARG1: 0 - warm (file in page cache), 1 - cold (file evicted from page cache before every load)
+    static void BM_LoadFromFile(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+        const bool cold = (state.range(1) != 0);
+
+        const std::vector<char> buffer = CreateLargeLogicEngineBuffer("largeFile.bin", scriptCount);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            if (cold)
+            {
+                state.PauseTiming();
+                EvictFileFromPageCache("largeFile.bin");
+                state.ResumeTiming();
+            }
+            LogicEngine logicEngine;
+            logicEngine.loadFromFile("largeFile.bin", nullptr, true);
+        }
+
+        state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(buffer.size()));
+    }
+
+    BENCHMARK(BM_LoadFromFile)->Args({ 128, 0 })->Args({ 128, 1 })->Args({ 1024, 0 })->Args({ 1024, 1 })->Unit(benchmark::kMicrosecond);
+
+    // reference for BM_LoadFromFile: reads whole file into buffer first and loads from it
+    static void BM_LoadFromFile_ReadToBuffer(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+        const bool cold = (state.range(1) != 0);
+
+        const std::vector<char> buffer = CreateLargeLogicEngineBuffer("largeFile.bin", scriptCount);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            if (cold)
+            {
+                state.PauseTiming();
+                EvictFileFromPageCache("largeFile.bin");
+                state.ResumeTiming();
+            }
+            std::ifstream fileStream("largeFile.bin", std::ifstream::binary);
+            fileStream.seekg(0, std::ios::end);
+            std::vector<char> byteBuffer(static_cast<size_t>(fileStream.tellg()));
+            fileStream.seekg(0, std::ios::beg);
+            fileStream.read(byteBuffer.data(), static_cast<std::streamsize>(byteBuffer.size()));
+
+            LogicEngine logicEngine;
+            logicEngine.loadFromBuffer(byteBuffer.data(), byteBuffer.size(), nullptr, true);
+        }
+
+        state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(buffer.size()));
+    }
+
+    BENCHMARK(BM_LoadFromFile_ReadToBuffer)->Args({ 128, 0 })->Args({ 128, 1 })->Args({ 1024, 0 })->Args({ 1024, 1 })->Unit(benchmark::kMicrosecond);
+
+    // same as BM_LoadFromFile but file is saved with LZ4 compression, ARG0: script count, ARG1: 0 - warm, 1 - cold
+    static void BM_LoadFromFile_Compressed(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+        const bool cold = (state.range(1) != 0);
+
+        const std::vector<char> buffer = CreateLargeLogicEngineBuffer("largeFile.bin", scriptCount, EFileCompression::LZ4);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            if (cold)
+            {
+                state.PauseTiming();
+                EvictFileFromPageCache("largeFile.bin");
+                state.ResumeTiming();
+            }
+            LogicEngine logicEngine;
+            logicEngine.loadFromFile("largeFile.bin", nullptr, true);
+        }
+
+        state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(buffer.size()));
+    }
+
+    BENCHMARK(BM_LoadFromFile_Compressed)->Args({ 128, 0 })->Args({ 128, 1 })->Args({ 1024, 0 })->Args({ 1024, 1 })->Unit(benchmark::kMicrosecond);
+
+    static void BM_SaveAndLoadBuffer(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+
+        const std::vector<char> initialBuffer = CreateLargeLogicEngineBuffer("largeFile.bin", scriptCount);
+        LogicEngine logicEngine;
+        logicEngine.loadFromBuffer(initialBuffer.data(), initialBuffer.size(), nullptr, false);
+
+        SaveFileConfig configNoValidation;
+        configNoValidation.setValidationEnabled(false);
+        std::vector<uint8_t> buffer;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.saveToBuffer(buffer, configNoValidation);
+            LogicEngine otherLogicEngine;
+            otherLogicEngine.loadFromBuffer(buffer.data(), buffer.size(), nullptr, false);
+        }
+    }
+
+    // ARG: script count
+    BENCHMARK(BM_SaveAndLoadBuffer)->Arg(8)->Arg(32)->Arg(128)->Unit(benchmark::kMicrosecond);
+
+    // reference for BM_LoadFromBuffer_*: restores runtime state of already loaded content
+    static void BM_RestoreState(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+
+        const std::vector<char> buffer = CreateLargeLogicEngineBuffer("largeFile.bin", scriptCount);
+        LogicEngine logicEngine;
+        logicEngine.loadFromBuffer(buffer.data(), buffer.size(), nullptr, false);
+        logicEngine.update();
+        const LogicEngineState engineState = logicEngine.captureState();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            logicEngine.restoreState(engineState);
+        }
+    }
+
+    BENCHMARK(BM_RestoreState)->Arg(8)->Arg(32)->Arg(128)->Unit(benchmark::kMicrosecond);
+
+    // ARG0: script count, ARG1: number of packages already loaded in logic engine
+    static void BM_LoadAndUnloadPackage(benchmark::State& state)
+    {
+        Logger::SetLogVerbosityLimit(ELogMessageType::Off);
+
+        const int64_t scriptCount = state.range(0);
+        const int64_t loadedPackagesCount = state.range(1);
+
+        const std::vector<char> buffer = CreateLargeLogicEngineBuffer("largeFile.bin", scriptCount);
+        LogicEngine logicEngine;
+        for (int64_t i = 0; i < loadedPackagesCount; ++i)
+            logicEngine.loadPackageFromBuffer(buffer.data(), buffer.size(), nullptr, false);
+        logicEngine.update();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            const auto packageId = logicEngine.loadPackageFromBuffer(buffer.data(), buffer.size(), nullptr, false);
+            logicEngine.update();
+            logicEngine.unloadPackage(*packageId);
+        }
+    }
+
+    BENCHMARK(BM_LoadAndUnloadPackage)->Args({ 32, 0 })->Args({ 32, 16 })->Args({ 128, 0 })->Args({ 128, 16 })->Unit(benchmark::kMicrosecond);
+}
@@ -0,0 +1,156 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+
+#include "ramses-logic/LogicEngine.h"
+#include "ramses-logic/RamsesNodeBinding.h"
+#include "ramses-logic/RamsesAppearanceBinding.h"
+#include "ramses-logic/SkinBinding.h"
+#include "ramses-logic/Property.h"
+#include "internals/Math.h"
+
+#include "ramses-client-api/RamsesClient.h"
+#include "ramses-client-api/Scene.h"
+#include "ramses-client-api/Node.h"
+#include "ramses-client-api/Effect.h"
+#include "ramses-client-api/EffectDescription.h"
+#include "ramses-client-api/Appearance.h"
+#include "ramses-client-api/UniformInput.h"
+#include "ramses-framework-api/RamsesFramework.h"
+
+#include "fmt/format.h"
+#include <array>
+#include <cmath>
+
+namespace rlogic
+{
+    // typical crowd setup, many skins sharing the same skeleton
+    constexpr size_t SkinningJointCount = 100u;
+    constexpr size_t SkinningSkinCount = 50u;
+
+    static std::vector<internal::math::Matrix44f> CreateSkinningTestMatrices(size_t count, float seed)
+    {
+        std::vector<internal::math::Matrix44f> mats;
+        mats.reserve(count);
+        for (size_t i = 0u; i < count; ++i)
+        {
+            std::array<float, 16> data{};
+            for (size_t k = 0u; k < data.size(); ++k)
+                data[k] = std::sin(seed + float(i * data.size() + k));
+            mats.emplace_back(data);
+        }
+        return mats;
+    }
+
+    // Arg(0): scalar reference kernel, Arg(1): kernel used at runtime (SIMD if available for target)
+    static void BM_Skinning_JointMatrices_Kernel(benchmark::State& state)
+    {
+        const bool useRuntimeKernel = (state.range(0) != 0);
+        const auto jointWorldMats = CreateSkinningTestMatrices(SkinningJointCount, 0.f);
+        const auto inverseBindMats = CreateSkinningTestMatrices(SkinningJointCount * SkinningSkinCount, 1.f);
+        std::vector<internal::math::Matrix44f> jointMats(SkinningJointCount * SkinningSkinCount);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (size_t skin = 0u; skin < SkinningSkinCount; ++skin)
+            {
+                for (size_t joint = 0u; joint < SkinningJointCount; ++joint)
+                {
+                    const size_t idx = skin * SkinningJointCount + joint;
+                    if (useRuntimeKernel)
+                        internal::math::Matrix44f::Multiply(jointWorldMats[joint], inverseBindMats[idx], jointMats[idx]);
+                    else
+                        internal::math::Matrix44f::MultiplyScalar(jointWorldMats[joint], inverseBindMats[idx], jointMats[idx]);
+                }
+            }
+            benchmark::DoNotOptimize(jointMats.data());
+            benchmark::ClobberMemory();
+        }
+
+        state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(SkinningJointCount * SkinningSkinCount));
+    }
+
+    BENCHMARK(BM_Skinning_JointMatrices_Kernel)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+    // full logic update of skins, one joint is animated every update
+    static void BM_Skinning_Update(benchmark::State& state)
+    {
+        std::array<const char*, 3> commandLineConfig = { "benchmark", "-l", "off" };
+        ramses::RamsesFrameworkConfig frameworkConfig(static_cast<uint32_t>(commandLineConfig.size()), commandLineConfig.data());
+        ramses::RamsesFramework ramsesFramework{ frameworkConfig };
+        ramses::RamsesClient& ramsesClient = *ramsesFramework.createClient("benchmark client");
+        ramses::Scene& scene = *ramsesClient.createScene(ramses::sceneId_t(1));
+
+        const std::string vertShader = fmt::format(R"(
+            #version 300 es
+            uniform highp mat4 jointMat[{}];
+            in vec3 a_position;
+            void main()
+            {{
+                gl_Position = jointMat[0] * vec4(a_position, 1.0);
+            }})", SkinningJointCount);
+        const std::string fragShader = R"(
+            #version 300 es
+            out lowp vec4 color;
+            void main()
+            {
+                color = vec4(1.0, 0.0, 0.0, 1.0);
+            })";
+        ramses::EffectDescription effectDesc;
+        effectDesc.setVertexShader(vertShader.c_str());
+        effectDesc.setFragmentShader(fragShader.c_str());
+        const ramses::Effect* effect = scene.createEffect(effectDesc);
+        if (!effect)
+        {
+            state.SkipWithError("Effect creation failed");
+            return;
+        }
+
+        LogicEngine logicEngine{ EFeatureLevel_Latest };
+
+        std::vector<const RamsesNodeBinding*> joints;
+        joints.reserve(SkinningJointCount);
+        ramses::Node* parent = nullptr;
+        for (size_t i = 0u; i < SkinningJointCount; ++i)
+        {
+            ramses::Node* node = scene.createNode();
+            node->setTranslation(0.f, 1.f, 0.f);
+            if (parent)
+                parent->addChild(*node);
+            parent = node;
+            joints.push_back(logicEngine.createRamsesNodeBinding(*node));
+        }
+
+        const std::vector<matrix44f> inverseBindMats(SkinningJointCount, matrix44f{ 1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f });
+        for (size_t i = 0u; i < SkinningSkinCount; ++i)
+        {
+            ramses::Appearance* appearance = scene.createAppearance(*effect);
+            ramses::UniformInput jointMatInput;
+            appearance->getEffect().findUniformInput("jointMat", jointMatInput);
+            auto* appearanceBinding = logicEngine.createRamsesAppearanceBinding(*appearance);
+            if (!logicEngine.createSkinBinding(joints, inverseBindMats, *appearanceBinding, jointMatInput))
+            {
+                state.SkipWithError("Skin binding creation failed");
+                return;
+            }
+        }
+
+        Property* rootRotation = const_cast<RamsesNodeBinding*>(joints.front())->getInputs()->getChild("rotation"); // NOLINT(cppcoreguidelines-pro-type-const-cast) benchmark only
+        float angle = 0.f;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            angle += 1.f;
+            rootRotation->set(vec3f{ 0.f, angle, 0.f });
+            if (!logicEngine.update())
+                state.SkipWithError("failure running update()");
+        }
+    }
+
+    BENCHMARK(BM_Skinning_Update)->Unit(benchmark::kMicrosecond);
+}
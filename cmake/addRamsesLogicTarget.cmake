@@ -12,6 +12,10 @@ function(add_ramses_logic_target TARGET_NAME LIB_TYPE)
     target_link_libraries(${TARGET_NAME} PRIVATE ramses-logic-obj)
     target_link_libraries(${TARGET_NAME} PUBLIC ${RAMSES_TARGET})
     target_include_directories(${TARGET_NAME} PUBLIC include)
+    if (ramses-logic_DISABLE_SIMD)
+        # tests and benchmarks use internal math headers, must be compiled with same math code as the library
+        target_compile_definitions(${TARGET_NAME} PUBLIC RLOGIC_MATH_DISABLE_SIMD=1)
+    endif()
     set_target_properties(${TARGET_NAME} PROPERTIES
             PUBLIC_HEADER "${public_headers}"
         )
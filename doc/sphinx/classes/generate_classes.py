@@ -44,6 +44,7 @@ content = [
         'SaveFileConfig',
         'TimerNode',
         'AnchorPoint',
+        'AnimationBlendNode',
     ],
     },
     {
@@ -0,0 +1,96 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/LogicNode.h"
+#include <memory>
+
+namespace rlogic::internal
+{
+    class AnimationBlendNodeImpl;
+}
+
+namespace rlogic
+{
+    /**
+    * Animation blend node combines channel outputs of multiple #rlogic::AnimationNode instances (sources)
+    * into a single set of outputs using a weighted average. It is a logic node with following properties:
+    * - Fixed inputs:
+    *     - weights (array of float) - one weight per source animation, in the order in which the sources were provided
+    *                                  at creation time (#rlogic::LogicEngine::createAnimationBlendNode)
+    *                                - negative weights are treated as 0
+    *                                - weights do not need to sum up to 1, the result is normalized by the sum of weights
+    *                                  of all sources contributing to a channel
+    *                                - initially the first weight is 1 and all others are 0
+    *
+    * - Channel outputs: The blend node has an output property for each channel of the first source animation,
+    *                    with the same name and type as the corresponding output of that animation node.
+    *                    Other source animations contribute to a channel output only if they have a channel output
+    *                    of matching name and type, otherwise they are ignored for that channel.
+    *                    If all weights contributing to a channel are 0, the value of the first source is used.
+    *
+    * Channels which are interpolated as quaternions in the first source animation (#rlogic::EInterpolationType::Linear_Quaternions
+    * or #rlogic::EInterpolationType::Cubic_Quaternions) are blended in a rotation aware way - each contributing quaternion
+    * is flipped to the same hemisphere as the accumulated result before being added and the final result is normalized.
+    * Integer channel outputs are rounded to the nearest integer after blending.
+    *
+    * The blend node is always executed after its source animations, it is not needed (nor possible) to link
+    * the sources to the blend node. Whenever any of the source animations is executed or weights change,
+    * the blend node is executed as well.
+    * Source animation nodes cannot be destroyed while being used in a blend node.
+    */
+    class AnimationBlendNode : public LogicNode
+    {
+    public:
+        /**
+        * Constructor of AnimationBlendNode. User is not supposed to call this - AnimationBlendNodes are created by other factory classes
+        *
+        * @param impl implementation details of the AnimationBlendNode
+        */
+        explicit AnimationBlendNode(std::unique_ptr<internal::AnimationBlendNodeImpl> impl) noexcept;
+
+        /**
+        * Destructor of AnimationBlendNode.
+        */
+        ~AnimationBlendNode() noexcept override;
+
+        /**
+        * Copy Constructor of AnimationBlendNode is deleted because AnimationBlendNodes are not supposed to be copied
+        *
+        * @param other AnimationBlendNodes to copy from
+        */
+        AnimationBlendNode(const AnimationBlendNode& other) = delete;
+
+        /**
+        * Move Constructor of AnimationBlendNode is deleted because AnimationBlendNodes are not supposed to be moved
+        *
+        * @param other AnimationBlendNodes to move from
+        */
+        AnimationBlendNode(AnimationBlendNode&& other) = delete;
+
+        /**
+        * Assignment operator of AnimationBlendNode is deleted because AnimationBlendNodes are not supposed to be copied
+        *
+        * @param other AnimationBlendNodes to assign from
+        */
+        AnimationBlendNode& operator=(const AnimationBlendNode& other) = delete;
+
+        /**
+        * Move assignment operator of AnimationBlendNode is deleted because AnimationBlendNodes are not supposed to be moved
+        *
+        * @param other AnimationBlendNodes to assign from
+        */
+        AnimationBlendNode& operator=(AnimationBlendNode&& other) = delete;
+
+        /**
+        * Implementation of AnimationBlendNode
+        */
+        internal::AnimationBlendNodeImpl& m_animationBlendNodeImpl;
+    };
+}
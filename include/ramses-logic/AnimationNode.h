@@ -43,6 +43,21 @@ namespace rlogic
     *                    Channel value output is a result of keyframes interpolation based on the 'progress' input above,
     *                    it can be linked to another logic node input to use the animation result.
     *
+    * - Playback control inputs (only if created with #rlogic::AnimationNodeConfig::setPlaybackControlEnabled enabled):
+    *     - ticker_us (int64)  - time source in microseconds, typically linked to #rlogic::TimerNode output,
+    *                            the animation advances by the difference of ticker values between updates
+    *     - play (bool)        - animation advances only while set to true, first update after setting it
+    *                            only takes the current ticker as reference (i.e. resuming does not jump)
+    *     - speed (float)      - playback speed multiplier (default 1), negative values play backwards
+    *     - loopMode (int32)   - one of #rlogic::EAnimationLoopMode values (default #rlogic::EAnimationLoopMode::Once),
+    *                            any other value results in runtime error during update
+    *     - startTime (float)  - start of the clip range to play in animation time (default 0)
+    *     - endTime (float)    - end of the clip range to play in animation time (default is duration of the animation)
+    *                          - clip range is clamped to [0, duration]
+    *   When playback control is enabled, setting the 'progress' input to a different value seeks the playback to that position,
+    *   otherwise 'progress' is not used. Note that current playback position is not saved when saving to a file,
+    *   playback starts from the position given by the 'progress' input after loading.
+    *
     * - Channel data inputs (only if created with #rlogic::AnimationNodeConfig::setExposingOfChannelDataAsProperties enabled):
     *     - channelsData (struct) - contains all channels and their data in a hierarchy. For each channel:
     *         - [channelName] (struct)
@@ -76,6 +76,27 @@ namespace rlogic
         */
         [[nodiscard]] RLOGIC_API bool getExposingOfChannelDataAsProperties() const;
 
+        /**
+        * If enabled, the created #rlogic::AnimationNode will have additional inputs which drive the animation natively
+        * based on time, without the need to compute the 'progress' input in a script.
+        * Refer to #rlogic::AnimationNode for the list of playback inputs and their semantics.
+        *
+        * Playback control requires #rlogic::EFeatureLevel_06 or higher, creating an animation node from a config
+        * with playback control enabled in a #rlogic::LogicEngine with lower feature level will fail.
+        *
+        * By default this feature is disabled.
+        *
+        * @param enabled flag to enable or disable playback control inputs.
+        */
+        RLOGIC_API void setPlaybackControlEnabled(bool enabled);
+
+        /**
+        * Returns the currently set state of playback control.
+        *
+        * @return the currently set state of playback control.
+        */
+        [[nodiscard]] RLOGIC_API bool getPlaybackControlEnabled() const;
+
         /**
         * Destructor of #AnimationNodeConfig
         */
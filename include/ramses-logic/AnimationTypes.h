@@ -11,6 +11,7 @@
 #include "ramses-logic/APIExport.h"
 #include <vector>
 #include <string>
+#include <cstdint>
 
 namespace rlogic
 {
@@ -28,6 +29,18 @@ namespace rlogic
         Cubic_Quaternions,  ///< Cubic interpolation for vec4f values which are normalized for use as Quaternions after interpolation
     };
 
+    /**
+    * Loop modes used by #rlogic::AnimationNode playback control
+    * (see #rlogic::AnimationNodeConfig::setPlaybackControlEnabled).
+    * Set as integer value to the 'loopMode' input of the animation node.
+    */
+    enum class EAnimationLoopMode : int32_t
+    {
+        Once = 0,       ///< Plays the clip range once and stops at its end (or start when playing backwards)
+        Loop = 1,       ///< Restarts from the clip range start when reaching its end
+        PingPong = 2,   ///< Reverses playback direction whenever reaching either end of the clip range
+    };
+
     /**
     * Animation channel data bundle.
     * #timeStamps, #keyframes must always be provided,
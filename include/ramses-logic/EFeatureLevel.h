@@ -71,10 +71,15 @@ namespace rlogic
         /// - AnimationNode can animate DataArray containing arrays of floats as elements
         EFeatureLevel_05 = 5,
 
+        /// Released with version 1.5.0
+        /// Added features:
+        /// - #rlogic::AnimationBlendNode
+        EFeatureLevel_06 = 6,
+
         /// Equals to the latest feature level
-        EFeatureLevel_Latest = EFeatureLevel_05
+        EFeatureLevel_Latest = EFeatureLevel_06
     };
 
     /// List of all supported feature levels
-    constexpr std::array<EFeatureLevel, 5u> AllFeatureLevels{ EFeatureLevel_01, EFeatureLevel_02, EFeatureLevel_03, EFeatureLevel_04, EFeatureLevel_05 };
+    constexpr std::array<EFeatureLevel, 6u> AllFeatureLevels{ EFeatureLevel_01, EFeatureLevel_02, EFeatureLevel_03, EFeatureLevel_04, EFeatureLevel_05, EFeatureLevel_06 };
 }
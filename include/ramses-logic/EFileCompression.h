@@ -0,0 +1,26 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+namespace rlogic
+{
+    /**
+     * Compression applied to the whole content when saving #rlogic::LogicEngine to a file (see #rlogic::SaveFileConfig::setCompression).
+     * Compressed files are recognized and decompressed automatically when loading, no configuration is needed for loading.
+     */
+    enum class EFileCompression
+    {
+        /// Content is stored uncompressed, this is the fastest option if storage read speed is not a limiting factor.
+        None,
+        /// Content is compressed using LZ4 block format. Lua source code, bytecode and #rlogic::DataArray data typically compress well
+        /// and decompression is very fast, this mode reduces loading time when reading from slow storage (e.g. flash memory).
+        /// **Important!** Files saved with compression cannot be loaded by older releases of Ramses logic.
+        LZ4
+    };
+}
@@ -16,6 +16,7 @@
 #include "ramses-logic/ERotationType.h"
 #include "ramses-logic/ErrorData.h"
 #include "ramses-logic/LogicEngineReport.h"
+#include "ramses-logic/LogicEngineState.h"
 #include "ramses-logic/LuaConfig.h"
 #include "ramses-logic/SaveFileConfig.h"
 #include "ramses-logic/WarningData.h"
@@ -23,6 +24,8 @@
 #include "ramses-logic/DataTypes.h"
 
 #include <vector>
+#include <chrono>
+#include <optional>
 #include <string_view>
 
 namespace ramses
@@ -62,6 +65,7 @@ namespace rlogic
     class AnimationNodeConfig;
     class TimerNode;
     class AnchorPoint;
+    class AnimationBlendNode;
     enum class ELogMessageType;
 
     /**
@@ -467,6 +471,22 @@ namespace rlogic
         */
         RLOGIC_API AnchorPoint* createAnchorPoint(RamsesNodeBinding& nodeBinding, RamsesCameraBinding& cameraBinding, std::string_view name ="");
 
+        /**
+        * Creates a new #rlogic::AnimationBlendNode which blends channel outputs of given animation nodes using a weighted average.
+        * See #rlogic::AnimationBlendNode for more details on how the channels are matched and blended.
+        * #rlogic::AnimationBlendNode can only be created with #rlogic::EFeatureLevel_06 or higher enabled, see #LogicEngine(EFeatureLevel).
+        * There must be at least one source animation node provided, each source can be provided only once.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param sources animation nodes to blend, the first one determines the channel outputs of the blend node.
+        * @param name a name for the the new #rlogic::AnimationBlendNode.
+        * @return a pointer to the created object or nullptr if
+        * something went wrong during creation. In that case, use #getErrors() to obtain errors.
+        * The #rlogic::AnimationBlendNode can be destroyed by calling the #destroy method
+        */
+        RLOGIC_API AnimationBlendNode* createAnimationBlendNode(const std::vector<const AnimationNode*>& sources, std::string_view name = "");
+
         /**
          * Updates all #rlogic::LogicNode's which were created by this #LogicEngine instance.
          * The order in which #rlogic::LogicNode's are executed is determined by the links created
@@ -484,6 +504,56 @@ namespace rlogic
          */
         RLOGIC_API bool update();
 
+        /**
+         * Updates only given #rlogic::LogicNode's and all #rlogic::LogicNode's depending on them, directly
+         * or indirectly through links (or through other dependencies, e.g. #rlogic::AnchorPoint depends on its bindings).
+         * This can be used to evaluate logic of a single interactive element immediately (e.g. as response to touch input)
+         * without executing the whole logic. Weak links (see #linkWeak) are not followed.
+         * The nodes are executed in the same order and with same dirtiness handling as in #update, i.e. executing
+         * the subgraph has the same results for the executed nodes as a full #update would have, assuming nodes outside
+         * of the subgraph are not dirty. Nodes outside of the subgraph are not executed, if they are dirty they will
+         * be executed by the next #update.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param rootNodes nodes to update together with all nodes depending on them, all must belong to this #LogicEngine
+         * @return true if the update was successful, false otherwise
+         * In case of an error, use #getErrors() to obtain errors.
+         */
+        RLOGIC_API bool updateNodes(const std::vector<LogicNode*>& rootNodes);
+
+        /**
+         * Updates #rlogic::LogicNode's the same way as #update, but stops once given time budget is exhausted
+         * and continues from that point with next call of #updateWithBudget. This allows spreading a large
+         * recomputation (e.g. after change of language or theme) over multiple frames.
+         * At least one node is processed with every call, so the update always progresses. Use #isUpdateSettled
+         * to check whether all nodes were updated. If the update finishes but some of the nodes processed by one
+         * of the previous calls got dirty again in the meantime, the update continues from the first of these nodes
+         * with the next call. This happens at most twice per update, so that the update settles also if inputs are set
+         * before every call, remaining dirty nodes are then executed by the next update.
+         * Creating, destroying or linking nodes between calls is allowed, the update then starts over as well
+         * (nodes updated already are not dirty and thus not executed again).
+         * Calling #update finishes any unsettled update at once.
+         *
+         * Optionally Ramses bindings and all nodes depending on them (e.g. #rlogic::AnchorPoint) are executed only
+         * after all other nodes are updated, so that Ramses scene is not modified until the result is complete.
+         * These nodes are executed in the last call regardless of the budget.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param budget time after which no further node is executed in this call
+         * @param applyBindingsWhenSettled if true, Ramses bindings are updated only once all other nodes are updated
+         * @return true if the update was successful, false otherwise (the update then starts over with the next call)
+         * In case of an error, use #getErrors() to obtain errors.
+         */
+        RLOGIC_API bool updateWithBudget(std::chrono::microseconds budget, bool applyBindingsWhenSettled = false);
+
+        /**
+         * Checks if all nodes were updated, i.e. there is no unfinished update split into multiple calls of #updateWithBudget.
+         * @return true if there is no unfinished update, false otherwise
+         */
+        [[nodiscard]] RLOGIC_API bool isUpdateSettled() const;
+
         /**
         * Enables collecting of statistics during call to #update which can be obtained using #getLastUpdateReport.
         * Once enabled every subsequent call to #update will be instructed to collect various statistical data
@@ -621,6 +691,54 @@ namespace rlogic
          */
         RLOGIC_API bool unlink(const Property& sourceProperty, const Property& targetProperty);
 
+        /**
+         * Opens a transaction for editing the logic graph in bulk. Until the transaction is committed with #commitTransaction
+         * or rolled back with #rollbackTransaction, the following rules apply:
+         * - #link, #linkWeak and #unlink are executed immediately, i.e. each call validates its properties, updates
+         *   the link graph and marks the target node dirty as it does outside of a transaction. Only the check of the
+         *   link graph for loops and the update of the execution order of logic nodes are deferred until commit
+         * - #destroy does not destroy anything immediately, the objects are destroyed at once on commit
+         *   (it fails right away if an object is null, does not belong to this #LogicEngine or was already passed to #destroy
+         *   within the transaction, whether the objects can be destroyed with respect to other objects is checked on commit)
+         * - objects can be created as usual
+         * - #update, saving, loading, #unloadPackage and #restoreState are not allowed and fail
+         *
+         * Use transactions when changing many links or objects at once (e.g. when rewiring parts of the content),
+         * so that the graph is checked for loops and sorted only once instead of after every single change.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @return true if transaction was opened, false if there is already an open transaction.
+         */
+        RLOGIC_API bool beginTransaction();
+
+        /**
+         * Commits the transaction opened with #beginTransaction. The link graph is checked for loops once,
+         * all objects passed to #destroy within the transaction are destroyed and the execution order of logic nodes is updated.
+         * If any #link, #linkWeak or #unlink within the transaction failed, if the resulting link graph contains a loop
+         * or if any of the objects cannot be destroyed, the whole transaction is rolled back (see #rollbackTransaction)
+         * and the logic engine is left in the state it had before #beginTransaction.
+         * The transaction is closed in any case except when there was no open transaction.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @return true if transaction was committed, false otherwise. To get more detailed
+         * error information use #getErrors().
+         */
+        RLOGIC_API bool commitTransaction();
+
+        /**
+         * Reverts all changes made within the transaction opened with #beginTransaction and closes it:
+         * links are restored as they were, objects created within the transaction are destroyed and
+         * objects passed to #destroy within the transaction are kept. Note that property values set
+         * within the transaction are not reverted.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @return true if transaction was rolled back, false if there is no open transaction.
+         */
+        RLOGIC_API bool rollbackTransaction();
+
         /**
          * Checks if an input or output of a given LogicNode is linked to another LogicNode
          * @param logicNode the node to check for linkage.
@@ -628,13 +746,50 @@ namespace rlogic
          */
         [[nodiscard]] RLOGIC_API bool isLinked(const LogicNode& logicNode) const;
 
+        /**
+         * Suspends given group of #rlogic::LogicNode's, e.g. logic of a screen which is currently not visible.
+         * Suspended nodes are not executed by #update or #updateNodes, but remember if they got dirty in the meantime
+         * (e.g. #rlogic::TimerNode or an input was set). Values are not propagated over links into suspended nodes,
+         * the nodes take over current values of their linked inputs when resumed (see #resumeNodes). Nodes depending
+         * on suspended nodes are not suspended, they are executed as usual but receive no new values from the suspended nodes.
+         * Suspension is runtime state only, it is not saved with the logic content (see #saveToFile).
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param nodes nodes to suspend, all must belong to this #LogicEngine
+         * @return true if the nodes were suspended, false otherwise (then none of them is suspended).
+         * In case of an error, use #getErrors() to obtain errors.
+         */
+        RLOGIC_API bool suspendNodes(const std::vector<LogicNode*>& nodes);
+
+        /**
+         * Resumes given group of #rlogic::LogicNode's suspended with #suspendNodes. Resumed nodes take over current values
+         * of their linked inputs and will be executed by next #update if they got dirty while suspended.
+         * Nodes which are not suspended are ignored.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param nodes nodes to resume, all must belong to this #LogicEngine
+         * @return true if the nodes were resumed, false otherwise (then none of them is resumed).
+         * In case of an error, use #getErrors() to obtain errors.
+         */
+        RLOGIC_API bool resumeNodes(const std::vector<LogicNode*>& nodes);
+
+        /**
+         * Checks if given #rlogic::LogicNode is suspended, see #suspendNodes.
+         * @param logicNode the node to check.
+         * @return true if the node is suspended, false otherwise.
+         */
+        [[nodiscard]] RLOGIC_API bool isSuspended(const LogicNode& logicNode) const;
+
         /**
          * Collect and retrieve all existing links between properties of logic nodes.
          * There will be a #rlogic::PropertyLink in the returned container for every existing link created
          * (using #link or #linkWeak).
          *
          * Note that the returned container will not be modified (even if new links are created or unlinked in #LogicEngine)
-         * until #getPropertyLinks is called again.
+         * until #getPropertyLinks is called again. The links are collected again only if any link was created or removed
+         * since the previous call, otherwise the call is cheap and returns the same container.
          *
          * @return all existing links between properties of logic nodes.
          */
@@ -663,6 +818,17 @@ namespace rlogic
         */
         [[nodiscard]] RLOGIC_API const std::vector<WarningData>& validate() const;
 
+        /**
+        * Prepares internal containers and lookup structures of the #LogicEngine for the given total number of objects,
+        * so that creating them does not repeatedly reallocate and rehash. This is only a hint for performance reasons,
+        * it is not a limit - more objects can be created and nothing happens if the number is lower than the number of existing objects.
+        * Useful when building large content procedurally. When loading content, the exact number of objects is known
+        * from the data and storage is prepared automatically.
+        *
+        * @param objectCount expected total number of objects (of all types) in this #LogicEngine
+        */
+        RLOGIC_API void reserve(size_t objectCount);
+
         /**
         * Destroys an instance of an object created with #LogicEngine.
         * All objects created using #LogicEngine derive from a base class #rlogic::LogicObject
@@ -683,6 +849,22 @@ namespace rlogic
         */
         RLOGIC_API bool destroy(LogicObject& object);
 
+        /**
+        * Destroys multiple objects created with #LogicEngine at once. Same rules apply as for #destroy(LogicObject&)
+        * with the exception that objects destroyed together can use each other, e.g. a #rlogic::LuaModule can be destroyed
+        * together with all #rlogic::LuaScript objects using it. Destroying many objects this way is considerably faster than
+        * destroying them one by one, because internal containers are compacted only once.
+        *
+        * Either all objects are destroyed or none of them (if any of them cannot be destroyed).
+        * Objects listed multiple times are destroyed only once.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param objects the object instances to destroy
+        * @return true if all objects destroyed, false otherwise. Call #getErrors() for error details upon failure.
+        */
+        RLOGIC_API bool destroy(const std::vector<LogicObject*>& objects);
+
         /**
          * Writes the whole #LogicEngine and all of its objects to a binary file with the given filename. The RAMSES scene
          * potentially referenced by #rlogic::RamsesBinding objects is not saved - that is left to the application.
@@ -711,6 +893,25 @@ namespace rlogic
          */
         RLOGIC_API bool saveToFile(std::string_view filename, const SaveFileConfig& config = {});
 
+        /**
+         * Serializes the whole #LogicEngine and all of its objects to a memory buffer, without accessing the file system.
+         * The content of the buffer is identical to the content of a file written by #saveToFile using the same \p config
+         * and can be loaded using #loadFromBuffer. All notes and failure conditions of #saveToFile apply.
+         *
+         * The previous content of \p buffer is replaced, its capacity is reused if it is large enough for the serialized data
+         * (unless compression is enabled, see #rlogic::SaveFileConfig::setCompression). Calling this method repeatedly
+         * with the same buffer thus does not allocate memory for the result once the buffer is large enough.
+         * The internal serialization buffer is pre-sized using the size of the data serialized by the previous save.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param buffer buffer which will be filled with the serialized data. It is left unmodified in case of an error.
+         * @param config optional configuration object with exporter and asset metadata info, see #rlogic::SaveFileConfig for details
+         * @return true if saving was successful, false otherwise. To get more detailed
+         * error information use #getErrors()
+         */
+        RLOGIC_API bool saveToBuffer(std::vector<uint8_t>& buffer, const SaveFileConfig& config = {});
+
         /**
          * Loads the whole LogicEngine data from the given file. See also #saveToFile().
          * After loading, the previous state of the #LogicEngine will be overwritten with the
@@ -726,6 +927,9 @@ namespace rlogic
          *
          * Attention! This method clears all previous errors! See also docs of #getErrors()
          *
+         * The file is memory mapped (if supported by the platform) and deserialized directly from the mapping,
+         * without reading its whole content into memory first. The file must not be modified while loading.
+         *
          * @param filename path to file from which to load content (relative or absolute)
          * @param ramsesScene pointer to the Ramses Scene which holds the objects referenced in the Ramses Logic file
          * @param enableMemoryVerification flag to enable memory verifier (a flatbuffers feature which checks bounds and ranges).
@@ -738,8 +942,10 @@ namespace rlogic
         /**
          * Loads the whole LogicEngine data from the given file descriptor. This method is equivalent to #loadFromFile().
          *
-         * The file descriptor must be opened for read access and must support seeking.
-         * It will be in closed state after this call.
+         * The file descriptor must be opened for read access. It stays open after this call and is owned by the caller.
+         * The data region is memory mapped (if supported by the platform and file) and deserialized directly from the mapping,
+         * the offset does not need to be aligned. If mapping is not possible, the data is read from the file descriptor,
+         * which then must support seeking.
          *
          * @param[in] fd Open and readable filedescriptor.
          * @param[in] offset Absolute starting position of LogicEngine data within fd.
@@ -769,6 +975,158 @@ namespace rlogic
         */
         RLOGIC_API bool loadFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* ramsesScene = nullptr, bool enableMemoryVerification = true);
 
+        /**
+        * Loads LogicEngine data from the given file in addition to the objects which already exist in this #LogicEngine
+        * (unlike #loadFromFile which replaces all existing objects). All objects loaded by one call form a package
+        * which can be unloaded at once using #unloadPackage. Loaded objects get new IDs which follow the IDs of already
+        * existing objects, so the IDs stored in the file are not preserved. #rlogic::LuaModule objects which are identical
+        * to already existing modules (same code, standard modules and module dependencies) are not loaded again, the existing
+        * modules are used by the loaded scripts instead. Links can exist only among objects of the same package, the order
+        * of execution of already existing objects is not changed by loading a package.
+        *
+        * If loading fails, all objects loaded so far are destroyed again and the existing objects are left untouched.
+        *
+        * @param filename path to file from which to load content
+        * @param ramsesScene pointer to the Ramses Scene which holds the objects referenced in the Ramses Logic file
+        * @param enableMemoryVerification flag to enable memory verifier (a flatbuffers feature which checks bounds and ranges).
+        *        Disable this only if the file comes from a trusted source and performance is paramount.
+        * @return ID of the loaded package if deserialization was successful, std::nullopt otherwise. To get more detailed
+        * error information use #getErrors()
+        */
+        RLOGIC_API std::optional<uint64_t> loadPackageFromFile(std::string_view filename, ramses::Scene* ramsesScene = nullptr, bool enableMemoryVerification = true);
+
+        /**
+        * Loads LogicEngine data from the given memory buffer in addition to the objects which already exist in this #LogicEngine.
+        * This method is equivalent to #loadPackageFromFile but reads the data from a buffer, see #loadFromBuffer.
+        *
+        * @param rawBuffer pointer to the raw data in memory
+        * @param bufferSize size of the data (bytes)
+        * @param ramsesScene pointer to the Ramses Scene which holds the objects referenced in the Ramses Logic file
+        * @param enableMemoryVerification flag to enable memory verifier (a flatbuffers feature which checks bounds and ranges).
+        *        Disable this only if the file comes from a trusted source and performance is paramount.
+        * @return ID of the loaded package if deserialization was successful, std::nullopt otherwise. To get more detailed
+        * error information use #getErrors()
+        */
+        RLOGIC_API std::optional<uint64_t> loadPackageFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* ramsesScene = nullptr, bool enableMemoryVerification = true);
+
+        /**
+        * Destroys all objects loaded with #loadPackageFromFile or #loadPackageFromBuffer which returned \p packageId.
+        * Objects of the package which were already destroyed using #destroy are skipped. #rlogic::LuaModule objects
+        * shared with another package are kept until all packages using them are unloaded.
+        * Fails if \p packageId does not refer to a loaded package or if an object of the package cannot be destroyed
+        * (e.g. because another object created after loading still uses it), in the latter case no object is destroyed
+        * and the package stays loaded.
+        *
+        * @param packageId ID of the package as returned when loading it
+        * @return true if the package was unloaded successfully, false otherwise. To get more detailed
+        * error information use #getErrors()
+        */
+        RLOGIC_API bool unloadPackage(uint64_t packageId);
+
+        /**
+        * Enables or disables lazy loading of #rlogic::LuaScript instances for all subsequent calls to
+        * #loadFromFile, #loadFromFileDescriptor and #loadFromBuffer. When enabled, the scripts' properties, modules and links
+        * are loaded as usual, but the Lua environment of every script is created and its bytecode (or source code) loaded
+        * only when the script is executed by #update for the first time. This reduces the loading time of assets
+        * which contain many scripts from which only few are executed right after loading.
+        * Note that errors which would otherwise be reported during loading (e.g. a failing \c init function)
+        * are reported by the first #update which executes the script.
+        * Lazy loading is disabled by default.
+        *
+        * @param enable true to defer loading of scripts until their first execution, false to load them right away.
+        */
+        RLOGIC_API void enableLazyLuaScriptLoading(bool enable);
+
+        /**
+        * Enables or disables parallel loading for all subsequent calls to #loadFromFile, #loadFromFileDescriptor
+        * and #loadFromBuffer. When enabled, objects which do not use Lua (node, appearance, camera and render pass bindings,
+        * #rlogic::DataArray and #rlogic::AnimationNode instances) are loaded on a worker thread concurrently
+        * with loading of Lua modules, scripts and interfaces on the calling thread. The loaded content is the same
+        * as with sequential loading, errors are reported in a fixed order: errors from Lua objects first, followed
+        * by errors from the other objects.
+        * Note that Ramses objects are resolved from the worker thread while loading, therefore the Ramses scene
+        * must not be modified concurrently with the load call. Also the log handler (see #rlogic::Logger::SetLogHandler)
+        * can be called from the worker thread.
+        * Parallel loading is disabled by default.
+        *
+        * @param enable true to load objects on two threads, false to load them sequentially on the calling thread.
+        */
+        RLOGIC_API void enableParallelLoading(bool enable);
+
+        /**
+        * Enables or disables caching of memory verification results for all subsequent calls to #loadFromFile,
+        * #loadFromFileDescriptor and #loadFromBuffer with enabled memory verification. When enabled, a keyed cryptographic
+        * hash of the data is calculated on load and compared with hashes of data which already passed verification.
+        * Identical data is then loaded without running the verification again, which speeds up repeated loading of the same
+        * assets. Any data which was not verified before (or differs by a single byte) is fully verified.
+        * Without \p key a random key is used which is never exposed, the cache is then only useful within this #LogicEngine instance.
+        * With \p key the verification results can be exported using #exportVerificationCache, stored by the application
+        * and imported using #importVerificationCache in a later process (e.g. next boot of the device), so that verification
+        * of unchanged assets is skipped from the first load on.
+        * Attention! Anyone knowing the key can create data which would be mistaken for verified data, the key must be kept
+        * secret (e.g. in secure storage of the device) and must not be stored together with the assets or the exported cache.
+        * Only results of the most recent loads are kept, the cache is cleared when disabled or enabled with a different key.
+        * Caching is disabled by default.
+        *
+        * @param enable true to skip verification of data which already passed verification, false to verify every load.
+        * @param key secret key used to hash the data, random key is used if not provided
+        */
+        RLOGIC_API void enableVerificationCache(bool enable, const std::optional<std::array<uint8_t, 16>>& key = std::nullopt);
+
+        /**
+        * Exports the results of the verification cache (see #enableVerificationCache) into \p data. The exported data
+        * contains only hashes of the verified data, it can be stored by the application and imported using
+        * #importVerificationCache into a #LogicEngine with verification cache enabled using the same key.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param data vector which will be overwritten with the exported cache data
+        * @return true if the cache was exported, false if the verification cache is not enabled
+        */
+        RLOGIC_API bool exportVerificationCache(std::vector<uint8_t>& data);
+
+        /**
+        * Imports verification results exported using #exportVerificationCache into the verification cache
+        * (see #enableVerificationCache). The imported results are added to the results already in the cache.
+        * The import fails if the cache was exported using a different key or on a platform with different byte order.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param data cache data exported using #exportVerificationCache
+        * @return true if the cache was imported, false if the verification cache is not enabled or the data is invalid
+        */
+        RLOGIC_API bool importVerificationCache(const std::vector<uint8_t>& data);
+
+        /**
+        * Captures the runtime state of all logic nodes - values of their properties, dirty flags, data stored
+        * in the \c GLOBAL table of #rlogic::LuaScript instances (booleans, numbers, strings and tables) and playback
+        * state of #rlogic::AnimationNode instances. The state can be applied back using #restoreState,
+        * which is much faster than saving and loading the logic content, because no objects are created
+        * and no Lua code is compiled or executed.
+        * Note that links, Lua functions and userdata stored in \c GLOBAL, as well as states of Ramses objects
+        * are not part of the captured state (bindings set the restored values to Ramses objects in next #update).
+        *
+        * Attention! The #rlogic::LogicEngineState is returned by value and owns all the captured data.
+        *
+        * @return captured runtime state
+        */
+        [[nodiscard]] RLOGIC_API LogicEngineState captureState() const;
+
+        /**
+        * Applies state previously captured by #captureState on this #LogicEngine instance. All property values, dirty flags,
+        * \c GLOBAL tables of scripts and playback state of animation nodes are set back to the captured values in place.
+        * Nodes whose property values changed by restoring are updated in next #update (even if they were not dirty
+        * when captured), so that Ramses objects reflect the restored values.
+        * The state can only be restored if no logic objects were created or destroyed since it was captured,
+        * otherwise this method fails without modifying anything.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param state state captured by #captureState on this #LogicEngine instance
+        * @return true if the state was restored, false otherwise. In case of an error, use #getErrors() to obtain errors.
+        */
+        RLOGIC_API bool restoreState(const LogicEngineState& state);
+
         /**
         * Calculates the serialized size of all objects contained in this LogicEngine instance.
         * Note that size of scripts and modules will be estimated as if using the default #rlogic::ELuaSavingMode::ByteCodeOnly in #rlogic::SaveFileConfig::setLuaSavingMode.
@@ -934,7 +1292,8 @@ namespace rlogic
             std::is_same_v<T, DataArray> ||
             std::is_same_v<T, AnimationNode> ||
             std::is_same_v<T, TimerNode> ||
-            std::is_same_v<T, AnchorPoint>,
+            std::is_same_v<T, AnchorPoint> ||
+            std::is_same_v<T, AnimationBlendNode>,
             "Attempting to retrieve invalid type of object.");
     }
 
@@ -0,0 +1,73 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/APIExport.h"
+#include <memory>
+
+namespace rlogic::internal
+{
+    class LogicEngineStateImpl;
+}
+
+namespace rlogic
+{
+    /**
+    * Snapshot of the runtime state of all logic nodes in a #rlogic::LogicEngine, obtained using
+    * #rlogic::LogicEngine::captureState and applied back using #rlogic::LogicEngine::restoreState.
+    * The snapshot contains only data which can change during runtime - values of all properties, dirty flags
+    * of logic nodes, data stored in the \c GLOBAL table of Lua scripts and playback state of animation nodes.
+    * It does not contain the logic objects themselves, their Lua code or links.
+    * The snapshot does not reference the logic engine, it can be kept as long as needed.
+    */
+    class LogicEngineState
+    {
+    public:
+        /**
+        * Constructor of LogicEngineState. Do not construct, use #rlogic::LogicEngine::captureState to obtain.
+        *
+        * @param impl implementation details of the LogicEngineState
+        */
+        RLOGIC_API explicit LogicEngineState(std::unique_ptr<internal::LogicEngineStateImpl> impl) noexcept;
+
+        /**
+        * Class destructor
+        */
+        RLOGIC_API ~LogicEngineState();
+
+        /**
+        * Copying disabled, move instead.
+        */
+        LogicEngineState(const LogicEngineState&) = delete;
+
+        /**
+        * Move constructor
+        *
+        * @param other source
+        */
+        RLOGIC_API LogicEngineState(LogicEngineState&& other) noexcept;
+
+        /**
+        * Copying disabled, move instead.
+        */
+        LogicEngineState& operator=(const LogicEngineState&) = delete;
+
+        /**
+        * Move assignment
+        *
+        * @param other source
+        */
+        RLOGIC_API LogicEngineState& operator=(LogicEngineState&& other) noexcept;
+
+        /**
+        * Implementation detail of LogicEngineState
+        */
+        std::unique_ptr<internal::LogicEngineStateImpl> m_impl; //NOLINT(modernize-use-default-member-init) fixing this would break pimpl pattern
+    };
+}
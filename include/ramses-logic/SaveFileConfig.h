@@ -10,6 +10,7 @@
 
 #include "ramses-logic/APIExport.h"
 #include "ramses-logic/ELuaSavingMode.h"
+#include "ramses-logic/EFileCompression.h"
 
 #include <string>
 #include <memory>
@@ -76,6 +77,17 @@ namespace rlogic
         */
         RLOGIC_API void setLuaSavingMode(ELuaSavingMode mode);
 
+        /**
+        * Sets compression of the saved file. The file identifier (bytes 4-7) is the same as for uncompressed files,
+        * so that compressed files are still recognized as Ramses logic files. The compressed content is decompressed
+        * transparently by #rlogic::LogicEngine::loadFromFile, #rlogic::LogicEngine::loadFromFileDescriptor and
+        * #rlogic::LogicEngine::loadFromBuffer.
+        * See #rlogic::EFileCompression for the available options and their implications.
+        *
+        * @param compression compression to use, default is #rlogic::EFileCompression::None
+        */
+        RLOGIC_API void setCompression(EFileCompression compression);
+
         /**
          * Destructor of #SaveFileConfig
          */
@@ -0,0 +1,144 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_ANIMATIONBLENDNODE_RLOGIC_SERIALIZATION_H_
+#define FLATBUFFERS_GENERATED_ANIMATIONBLENDNODE_RLOGIC_SERIALIZATION_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+#include "LogicObjectGen.h"
+#include "PropertyGen.h"
+
+namespace rlogic_serialization {
+
+struct AnimationBlendNode;
+struct AnimationBlendNodeBuilder;
+
+inline const flatbuffers::TypeTable *AnimationBlendNodeTypeTable();
+
+struct AnimationBlendNode FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef AnimationBlendNodeBuilder Builder;
+  struct Traits;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return AnimationBlendNodeTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_BASE = 4,
+    VT_SOURCEANIMATIONIDS = 6,
+    VT_ROOTINPUT = 8,
+    VT_ROOTOUTPUT = 10
+  };
+  const rlogic_serialization::LogicObject *base() const {
+    return GetPointer<const rlogic_serialization::LogicObject *>(VT_BASE);
+  }
+  const flatbuffers::Vector<uint64_t> *sourceAnimationIds() const {
+    return GetPointer<const flatbuffers::Vector<uint64_t> *>(VT_SOURCEANIMATIONIDS);
+  }
+  const rlogic_serialization::Property *rootInput() const {
+    return GetPointer<const rlogic_serialization::Property *>(VT_ROOTINPUT);
+  }
+  const rlogic_serialization::Property *rootOutput() const {
+    return GetPointer<const rlogic_serialization::Property *>(VT_ROOTOUTPUT);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_BASE) &&
+           verifier.VerifyTable(base()) &&
+           VerifyOffset(verifier, VT_SOURCEANIMATIONIDS) &&
+           verifier.VerifyVector(sourceAnimationIds()) &&
+           VerifyOffset(verifier, VT_ROOTINPUT) &&
+           verifier.VerifyTable(rootInput()) &&
+           VerifyOffset(verifier, VT_ROOTOUTPUT) &&
+           verifier.VerifyTable(rootOutput()) &&
+           verifier.EndTable();
+  }
+};
+
+struct AnimationBlendNodeBuilder {
+  typedef AnimationBlendNode Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_base(flatbuffers::Offset<rlogic_serialization::LogicObject> base) {
+    fbb_.AddOffset(AnimationBlendNode::VT_BASE, base);
+  }
+  void add_sourceAnimationIds(flatbuffers::Offset<flatbuffers::Vector<uint64_t>> sourceAnimationIds) {
+    fbb_.AddOffset(AnimationBlendNode::VT_SOURCEANIMATIONIDS, sourceAnimationIds);
+  }
+  void add_rootInput(flatbuffers::Offset<rlogic_serialization::Property> rootInput) {
+    fbb_.AddOffset(AnimationBlendNode::VT_ROOTINPUT, rootInput);
+  }
+  void add_rootOutput(flatbuffers::Offset<rlogic_serialization::Property> rootOutput) {
+    fbb_.AddOffset(AnimationBlendNode::VT_ROOTOUTPUT, rootOutput);
+  }
+  explicit AnimationBlendNodeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  AnimationBlendNodeBuilder &operator=(const AnimationBlendNodeBuilder &);
+  flatbuffers::Offset<AnimationBlendNode> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<AnimationBlendNode>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<AnimationBlendNode> CreateAnimationBlendNode(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<rlogic_serialization::LogicObject> base = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint64_t>> sourceAnimationIds = 0,
+    flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0,
+    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0) {
+  AnimationBlendNodeBuilder builder_(_fbb);
+  builder_.add_rootOutput(rootOutput);
+  builder_.add_rootInput(rootInput);
+  builder_.add_sourceAnimationIds(sourceAnimationIds);
+  builder_.add_base(base);
+  return builder_.Finish();
+}
+
+struct AnimationBlendNode::Traits {
+  using type = AnimationBlendNode;
+  static auto constexpr Create = CreateAnimationBlendNode;
+};
+
+inline flatbuffers::Offset<AnimationBlendNode> CreateAnimationBlendNodeDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<rlogic_serialization::LogicObject> base = 0,
+    const std::vector<uint64_t> *sourceAnimationIds = nullptr,
+    flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0,
+    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0) {
+  auto sourceAnimationIds__ = sourceAnimationIds ? _fbb.CreateVector<uint64_t>(*sourceAnimationIds) : 0;
+  return rlogic_serialization::CreateAnimationBlendNode(
+      _fbb,
+      base,
+      sourceAnimationIds__,
+      rootInput,
+      rootOutput);
+}
+
+inline const flatbuffers::TypeTable *AnimationBlendNodeTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_SEQUENCE, 0, 0 },
+    { flatbuffers::ET_ULONG, 1, -1 },
+    { flatbuffers::ET_SEQUENCE, 0, 1 },
+    { flatbuffers::ET_SEQUENCE, 0, 1 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    rlogic_serialization::LogicObjectTypeTable,
+    rlogic_serialization::PropertyTypeTable
+  };
+  static const char * const names[] = {
+    "base",
+    "sourceAnimationIds",
+    "rootInput",
+    "rootOutput"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 4, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+}  // namespace rlogic_serialization
+
+#endif  // FLATBUFFERS_GENERATED_ANIMATIONBLENDNODE_RLOGIC_SERIALIZATION_H_
@@ -197,7 +197,8 @@ struct AnimationNode FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_CHANNELS = 6,
     VT_CHANNELSASPROPERTIES = 8,
     VT_ROOTINPUT = 10,
-    VT_ROOTOUTPUT = 12
+    VT_ROOTOUTPUT = 12,
+    VT_PLAYBACKCONTROL = 14
   };
   const rlogic_serialization::LogicObject *base() const {
     return GetPointer<const rlogic_serialization::LogicObject *>(VT_BASE);
@@ -214,6 +215,9 @@ struct AnimationNode FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const rlogic_serialization::Property *rootOutput() const {
     return GetPointer<const rlogic_serialization::Property *>(VT_ROOTOUTPUT);
   }
+  bool playbackControl() const {
+    return GetField<uint8_t>(VT_PLAYBACKCONTROL, 0) != 0;
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_BASE) &&
@@ -226,6 +230,7 @@ struct AnimationNode FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyTable(rootInput()) &&
            VerifyOffset(verifier, VT_ROOTOUTPUT) &&
            verifier.VerifyTable(rootOutput()) &&
+           VerifyField<uint8_t>(verifier, VT_PLAYBACKCONTROL) &&
            verifier.EndTable();
   }
 };
@@ -249,6 +254,9 @@ struct AnimationNodeBuilder {
   void add_rootOutput(flatbuffers::Offset<rlogic_serialization::Property> rootOutput) {
     fbb_.AddOffset(AnimationNode::VT_ROOTOUTPUT, rootOutput);
   }
+  void add_playbackControl(bool playbackControl) {
+    fbb_.AddElement<uint8_t>(AnimationNode::VT_PLAYBACKCONTROL, static_cast<uint8_t>(playbackControl), 0);
+  }
   explicit AnimationNodeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -267,12 +275,14 @@ inline flatbuffers::Offset<AnimationNode> CreateAnimationNode(
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::Channel>>> channels = 0,
     bool channelsAsProperties = false,
     flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0,
-    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0) {
+    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0,
+    bool playbackControl = false) {
   AnimationNodeBuilder builder_(_fbb);
   builder_.add_rootOutput(rootOutput);
   builder_.add_rootInput(rootInput);
   builder_.add_channels(channels);
   builder_.add_base(base);
+  builder_.add_playbackControl(playbackControl);
   builder_.add_channelsAsProperties(channelsAsProperties);
   return builder_.Finish();
 }
@@ -288,7 +298,8 @@ inline flatbuffers::Offset<AnimationNode> CreateAnimationNodeDirect(
     const std::vector<flatbuffers::Offset<rlogic_serialization::Channel>> *channels = nullptr,
     bool channelsAsProperties = false,
     flatbuffers::Offset<rlogic_serialization::Property> rootInput = 0,
-    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0) {
+    flatbuffers::Offset<rlogic_serialization::Property> rootOutput = 0,
+    bool playbackControl = false) {
   auto channels__ = channels ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::Channel>>(*channels) : 0;
   return rlogic_serialization::CreateAnimationNode(
       _fbb,
@@ -296,7 +307,8 @@ inline flatbuffers::Offset<AnimationNode> CreateAnimationNodeDirect(
       channels__,
       channelsAsProperties,
       rootInput,
-      rootOutput);
+      rootOutput,
+      playbackControl);
 }
 
 inline const flatbuffers::TypeTable *EInterpolationTypeTypeTable() {
@@ -356,7 +368,8 @@ inline const flatbuffers::TypeTable *AnimationNodeTypeTable() {
     { flatbuffers::ET_SEQUENCE, 1, 1 },
     { flatbuffers::ET_BOOL, 0, -1 },
     { flatbuffers::ET_SEQUENCE, 0, 2 },
-    { flatbuffers::ET_SEQUENCE, 0, 2 }
+    { flatbuffers::ET_SEQUENCE, 0, 2 },
+    { flatbuffers::ET_BOOL, 0, -1 }
   };
   static const flatbuffers::TypeFunction type_refs[] = {
     rlogic_serialization::LogicObjectTypeTable,
@@ -368,10 +381,11 @@ inline const flatbuffers::TypeTable *AnimationNodeTypeTable() {
     "channels",
     "channelsAsProperties",
     "rootInput",
-    "rootOutput"
+    "rootOutput",
+    "playbackControl"
   };
   static const flatbuffers::TypeTable tt = {
-    flatbuffers::ST_TABLE, 5, type_codes, type_refs, nullptr, names
+    flatbuffers::ST_TABLE, 6, type_codes, type_refs, nullptr, names
   };
   return &tt;
 }
@@ -7,6 +7,7 @@
 #include "flatbuffers/flatbuffers.h"
 
 #include "AnchorPointGen.h"
+#include "AnimationBlendNodeGen.h"
 #include "AnimationNodeGen.h"
 #include "DataArrayGen.h"
 #include "LinkGen.h"
@@ -55,7 +56,8 @@ struct ApiObjects FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_ANCHORPOINTS = 28,
     VT_RENDERGROUPBINDINGS = 30,
     VT_SKINBINDINGS = 32,
-    VT_MESHNODEBINDINGS = 34
+    VT_MESHNODEBINDINGS = 34,
+    VT_ANIMATIONBLENDNODES = 36
   };
   const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::LuaModule>> *luaModules() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::LuaModule>> *>(VT_LUAMODULES);
@@ -105,6 +107,9 @@ struct ApiObjects FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::RamsesMeshNodeBinding>> *meshNodeBindings() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::RamsesMeshNodeBinding>> *>(VT_MESHNODEBINDINGS);
   }
+  const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnimationBlendNode>> *animationBlendNodes() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnimationBlendNode>> *>(VT_ANIMATIONBLENDNODES);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_LUAMODULES) &&
@@ -153,6 +158,9 @@ struct ApiObjects FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_MESHNODEBINDINGS) &&
            verifier.VerifyVector(meshNodeBindings()) &&
            verifier.VerifyVectorOfTables(meshNodeBindings()) &&
+           VerifyOffset(verifier, VT_ANIMATIONBLENDNODES) &&
+           verifier.VerifyVector(animationBlendNodes()) &&
+           verifier.VerifyVectorOfTables(animationBlendNodes()) &&
            verifier.EndTable();
   }
 };
@@ -209,6 +217,9 @@ struct ApiObjectsBuilder {
   void add_meshNodeBindings(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::RamsesMeshNodeBinding>>> meshNodeBindings) {
     fbb_.AddOffset(ApiObjects::VT_MESHNODEBINDINGS, meshNodeBindings);
   }
+  void add_animationBlendNodes(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnimationBlendNode>>> animationBlendNodes) {
+    fbb_.AddOffset(ApiObjects::VT_ANIMATIONBLENDNODES, animationBlendNodes);
+  }
   explicit ApiObjectsBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -238,9 +249,11 @@ inline flatbuffers::Offset<ApiObjects> CreateApiObjects(
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnchorPoint>>> anchorPoints = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::RamsesRenderGroupBinding>>> renderGroupBindings = 0,
     flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::SkinBinding>>> skinBindings = 0,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::RamsesMeshNodeBinding>>> meshNodeBindings = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::RamsesMeshNodeBinding>>> meshNodeBindings = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<rlogic_serialization::AnimationBlendNode>>> animationBlendNodes = 0) {
   ApiObjectsBuilder builder_(_fbb);
   builder_.add_lastObjectId(lastObjectId);
+  builder_.add_animationBlendNodes(animationBlendNodes);
   builder_.add_meshNodeBindings(meshNodeBindings);
   builder_.add_skinBindings(skinBindings);
   builder_.add_renderGroupBindings(renderGroupBindings);
@@ -281,7 +294,8 @@ inline flatbuffers::Offset<ApiObjects> CreateApiObjectsDirect(
     const std::vector<flatbuffers::Offset<rlogic_serialization::AnchorPoint>> *anchorPoints = nullptr,
     const std::vector<flatbuffers::Offset<rlogic_serialization::RamsesRenderGroupBinding>> *renderGroupBindings = nullptr,
     const std::vector<flatbuffers::Offset<rlogic_serialization::SkinBinding>> *skinBindings = nullptr,
-    const std::vector<flatbuffers::Offset<rlogic_serialization::RamsesMeshNodeBinding>> *meshNodeBindings = nullptr) {
+    const std::vector<flatbuffers::Offset<rlogic_serialization::RamsesMeshNodeBinding>> *meshNodeBindings = nullptr,
+    const std::vector<flatbuffers::Offset<rlogic_serialization::AnimationBlendNode>> *animationBlendNodes = nullptr) {
   auto luaModules__ = luaModules ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::LuaModule>>(*luaModules) : 0;
   auto luaScripts__ = luaScripts ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::LuaScript>>(*luaScripts) : 0;
   auto luaInterfaces__ = luaInterfaces ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::LuaInterface>>(*luaInterfaces) : 0;
@@ -297,6 +311,7 @@ inline flatbuffers::Offset<ApiObjects> CreateApiObjectsDirect(
   auto renderGroupBindings__ = renderGroupBindings ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::RamsesRenderGroupBinding>>(*renderGroupBindings) : 0;
   auto skinBindings__ = skinBindings ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::SkinBinding>>(*skinBindings) : 0;
   auto meshNodeBindings__ = meshNodeBindings ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::RamsesMeshNodeBinding>>(*meshNodeBindings) : 0;
+  auto animationBlendNodes__ = animationBlendNodes ? _fbb.CreateVector<flatbuffers::Offset<rlogic_serialization::AnimationBlendNode>>(*animationBlendNodes) : 0;
   return rlogic_serialization::CreateApiObjects(
       _fbb,
       luaModules__,
@@ -314,7 +329,8 @@ inline flatbuffers::Offset<ApiObjects> CreateApiObjectsDirect(
       anchorPoints__,
       renderGroupBindings__,
       skinBindings__,
-      meshNodeBindings__);
+      meshNodeBindings__,
+      animationBlendNodes__);
 }
 
 inline const flatbuffers::TypeTable *ApiObjectsTypeTable() {
@@ -334,7 +350,8 @@ inline const flatbuffers::TypeTable *ApiObjectsTypeTable() {
     { flatbuffers::ET_SEQUENCE, 1, 11 },
     { flatbuffers::ET_SEQUENCE, 1, 12 },
     { flatbuffers::ET_SEQUENCE, 1, 13 },
-    { flatbuffers::ET_SEQUENCE, 1, 14 }
+    { flatbuffers::ET_SEQUENCE, 1, 14 },
+    { flatbuffers::ET_SEQUENCE, 1, 15 }
   };
   static const flatbuffers::TypeFunction type_refs[] = {
     rlogic_serialization::LuaModuleTypeTable,
@@ -351,7 +368,8 @@ inline const flatbuffers::TypeTable *ApiObjectsTypeTable() {
     rlogic_serialization::AnchorPointTypeTable,
     rlogic_serialization::RamsesRenderGroupBindingTypeTable,
     rlogic_serialization::SkinBindingTypeTable,
-    rlogic_serialization::RamsesMeshNodeBindingTypeTable
+    rlogic_serialization::RamsesMeshNodeBindingTypeTable,
+    rlogic_serialization::AnimationBlendNodeTypeTable
   };
   static const char * const names[] = {
     "luaModules",
@@ -369,10 +387,11 @@ inline const flatbuffers::TypeTable *ApiObjectsTypeTable() {
     "anchorPoints",
     "renderGroupBindings",
     "skinBindings",
-    "meshNodeBindings"
+    "meshNodeBindings",
+    "animationBlendNodes"
   };
   static const flatbuffers::TypeTable tt = {
-    flatbuffers::ST_TABLE, 16, type_codes, type_refs, nullptr, names
+    flatbuffers::ST_TABLE, 17, type_codes, type_refs, nullptr, names
   };
   return &tt;
 }
@@ -18,6 +18,7 @@
 #include "impl/RamsesCameraBindingImpl.h"
 
 #include "internals/Math.h"
+#include "internals/CameraViewProjectionCache.h"
 #include "internals/ErrorReporting.h"
 
 #include "generated/AnchorPointGen.h"
@@ -118,27 +119,42 @@ namespace rlogic::internal
 
     std::optional<LogicNodeRuntimeError> AnchorPointImpl::update()
     {
-        // NOLINTNEXTLINE(modernize-avoid-c-arrays) Ramses uses C array in matrix getters
-        float tempData[16];
-
+        // view-projection is shared by all anchor points using same camera, calculate directly only if there is no cache (anchor not owned by logic engine)
+        CameraViewProjection viewProjection;
         const auto& ramsesCam = m_cameraBinding.getRamsesCamera();
-        if (ramsesCam.getProjectionMatrix(tempData) != ramses::StatusOK)
-            return LogicNodeRuntimeError{"Failed to retrieve projection matrix from Ramses camera!"};
-        const math::Matrix44f projectionMatrix{ tempData };
-
-        if (ramsesCam.getInverseModelMatrix(tempData) != ramses::StatusOK)
-            return LogicNodeRuntimeError{ "Failed to retrieve view matrix from Ramses camera!" };
-        const math::Matrix44f cameraViewMatrix{ tempData };
+        auto potentialError = (m_cameraViewProjectionCache ? m_cameraViewProjectionCache->getViewProjection(ramsesCam, viewProjection) : CameraViewProjectionCache::Calculate(ramsesCam, viewProjection));
+        if (potentialError)
+            return potentialError;
 
+        // NOLINTNEXTLINE(modernize-avoid-c-arrays) Ramses uses C array in matrix getters
+        float tempData[16];
         if (m_nodeBinding.getRamsesNode().getModelMatrix(tempData) != ramses::StatusOK)
             return LogicNodeRuntimeError{ "Failed to retrieve model matrix from Ramses node!" };
         const math::Matrix44f modelMatrix{ tempData };
+        // local origin (0, 0, 0, 1) transformed to world space is the translation column of model matrix
+        const math::Vector4 pointInWorldSpace{ modelMatrix.m14, modelMatrix.m24, modelMatrix.m34, modelMatrix.m44 };
+
+        // AnchorPoint is updated every frame because Ramses states cannot be monitored,
+        // skip calculation if none of them changed since last update, outputs keep their values and no links get activated
+        if (m_outputsUpToDate &&
+            viewProjection.viewProjectionMatrix == m_lastViewProjection.viewProjectionMatrix &&
+            viewProjection.viewportWidth == m_lastViewProjection.viewportWidth &&
+            viewProjection.viewportHeight == m_lastViewProjection.viewportHeight &&
+            pointInWorldSpace.x == m_lastPointInWorldSpace.x &&
+            pointInWorldSpace.y == m_lastPointInWorldSpace.y &&
+            pointInWorldSpace.z == m_lastPointInWorldSpace.z &&
+            pointInWorldSpace.w == m_lastPointInWorldSpace.w)
+        {
+            return std::nullopt;
+        }
+        m_lastViewProjection = viewProjection;
+        m_lastPointInWorldSpace = pointInWorldSpace;
+        m_outputsUpToDate = true;
 
-        const math::Vector4 localOrigin{ 0, 0, 0, 1 };
-        const math::Vector4 pointInClipSpace = projectionMatrix * cameraViewMatrix * modelMatrix * localOrigin;
+        const math::Vector4 pointInClipSpace = viewProjection.viewProjectionMatrix * pointInWorldSpace;
         const math::Vector4 pointInNDS = pointInClipSpace / pointInClipSpace.w;
         const math::Vector4 pointNormalized = (pointInNDS + 1.f) / 2.f;
-        const math::Vector4 pointViewport = pointNormalized * math::Vector4{ float(ramsesCam.getViewportWidth()), float(ramsesCam.getViewportHeight()), 1.f, 1.f };
+        const math::Vector4 pointViewport = pointNormalized * math::Vector4{ float(viewProjection.viewportWidth), float(viewProjection.viewportHeight), 1.f, 1.f };
 
         getOutputs()->getChild(0u)->m_impl->setValue(vec2f{ pointViewport.x, pointViewport.y });
         getOutputs()->getChild(1u)->m_impl->setValue(pointViewport.z);
@@ -146,6 +162,16 @@ namespace rlogic::internal
         return std::nullopt;
     }
 
+    void AnchorPointImpl::invalidateCache()
+    {
+        m_outputsUpToDate = false;
+    }
+
+    void AnchorPointImpl::setCameraViewProjectionCache(CameraViewProjectionCache* cache)
+    {
+        m_cameraViewProjectionCache = cache;
+    }
+
     RamsesNodeBindingImpl& AnchorPointImpl::getRamsesNodeBinding()
     {
         return m_nodeBinding;
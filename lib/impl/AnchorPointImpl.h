@@ -9,6 +9,8 @@
 #pragma once
 
 #include "impl/LogicNodeImpl.h"
+#include "internals/Math.h"
+#include "internals/CameraViewProjectionCache.h"
 #include <memory>
 
 namespace rlogic_serialization
@@ -54,11 +56,22 @@ namespace rlogic::internal
         [[nodiscard]] RamsesCameraBindingImpl& getRamsesCameraBinding();
 
         std::optional<LogicNodeRuntimeError> update() override;
+        void invalidateCache() override;
+
+        // cache shared by all anchor points of a logic engine, if not set view-projection is calculated by each anchor point
+        void setCameraViewProjectionCache(CameraViewProjectionCache* cache);
 
         void createRootProperties() final;
 
     private:
         RamsesNodeBindingImpl& m_nodeBinding;
         RamsesCameraBindingImpl& m_cameraBinding;
+
+        CameraViewProjectionCache* m_cameraViewProjectionCache = nullptr;
+
+        // Ramses states used in last successful update, outputs are only recalculated if any of them changes
+        CameraViewProjection m_lastViewProjection;
+        math::Vector4 m_lastPointInWorldSpace;
+        bool m_outputsUpToDate = false;
     };
 }
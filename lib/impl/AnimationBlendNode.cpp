@@ -0,0 +1,22 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-logic/AnimationBlendNode.h"
+#include "impl/AnimationBlendNodeImpl.h"
+
+namespace rlogic
+{
+    AnimationBlendNode::AnimationBlendNode(std::unique_ptr<internal::AnimationBlendNodeImpl> impl) noexcept
+        : LogicNode(std::move(impl))
+        /* NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast) */
+        , m_animationBlendNodeImpl{ static_cast<internal::AnimationBlendNodeImpl&>(LogicNode::m_impl) }
+    {
+    }
+
+    AnimationBlendNode::~AnimationBlendNode() noexcept = default;
+}
@@ -0,0 +1,409 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/AnimationBlendNodeImpl.h"
+#include "impl/AnimationNodeImpl.h"
+#include "impl/PropertyImpl.h"
+#include "ramses-logic/EPropertyType.h"
+#include "ramses-logic/Property.h"
+#include "internals/EPropertySemantics.h"
+#include "internals/ErrorReporting.h"
+#include "internals/DeserializationMap.h"
+#include "generated/AnimationBlendNodeGen.h"
+#include "fmt/format.h"
+#include <cmath>
+#include <algorithm>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        // number of float components a channel value is decomposed into for blending
+        size_t GetComponentCount(const Property& prop)
+        {
+            switch (prop.getType())
+            {
+            case EPropertyType::Float:
+            case EPropertyType::Int32:
+                return 1u;
+            case EPropertyType::Vec2f:
+            case EPropertyType::Vec2i:
+                return 2u;
+            case EPropertyType::Vec3f:
+            case EPropertyType::Vec3i:
+                return 3u;
+            case EPropertyType::Vec4f:
+            case EPropertyType::Vec4i:
+                return 4u;
+            case EPropertyType::Array:
+                return prop.getChildCount();
+            case EPropertyType::Int64:
+            case EPropertyType::Bool:
+            case EPropertyType::String:
+            case EPropertyType::Struct:
+                break;
+            }
+            assert(!"unsupported animation channel type");
+            return 0u;
+        }
+
+        template <typename T>
+        void ReadVector(const PropertyImpl& prop, float* out)
+        {
+            const auto& v = prop.getValueAs<T>();
+            for (size_t i = 0u; i < v.size(); ++i)
+                out[i] = static_cast<float>(v[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        void ReadComponents(const Property& prop, float* out)
+        {
+            const PropertyImpl& impl = *prop.m_impl;
+            switch (prop.getType())
+            {
+            case EPropertyType::Float:
+                out[0] = impl.getValueAs<float>();
+                break;
+            case EPropertyType::Int32:
+                out[0] = static_cast<float>(impl.getValueAs<int32_t>());
+                break;
+            case EPropertyType::Vec2f:
+                ReadVector<vec2f>(impl, out);
+                break;
+            case EPropertyType::Vec3f:
+                ReadVector<vec3f>(impl, out);
+                break;
+            case EPropertyType::Vec4f:
+                ReadVector<vec4f>(impl, out);
+                break;
+            case EPropertyType::Vec2i:
+                ReadVector<vec2i>(impl, out);
+                break;
+            case EPropertyType::Vec3i:
+                ReadVector<vec3i>(impl, out);
+                break;
+            case EPropertyType::Vec4i:
+                ReadVector<vec4i>(impl, out);
+                break;
+            case EPropertyType::Array:
+                for (size_t i = 0u; i < prop.getChildCount(); ++i)
+                    out[i] = prop.getChild(i)->m_impl->getValueAs<float>(); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                break;
+            case EPropertyType::Int64:
+            case EPropertyType::Bool:
+            case EPropertyType::String:
+            case EPropertyType::Struct:
+                assert(!"unsupported animation channel type");
+                break;
+            }
+        }
+
+        template <typename T>
+        T MakeVector(const float* in)
+        {
+            T v{};
+            for (size_t i = 0u; i < v.size(); ++i)
+            {
+                if constexpr (std::is_integral_v<typename T::value_type>)
+                    v[i] = static_cast<typename T::value_type>(std::lround(in[i])); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                else
+                    v[i] = in[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            }
+            return v;
+        }
+
+        void WriteComponents(Property& prop, const float* in)
+        {
+            PropertyImpl& impl = *prop.m_impl;
+            switch (prop.getType())
+            {
+            case EPropertyType::Float:
+                impl.setValue(in[0]);
+                break;
+            case EPropertyType::Int32:
+                impl.setValue(static_cast<int32_t>(std::lround(in[0])));
+                break;
+            case EPropertyType::Vec2f:
+                impl.setValue(MakeVector<vec2f>(in));
+                break;
+            case EPropertyType::Vec3f:
+                impl.setValue(MakeVector<vec3f>(in));
+                break;
+            case EPropertyType::Vec4f:
+                impl.setValue(MakeVector<vec4f>(in));
+                break;
+            case EPropertyType::Vec2i:
+                impl.setValue(MakeVector<vec2i>(in));
+                break;
+            case EPropertyType::Vec3i:
+                impl.setValue(MakeVector<vec3i>(in));
+                break;
+            case EPropertyType::Vec4i:
+                impl.setValue(MakeVector<vec4i>(in));
+                break;
+            case EPropertyType::Array:
+                for (size_t i = 0u; i < prop.getChildCount(); ++i)
+                    prop.getChild(i)->m_impl->setValue(in[i]); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                break;
+            case EPropertyType::Int64:
+            case EPropertyType::Bool:
+            case EPropertyType::String:
+            case EPropertyType::Struct:
+                assert(!"unsupported animation channel type");
+                break;
+            }
+        }
+
+        bool HasSameType(const Property& prop1, const Property& prop2)
+        {
+            return prop1.getType() == prop2.getType() && prop1.getChildCount() == prop2.getChildCount();
+        }
+    }
+
+    AnimationBlendNodeImpl::AnimationBlendNodeImpl(std::vector<AnimationNodeImpl*> sources, std::string_view name, uint64_t id)
+        : LogicNodeImpl(name, id)
+        , m_sources{ std::move(sources) }
+    {
+        assert(!m_sources.empty());
+
+        // resolve which source outputs contribute to which blended channel once, so that update can work on plain pointers
+        const AnimationNodeImpl& mainSource = *m_sources.front();
+        const auto& mainChannels = mainSource.getChannels();
+        m_channels.resize(mainChannels.size());
+        size_t maxComponents = 0u;
+        for (size_t ch = 0u; ch < mainChannels.size(); ++ch)
+        {
+            const Property& mainOutput = *mainSource.getChannelOutput(ch);
+            auto& channelData = m_channels[ch];
+            channelData.isQuaternion =
+                mainChannels[ch].interpolationType == EInterpolationType::Linear_Quaternions ||
+                mainChannels[ch].interpolationType == EInterpolationType::Cubic_Quaternions;
+
+            channelData.sourceOutputs.reserve(m_sources.size());
+            for (const AnimationNodeImpl* source : m_sources)
+            {
+                const Property* sourceOutput = nullptr;
+                const auto& sourceChannels = source->getChannels();
+                for (size_t srcCh = 0u; srcCh < sourceChannels.size(); ++srcCh)
+                {
+                    const Property* candidate = source->getChannelOutput(srcCh);
+                    if (sourceChannels[srcCh].name == mainChannels[ch].name && HasSameType(*candidate, mainOutput))
+                    {
+                        sourceOutput = candidate;
+                        break;
+                    }
+                }
+                channelData.sourceOutputs.push_back(sourceOutput);
+            }
+
+            maxComponents = std::max(maxComponents, GetComponentCount(mainOutput));
+        }
+
+        m_weights.resize(m_sources.size());
+        m_accumulator.resize(maxComponents);
+        m_sample.resize(maxComponents);
+    }
+
+    void AnimationBlendNodeImpl::createRootProperties()
+    {
+        HierarchicalTypeData inputs({ "", EPropertyType::Struct }, {
+            MakeArray("weights", m_sources.size(), EPropertyType::Float)   // EInputIdx_Weights
+            });
+        auto inputsImpl = std::make_unique<PropertyImpl>(std::move(inputs), EPropertySemantics::AnimationInput);
+
+        HierarchicalTypeData outputs({ "", EPropertyType::Struct }, {});
+        const AnimationNodeImpl& mainSource = *m_sources.front();
+        const auto& mainChannels = mainSource.getChannels();
+        for (size_t ch = 0u; ch < mainChannels.size(); ++ch)
+        {
+            const Property& mainOutput = *mainSource.getChannelOutput(ch);
+            if (mainOutput.getType() == EPropertyType::Array)
+                outputs.children.push_back(MakeArray(std::string{ mainChannels[ch].name }, mainOutput.getChildCount(), EPropertyType::Float));
+            else
+                outputs.children.push_back(MakeType(std::string{ mainChannels[ch].name }, mainOutput.getType()));
+        }
+        auto outputsImpl = std::make_unique<PropertyImpl>(std::move(outputs), EPropertySemantics::AnimationOutput);
+
+        setRootProperties(std::make_unique<Property>(std::move(inputsImpl)), std::make_unique<Property>(std::move(outputsImpl)));
+
+        // fully weight the first source initially so that blend node mirrors it until weights are set
+        getInputs()->getChild(EInputIdx_Weights)->getChild(0u)->m_impl->setValue(1.f);
+    }
+
+    const std::vector<AnimationNodeImpl*>& AnimationBlendNodeImpl::getSources() const
+    {
+        return m_sources;
+    }
+
+    std::optional<LogicNodeRuntimeError> AnimationBlendNodeImpl::update()
+    {
+        const Property& weightsProp = *getInputs()->getChild(EInputIdx_Weights);
+        assert(weightsProp.getChildCount() == m_weights.size());
+        for (size_t i = 0u; i < m_weights.size(); ++i)
+            m_weights[i] = std::max(0.f, weightsProp.getChild(i)->m_impl->getValueAs<float>());
+
+        for (size_t ch = 0u; ch < m_channels.size(); ++ch)
+            blendChannel(ch);
+
+        return std::nullopt;
+    }
+
+    void AnimationBlendNodeImpl::blendChannel(size_t channelIdx)
+    {
+        const auto& channelData = m_channels[channelIdx];
+        Property& output = *getOutputs()->getChild(channelIdx);
+        const size_t numComponents = GetComponentCount(output);
+        float* acc = m_accumulator.data();
+        float* sample = m_sample.data();
+        std::fill(acc, acc + numComponents, 0.f); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        float totalWeight = 0.f;
+        for (size_t src = 0u; src < m_sources.size(); ++src)
+        {
+            const float weight = m_weights[src];
+            const Property* sourceOutput = channelData.sourceOutputs[src];
+            if (weight <= 0.f || !sourceOutput)
+                continue;
+
+            ReadComponents(*sourceOutput, sample);
+
+            // q and -q represent the same rotation, keep all contributions in the hemisphere of the accumulated result
+            // so that they do not cancel each other out
+            if (channelData.isQuaternion && totalWeight > 0.f)
+            {
+                float dot = 0.f;
+                for (size_t i = 0u; i < numComponents; ++i)
+                    dot += acc[i] * sample[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                if (dot < 0.f)
+                {
+                    for (size_t i = 0u; i < numComponents; ++i)
+                        sample[i] = -sample[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                }
+            }
+
+            for (size_t i = 0u; i < numComponents; ++i)
+                acc[i] += weight * sample[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            totalWeight += weight;
+        }
+
+        if (totalWeight <= 0.f)
+        {
+            // nothing contributes, fall back to first source which always provides all channels
+            assert(channelData.sourceOutputs.front());
+            ReadComponents(*channelData.sourceOutputs.front(), acc);
+        }
+        else if (channelData.isQuaternion)
+        {
+            // normalization also takes care of dividing by total weight
+            float lengthSquared = 0.f;
+            for (size_t i = 0u; i < numComponents; ++i)
+                lengthSquared += acc[i] * acc[i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            if (lengthSquared > 0.f)
+            {
+                const float normalizationFactor = 1.f / std::sqrt(lengthSquared);
+                for (size_t i = 0u; i < numComponents; ++i)
+                    acc[i] *= normalizationFactor; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            }
+        }
+        else
+        {
+            const float invTotalWeight = 1.f / totalWeight;
+            for (size_t i = 0u; i < numComponents; ++i)
+                acc[i] *= invTotalWeight; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        WriteComponents(output, acc);
+    }
+
+    flatbuffers::Offset<rlogic_serialization::AnimationBlendNode> AnimationBlendNodeImpl::Serialize(
+        const AnimationBlendNodeImpl& blendNode,
+        flatbuffers::FlatBufferBuilder& builder,
+        SerializationMap& serializationMap,
+        EFeatureLevel /*featureLevel*/)
+    {
+        std::vector<uint64_t> sourceIds;
+        sourceIds.reserve(blendNode.m_sources.size());
+        for (const auto* source : blendNode.m_sources)
+            sourceIds.push_back(source->getId());
+
+        const auto logicObject = LogicObjectImpl::Serialize(blendNode, builder);
+        const auto fbSourceIds = builder.CreateVector(sourceIds);
+        const auto inputPropertyObject = PropertyImpl::Serialize(*blendNode.getInputs()->m_impl, builder, serializationMap);
+        const auto ouputPropertyObject = PropertyImpl::Serialize(*blendNode.getOutputs()->m_impl, builder, serializationMap);
+        return rlogic_serialization::CreateAnimationBlendNode(
+            builder,
+            logicObject,
+            fbSourceIds,
+            inputPropertyObject,
+            ouputPropertyObject
+        );
+    }
+
+    std::unique_ptr<AnimationBlendNodeImpl> AnimationBlendNodeImpl::Deserialize(
+        const rlogic_serialization::AnimationBlendNode& blendNodeFB,
+        ErrorReporting& errorReporting,
+        DeserializationMap& deserializationMap)
+    {
+        std::string name;
+        uint64_t id = 0u;
+        uint64_t userIdHigh = 0u;
+        uint64_t userIdLow = 0u;
+        if (!LogicObjectImpl::Deserialize(blendNodeFB.base(), name, id, userIdHigh, userIdLow, errorReporting) ||
+            !blendNodeFB.sourceAnimationIds() || blendNodeFB.sourceAnimationIds()->size() == 0u ||
+            !blendNodeFB.rootInput() || !blendNodeFB.rootOutput())
+        {
+            errorReporting.add("Fatal error during loading of AnimationBlendNode from serialized data: missing name, id, sources or in/out property data!", nullptr, EErrorType::BinaryVersionMismatch);
+            return nullptr;
+        }
+
+        std::vector<AnimationNodeImpl*> sources;
+        sources.reserve(blendNodeFB.sourceAnimationIds()->size());
+        for (const uint64_t sourceId : *blendNodeFB.sourceAnimationIds())
+        {
+            auto* source = deserializationMap.resolveLogicObject<AnimationNodeImpl>(sourceId);
+            if (!source)
+            {
+                errorReporting.add(fmt::format("Fatal error during loading of AnimationBlendNode '{}': could not resolve source animation node!", name), nullptr, EErrorType::BinaryVersionMismatch);
+                return nullptr;
+            }
+            sources.push_back(source);
+        }
+
+        auto rootInProperty = PropertyImpl::Deserialize(*blendNodeFB.rootInput(), EPropertySemantics::AnimationInput, errorReporting, deserializationMap);
+        auto rootOutProperty = PropertyImpl::Deserialize(*blendNodeFB.rootOutput(), EPropertySemantics::AnimationOutput, errorReporting, deserializationMap);
+        if (!rootInProperty || !rootOutProperty)
+            return nullptr;
+
+        auto deserialized = std::make_unique<AnimationBlendNodeImpl>(std::move(sources), name, id);
+        deserialized->setUserId(userIdHigh, userIdLow);
+
+        const Property* weightsProp = rootInProperty->getChild(EInputIdx_Weights);
+        bool propertiesValid = weightsProp && weightsProp->getName() == "weights" && weightsProp->getType() == EPropertyType::Array &&
+            weightsProp->getChildCount() == deserialized->m_sources.size() &&
+            rootOutProperty->getChildCount() == deserialized->m_channels.size();
+        if (propertiesValid)
+        {
+            const AnimationNodeImpl& mainSource = *deserialized->m_sources.front();
+            for (size_t ch = 0u; ch < deserialized->m_channels.size(); ++ch)
+            {
+                const Property& mainOutput = *mainSource.getChannelOutput(ch);
+                const Property& output = *rootOutProperty->getChild(ch);
+                propertiesValid &= (output.getName() == mainOutput.getName() && HasSameType(output, mainOutput));
+            }
+        }
+
+        if (!propertiesValid)
+        {
+            errorReporting.add(fmt::format("Fatal error during loading of AnimationBlendNode '{}': missing or invalid properties!", name), nullptr, EErrorType::BinaryVersionMismatch);
+            return nullptr;
+        }
+
+        deserialized->setRootProperties(std::make_unique<Property>(std::move(rootInProperty)), std::make_unique<Property>(std::move(rootOutProperty)));
+
+        return deserialized;
+    }
+}
@@ -0,0 +1,78 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/EFeatureLevel.h"
+#include "impl/LogicNodeImpl.h"
+#include <memory>
+#include <vector>
+
+namespace rlogic_serialization
+{
+    struct AnimationBlendNode;
+}
+
+namespace flatbuffers
+{
+    template<typename T> struct Offset;
+    class FlatBufferBuilder;
+}
+
+namespace rlogic::internal
+{
+    class AnimationNodeImpl;
+    class SerializationMap;
+    class DeserializationMap;
+    class ErrorReporting;
+
+    class AnimationBlendNodeImpl : public LogicNodeImpl
+    {
+    public:
+        AnimationBlendNodeImpl(std::vector<AnimationNodeImpl*> sources, std::string_view name, uint64_t id);
+
+        [[nodiscard]] const std::vector<AnimationNodeImpl*>& getSources() const;
+
+        std::optional<LogicNodeRuntimeError> update() override;
+
+        [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::AnimationBlendNode> Serialize(
+            const AnimationBlendNodeImpl& blendNode,
+            flatbuffers::FlatBufferBuilder& builder,
+            SerializationMap& serializationMap,
+            EFeatureLevel featureLevel);
+        [[nodiscard]] static std::unique_ptr<AnimationBlendNodeImpl> Deserialize(
+            const rlogic_serialization::AnimationBlendNode& blendNodeFB,
+            ErrorReporting& errorReporting,
+            DeserializationMap& deserializationMap);
+
+        void createRootProperties() final;
+
+    private:
+        void blendChannel(size_t channelIdx);
+
+        std::vector<AnimationNodeImpl*> m_sources;
+
+        // per blended channel: which output of each source contributes to it (nullptr if the source has no matching channel)
+        struct ChannelBlendData
+        {
+            std::vector<const Property*> sourceOutputs;
+            bool isQuaternion = false;
+        };
+        std::vector<ChannelBlendData> m_channels;
+
+        // work data reused across updates to avoid allocations
+        std::vector<float> m_weights;
+        std::vector<float> m_accumulator;
+        std::vector<float> m_sample;
+
+        enum EInputIdx
+        {
+            EInputIdx_Weights = 0
+        };
+    };
+}
@@ -51,4 +51,14 @@ namespace rlogic
     {
         return m_impl->getExposingOfChannelDataAsProperties();
     }
+
+    void AnimationNodeConfig::setPlaybackControlEnabled(bool enabled)
+    {
+        m_impl->setPlaybackControlEnabled(enabled);
+    }
+
+    bool AnimationNodeConfig::getPlaybackControlEnabled() const
+    {
+        return m_impl->getPlaybackControlEnabled();
+    }
 }
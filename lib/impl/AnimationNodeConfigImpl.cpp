@@ -161,4 +161,14 @@ namespace rlogic::internal
     {
         return m_exposeChannelDataAsProperties;
     }
+
+    void AnimationNodeConfigImpl::setPlaybackControlEnabled(bool enabled)
+    {
+        m_playbackControlEnabled = enabled;
+    }
+
+    bool AnimationNodeConfigImpl::getPlaybackControlEnabled() const
+    {
+        return m_playbackControlEnabled;
+    }
 }
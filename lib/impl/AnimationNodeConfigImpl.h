@@ -21,8 +21,12 @@ namespace rlogic::internal
         bool setExposingOfChannelDataAsProperties(bool enabled);
         [[nodiscard]] bool getExposingOfChannelDataAsProperties() const;
 
+        void setPlaybackControlEnabled(bool enabled);
+        [[nodiscard]] bool getPlaybackControlEnabled() const;
+
     private:
         AnimationChannels m_channels;
         bool m_exposeChannelDataAsProperties = false;
+        bool m_playbackControlEnabled = false;
     };
 }
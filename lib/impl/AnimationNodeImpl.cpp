@@ -17,13 +17,15 @@
 #include "generated/AnimationNodeGen.h"
 #include "fmt/format.h"
 #include <cmath>
+#include <array>
 
 namespace rlogic::internal
 {
-    AnimationNodeImpl::AnimationNodeImpl(AnimationChannels channels, bool exposeDataAsProperties, std::string_view name, uint64_t id) noexcept
+    AnimationNodeImpl::AnimationNodeImpl(AnimationChannels channels, bool exposeDataAsProperties, bool playbackControl, std::string_view name, uint64_t id) noexcept
         : LogicNodeImpl(name, id)
         , m_channels{ std::move(channels) }
         , m_hasChannelDataExposedViaProperties{ exposeDataAsProperties }
+        , m_hasPlaybackControl{ playbackControl }
     {
         m_channelsWorkData.resize(m_channels.size());
         for (size_t i = 0u; i < m_channels.size(); ++i)
@@ -51,6 +53,15 @@ namespace rlogic::internal
         HierarchicalTypeData inputs = MakeStruct("", {
             {"progress", EPropertyType::Float},   // EInputIdx_Progress
             });
+        if (m_hasPlaybackControl)
+        {
+            inputs.children.push_back(MakeType("ticker_us", EPropertyType::Int64)); // EInputIdx_Ticker
+            inputs.children.push_back(MakeType("play", EPropertyType::Bool));       // EInputIdx_Play
+            inputs.children.push_back(MakeType("speed", EPropertyType::Float));     // EInputIdx_Speed
+            inputs.children.push_back(MakeType("loopMode", EPropertyType::Int32));  // EInputIdx_LoopMode
+            inputs.children.push_back(MakeType("startTime", EPropertyType::Float)); // EInputIdx_StartTime
+            inputs.children.push_back(MakeType("endTime", EPropertyType::Float));   // EInputIdx_EndTime
+        }
         if (m_hasChannelDataExposedViaProperties)
         {
             std::vector<HierarchicalTypeData> channelsData;
@@ -67,7 +78,7 @@ namespace rlogic::internal
 
                 channelsData.push_back(HierarchicalTypeData({ std::string{ channel.name }, EPropertyType::Struct }, channelDataArrays));
             }
-            inputs.children.push_back(HierarchicalTypeData({ "channelsData", EPropertyType::Struct }, channelsData)); // EInputIdx_ChannelsData
+            inputs.children.push_back(HierarchicalTypeData({ "channelsData", EPropertyType::Struct }, channelsData)); // always last, see getChannelsDataInputIdx
         }
         auto inputsImpl = std::make_unique<PropertyImpl>(std::move(inputs), EPropertySemantics::AnimationInput);
 
@@ -96,6 +107,13 @@ namespace rlogic::internal
 
         // initialize duration property, no need to set every update as it can change only if timestamps are modified
         getOutputs()->getChild(EOutputIdx_Duration)->set(m_maxChannelDuration);
+
+        // default playback plays whole animation with normal speed
+        if (m_hasPlaybackControl)
+        {
+            getInputs()->getChild(EInputIdx_Speed)->m_impl->setValue(1.f);
+            getInputs()->getChild(EInputIdx_EndTime)->m_impl->setValue(m_maxChannelDuration);
+        }
     }
 
     float AnimationNodeImpl::getMaximumChannelDuration() const
@@ -108,21 +126,139 @@ namespace rlogic::internal
         return m_channels;
     }
 
+    const Property* AnimationNodeImpl::getChannelOutput(size_t channelIdx) const
+    {
+        assert(channelIdx < m_channels.size());
+        return getOutputs()->getChild(channelIdx + EOutputIdx_ChannelsBegin);
+    }
+
+    void AnimationNodeImpl::addDependentNode(LogicNodeImpl& node)
+    {
+        m_dependentNodes.push_back(&node);
+    }
+
+    void AnimationNodeImpl::removeDependentNode(LogicNodeImpl& node)
+    {
+        const auto it = std::find(m_dependentNodes.cbegin(), m_dependentNodes.cend(), &node);
+        assert(it != m_dependentNodes.cend());
+        m_dependentNodes.erase(it);
+    }
+
+    const std::vector<LogicNodeImpl*>& AnimationNodeImpl::getDependentNodes() const
+    {
+        return m_dependentNodes;
+    }
+
+    AnimationNodeImpl::PlaybackState AnimationNodeImpl::getPlaybackState() const
+    {
+        return PlaybackState{ m_playbackTime, m_lastProgressInput, m_lastTicker };
+    }
+
+    void AnimationNodeImpl::setPlaybackState(const PlaybackState& state)
+    {
+        m_playbackTime = state.playbackTime;
+        m_lastProgressInput = state.lastProgressInput;
+        m_lastTicker = state.lastTicker;
+    }
+
     std::optional<LogicNodeRuntimeError> AnimationNodeImpl::update()
     {
         // propagate data from properties if this animation node has channel data properties
         if (m_hasChannelDataExposedViaProperties)
             updateAnimationDataFromProperties();
 
-        const float progress = *getInputs()->getChild(EInputIdx_Progress)->get<float>();
-        const float localAnimationTime = progress * m_maxChannelDuration;
+        float localAnimationTime = 0.f;
+        if (m_hasPlaybackControl)
+        {
+            if (auto error = updatePlayback(localAnimationTime))
+                return error;
+        }
+        else
+        {
+            const float progress = *getInputs()->getChild(EInputIdx_Progress)->get<float>();
+            localAnimationTime = progress * m_maxChannelDuration;
+        }
 
         for (size_t i = 0u; i < m_channels.size(); ++i)
             updateChannel(i, localAnimationTime);
 
+        // dependent nodes read channel outputs directly, they are not reached by link activation
+        for (auto* dependentNode : m_dependentNodes)
+            dependentNode->setDirty(true);
+
         return std::nullopt;
     }
 
+    std::optional<LogicNodeRuntimeError> AnimationNodeImpl::updatePlayback(float& localAnimationTime)
+    {
+        const auto& inputs = *getInputs();
+        const float progress = *inputs.getChild(EInputIdx_Progress)->get<float>();
+        const int64_t ticker = *inputs.getChild(EInputIdx_Ticker)->get<int64_t>();
+        const bool play = *inputs.getChild(EInputIdx_Play)->get<bool>();
+        const float speed = *inputs.getChild(EInputIdx_Speed)->get<float>();
+        const int32_t loopMode = *inputs.getChild(EInputIdx_LoopMode)->get<int32_t>();
+
+        if (loopMode < static_cast<int32_t>(EAnimationLoopMode::Once) || loopMode > static_cast<int32_t>(EAnimationLoopMode::PingPong))
+            return LogicNodeRuntimeError{ fmt::format("Invalid loop mode {} set in AnimationNode playback control!", loopMode) };
+
+        // clip range is always within animation duration
+        const float startTime = std::clamp(*inputs.getChild(EInputIdx_StartTime)->get<float>(), 0.f, m_maxChannelDuration);
+        const float endTime = std::clamp(*inputs.getChild(EInputIdx_EndTime)->get<float>(), startTime, m_maxChannelDuration);
+        const float clipDuration = endTime - startTime;
+
+        // explicitly setting progress seeks to that position
+        if (progress != m_lastProgressInput)
+        {
+            m_playbackTime = progress * m_maxChannelDuration - startTime;
+            m_lastProgressInput = progress;
+        }
+
+        // advance by ticker difference since last update, first update after (re)starting playback only takes the ticker as reference
+        if (play)
+        {
+            if (m_lastTicker)
+                m_playbackTime += speed * static_cast<float>(ticker - *m_lastTicker) * 1e-6f;
+            m_lastTicker = ticker;
+        }
+        else
+        {
+            m_lastTicker.reset();
+        }
+
+        // wrap playback time into [0, period) to keep it bounded when playing forever
+        const auto wrap = [](float time, float period) {
+            if (period <= 0.f)
+                return 0.f;
+            time = std::fmod(time, period);
+            return time < 0.f ? time + period : time;
+        };
+
+        float clipTime = 0.f;
+        switch (static_cast<EAnimationLoopMode>(loopMode))
+        {
+        case EAnimationLoopMode::Once:
+            m_playbackTime = std::clamp(m_playbackTime, 0.f, clipDuration);
+            clipTime = m_playbackTime;
+            break;
+        case EAnimationLoopMode::Loop:
+            m_playbackTime = wrap(m_playbackTime, clipDuration);
+            clipTime = m_playbackTime;
+            break;
+        case EAnimationLoopMode::PingPong:
+            m_playbackTime = wrap(m_playbackTime, 2.f * clipDuration);
+            clipTime = (m_playbackTime <= clipDuration ? m_playbackTime : 2.f * clipDuration - m_playbackTime);
+            break;
+        }
+
+        localAnimationTime = startTime + clipTime;
+        return std::nullopt;
+    }
+
+    size_t AnimationNodeImpl::getChannelsDataInputIdx() const
+    {
+        return m_hasPlaybackControl ? EInputIdx_PlaybackEnd : EInputIdx_Progress + 1u;
+    }
+
     void AnimationNodeImpl::updateChannel(size_t channelIdx, float localAnimationTime)
     {
         const auto& channelWorkData = m_channelsWorkData[channelIdx];
@@ -341,14 +477,16 @@ namespace rlogic::internal
             builder.CreateVector(channelsFB),
             animNode.m_hasChannelDataExposedViaProperties,
             inputPropertyObject,
-            ouputPropertyObject
+            ouputPropertyObject,
+            animNode.m_hasPlaybackControl
         );
     }
 
     std::unique_ptr<AnimationNodeImpl> AnimationNodeImpl::Deserialize(
         const rlogic_serialization::AnimationNode& animNodeFB,
         ErrorReporting& errorReporting,
-        DeserializationMap& deserializationMap)
+        DeserializationMap& deserializationMap,
+        EFeatureLevel featureLevel)
     {
         std::string name;
         uint64_t id = 0u;
@@ -421,7 +559,14 @@ namespace rlogic::internal
         auto rootInProperty = PropertyImpl::Deserialize(*animNodeFB.rootInput(), EPropertySemantics::AnimationInput, errorReporting, deserializationMap);
         auto rootOutProperty = PropertyImpl::Deserialize(*animNodeFB.rootOutput(), EPropertySemantics::AnimationOutput, errorReporting, deserializationMap);
 
-        auto deserialized = std::make_unique<AnimationNodeImpl>(std::move(channels), hasChannelDataProperties, name, id);
+        const bool hasPlaybackControl = animNodeFB.playbackControl();
+        if (hasPlaybackControl && featureLevel < EFeatureLevel_06)
+        {
+            errorReporting.add(fmt::format("Fatal error during loading of AnimationNode '{}': playback control requires feature level 06 or higher!", name), nullptr, EErrorType::BinaryVersionMismatch);
+            return nullptr;
+        }
+
+        auto deserialized = std::make_unique<AnimationNodeImpl>(std::move(channels), hasChannelDataProperties, hasPlaybackControl, name, id);
         deserialized->setUserId(userIdHigh, userIdLow);
 
         if (!rootInProperty->getChild(EInputIdx_Progress) || rootInProperty->getChild(EInputIdx_Progress)->getName() != "progress" ||
@@ -432,7 +577,28 @@ namespace rlogic::internal
             return nullptr;
         }
 
-        if (hasChannelDataProperties && (!rootInProperty->getChild(EInputIdx_ChannelsData) || rootInProperty->getChild(EInputIdx_ChannelsData)->getName() != "channelsData"))
+        if (hasPlaybackControl)
+        {
+            const std::array<std::pair<size_t, std::string_view>, 6> playbackInputs = { {
+                { EInputIdx_Ticker, "ticker_us" },
+                { EInputIdx_Play, "play" },
+                { EInputIdx_Speed, "speed" },
+                { EInputIdx_LoopMode, "loopMode" },
+                { EInputIdx_StartTime, "startTime" },
+                { EInputIdx_EndTime, "endTime" }
+            } };
+            for (const auto& [idx, inputName] : playbackInputs)
+            {
+                if (!rootInProperty->getChild(idx) || rootInProperty->getChild(idx)->getName() != inputName)
+                {
+                    errorReporting.add(fmt::format("Fatal error during loading of AnimationNode '{}': missing or invalid playback control properties!", name), nullptr, EErrorType::BinaryVersionMismatch);
+                    return nullptr;
+                }
+            }
+        }
+
+        const size_t channelsDataIdx = deserialized->getChannelsDataInputIdx();
+        if (hasChannelDataProperties && (!rootInProperty->getChild(channelsDataIdx) || rootInProperty->getChild(channelsDataIdx)->getName() != "channelsData"))
         {
             errorReporting.add(fmt::format("Fatal error during loading of AnimationNode '{}': missing or invalid channels data property!", name), nullptr, EErrorType::BinaryVersionMismatch);
             return nullptr;
@@ -483,7 +649,7 @@ namespace rlogic::internal
 
     void AnimationNodeImpl::updateAnimationDataFromProperties()
     {
-        const auto channelsDataProp = getInputs()->getChild(EInputIdx_ChannelsData);
+        const auto channelsDataProp = getInputs()->getChild(getChannelsDataInputIdx());
         for (size_t ch = 0u; ch < channelsDataProp->getChildCount(); ++ch)
         {
             const auto channelDataProp = channelsDataProp->getChild(ch);
@@ -9,10 +9,12 @@
 #pragma once
 
 #include "ramses-logic/AnimationTypes.h"
+#include "ramses-logic/EFeatureLevel.h"
 
 #include "impl/LogicNodeImpl.h"
 #include "impl/DataArrayImpl.h"
 #include <memory>
+#include <vector>
 
 namespace rlogic_serialization
 {
@@ -34,10 +36,26 @@ namespace rlogic::internal
     class AnimationNodeImpl : public LogicNodeImpl
     {
     public:
-        AnimationNodeImpl(AnimationChannels channels, bool exposeDataAsProperties, std::string_view name, uint64_t id) noexcept;
+        AnimationNodeImpl(AnimationChannels channels, bool exposeDataAsProperties, bool playbackControl, std::string_view name, uint64_t id) noexcept;
 
         [[nodiscard]] float getMaximumChannelDuration() const;
         [[nodiscard]] const AnimationChannels& getChannels() const;
+        [[nodiscard]] const Property* getChannelOutput(size_t channelIdx) const;
+
+        // nodes which consume channel outputs directly (not via links) and need to be updated whenever this node is updated
+        void addDependentNode(LogicNodeImpl& node);
+        void removeDependentNode(LogicNodeImpl& node);
+        [[nodiscard]] const std::vector<LogicNodeImpl*>& getDependentNodes() const;
+
+        // runtime state of playback control which is not stored in properties
+        struct PlaybackState
+        {
+            float playbackTime = 0.f;
+            float lastProgressInput = 0.f;
+            std::optional<int64_t> lastTicker;
+        };
+        [[nodiscard]] PlaybackState getPlaybackState() const;
+        void setPlaybackState(const PlaybackState& state);
 
         std::optional<LogicNodeRuntimeError> update() override;
 
@@ -48,12 +66,15 @@ namespace rlogic::internal
         [[nodiscard]] static std::unique_ptr<AnimationNodeImpl> Deserialize(
             const rlogic_serialization::AnimationNode& animNodeFB,
             ErrorReporting& errorReporting,
-            DeserializationMap& deserializationMap);
+            DeserializationMap& deserializationMap,
+            EFeatureLevel featureLevel);
 
         void createRootProperties() final;
 
     private:
         void updateChannel(size_t channelIdx, float localAnimationTime);
+        [[nodiscard]] std::optional<LogicNodeRuntimeError> updatePlayback(float& localAnimationTime);
+        [[nodiscard]] size_t getChannelsDataInputIdx() const;
 
         template <typename T>
         T interpolateKeyframes_linear(T lowerVal, T upperVal, float interpRatio);
@@ -77,11 +98,27 @@ namespace rlogic::internal
         float m_maxChannelDuration = 0.f;
 
         bool m_hasChannelDataExposedViaProperties = false;
+        bool m_hasPlaybackControl = false;
+
+        // playback state, time is relative to clip range start
+        float m_playbackTime = 0.f;
+        float m_lastProgressInput = 0.f;
+        std::optional<int64_t> m_lastTicker;
+
+        std::vector<LogicNodeImpl*> m_dependentNodes;
 
         enum EInputIdx
         {
             EInputIdx_Progress = 0,
-            EInputIdx_ChannelsData    // optional property for animation nodes with exposed channel data - should be always last!
+            // optional properties for animation nodes with playback control
+            EInputIdx_Ticker,
+            EInputIdx_Play,
+            EInputIdx_Speed,
+            EInputIdx_LoopMode,
+            EInputIdx_StartTime,
+            EInputIdx_EndTime,
+            EInputIdx_PlaybackEnd
+            // optional channel data property follows (for animation nodes with exposed channel data) - should be always last!
         };
 
         enum EOutputIdx
@@ -22,6 +22,7 @@
 #include "ramses-logic/AnimationNode.h"
 #include "ramses-logic/TimerNode.h"
 #include "ramses-logic/AnchorPoint.h"
+#include "ramses-logic/AnimationBlendNode.h"
 
 #include "impl/LogicEngineImpl.h"
 #include "impl/LuaConfigImpl.h"
@@ -64,34 +65,16 @@ namespace rlogic
         return m_impl->getSerializedSize<T>();
     }
 
-    template <typename T>
-    const T* findObject(const internal::ApiObjects& apiObjects, std::string_view name)
-    {
-        const auto& container = apiObjects.getApiObjectContainer<T>();
-        const auto it = std::find_if(container.cbegin(), container.cend(), [name](const auto& o) {
-            return o->getName() == name; });
-
-        return (it == container.cend() ? nullptr : *it);
-    }
-
     template <typename T>
     const T* LogicEngine::findLogicObjectInternal(std::string_view name) const
     {
-        auto& container = m_impl->getApiObjects().getApiObjectContainer<T>();
-        const auto it = std::find_if(container.begin(), container.end(), [name](const auto& o) {
-            return o->getName() == name; });
-
-        return (it == container.end() ? nullptr : *it);
+        return static_cast<const T*>(m_impl->getApiObjects().getNameIndex().find(name, internal::LogicObjectTypeOf<T>));
     }
 
     template <typename T>
     T* LogicEngine::findLogicObjectInternal(std::string_view name)
     {
-        auto& container = m_impl->getApiObjects().getApiObjectContainer<T>();
-        const auto it = std::find_if(container.begin(), container.end(), [name](const auto& o) {
-            return o->getName() == name; });
-
-        return (it == container.end() ? nullptr : *it);
+        return static_cast<T*>(m_impl->getApiObjects().getNameIndex().find(name, internal::LogicObjectTypeOf<T>));
     }
 
     const LogicObject* LogicEngine::findLogicObjectById(uint64_t id) const
@@ -135,11 +118,21 @@ namespace rlogic
         return m_impl->createRamsesNodeBinding(ramsesNode, rotationType, name);
     }
 
+    void LogicEngine::reserve(size_t objectCount)
+    {
+        m_impl->reserve(objectCount);
+    }
+
     bool LogicEngine::destroy(LogicObject& object)
     {
         return m_impl->destroy(object);
     }
 
+    bool LogicEngine::destroy(const std::vector<LogicObject*>& objects)
+    {
+        return m_impl->destroy(objects);
+    }
+
     RamsesAppearanceBinding* LogicEngine::createRamsesAppearanceBinding(ramses::Appearance& ramsesAppearance, std::string_view name)
     {
         return m_impl->createRamsesAppearanceBinding(ramsesAppearance, name);
@@ -202,6 +195,11 @@ namespace rlogic
         return m_impl->createAnchorPoint(nodeBinding, cameraBinding, name);
     }
 
+    AnimationBlendNode* LogicEngine::createAnimationBlendNode(const std::vector<const AnimationNode*>& sources, std::string_view name)
+    {
+        return m_impl->createAnimationBlendNode(sources, name);
+    }
+
     const std::vector<ErrorData>& LogicEngine::getErrors() const
     {
         return m_impl->getErrors();
@@ -217,6 +215,21 @@ namespace rlogic
         return m_impl->update();
     }
 
+    bool LogicEngine::updateNodes(const std::vector<LogicNode*>& rootNodes)
+    {
+        return m_impl->updateNodes(rootNodes);
+    }
+
+    bool LogicEngine::updateWithBudget(std::chrono::microseconds budget, bool applyBindingsWhenSettled)
+    {
+        return m_impl->updateWithBudget(budget, applyBindingsWhenSettled);
+    }
+
+    bool LogicEngine::isUpdateSettled() const
+    {
+        return m_impl->isUpdateSettled();
+    }
+
     void LogicEngine::enableUpdateReport(bool enable)
     {
         m_impl->enableUpdateReport(enable);
@@ -252,6 +265,56 @@ namespace rlogic
         return m_impl->loadFromBuffer(rawBuffer, bufferSize, ramsesScene, enableMemoryVerification);
     }
 
+    std::optional<uint64_t> LogicEngine::loadPackageFromFile(std::string_view filename, ramses::Scene* ramsesScene /* = nullptr*/, bool enableMemoryVerification /* = true */)
+    {
+        return m_impl->loadPackageFromFile(filename, ramsesScene, enableMemoryVerification);
+    }
+
+    std::optional<uint64_t> LogicEngine::loadPackageFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* ramsesScene /* = nullptr*/, bool enableMemoryVerification /* = true */)
+    {
+        return m_impl->loadPackageFromBuffer(rawBuffer, bufferSize, ramsesScene, enableMemoryVerification);
+    }
+
+    bool LogicEngine::unloadPackage(uint64_t packageId)
+    {
+        return m_impl->unloadPackage(packageId);
+    }
+
+    void LogicEngine::enableLazyLuaScriptLoading(bool enable)
+    {
+        m_impl->enableLazyLuaScriptLoading(enable);
+    }
+
+    void LogicEngine::enableParallelLoading(bool enable)
+    {
+        m_impl->enableParallelLoading(enable);
+    }
+
+    void LogicEngine::enableVerificationCache(bool enable, const std::optional<std::array<uint8_t, 16>>& key)
+    {
+        m_impl->enableVerificationCache(enable, key);
+    }
+
+    bool LogicEngine::exportVerificationCache(std::vector<uint8_t>& data)
+    {
+        return m_impl->exportVerificationCache(data);
+    }
+
+    bool LogicEngine::importVerificationCache(const std::vector<uint8_t>& data)
+    {
+        return m_impl->importVerificationCache(data);
+    }
+
+    LogicEngineState LogicEngine::captureState() const
+    {
+        return m_impl->captureState();
+    }
+
+    bool LogicEngine::restoreState(const LogicEngineState& state)
+    {
+        return m_impl->restoreState(state);
+    }
+
     bool LogicEngine::GetFeatureLevelFromFile(std::string_view filename, EFeatureLevel& detectedFeatureLevel)
     {
         return internal::LogicEngineImpl::GetFeatureLevelFromFile(filename, detectedFeatureLevel);
@@ -267,6 +330,11 @@ namespace rlogic
         return m_impl->saveToFile(filename, *config.m_impl);
     }
 
+    bool LogicEngine::saveToBuffer(std::vector<uint8_t>& buffer, const SaveFileConfig& config)
+    {
+        return m_impl->saveToBuffer(buffer, *config.m_impl);
+    }
+
     bool LogicEngine::link(const Property& sourceProperty, const Property& targetProperty)
     {
         return m_impl->link(sourceProperty, targetProperty);
@@ -282,11 +350,41 @@ namespace rlogic
         return m_impl->unlink(sourceProperty, targetProperty);
     }
 
+    bool LogicEngine::beginTransaction()
+    {
+        return m_impl->beginTransaction();
+    }
+
+    bool LogicEngine::commitTransaction()
+    {
+        return m_impl->commitTransaction();
+    }
+
+    bool LogicEngine::rollbackTransaction()
+    {
+        return m_impl->rollbackTransaction();
+    }
+
     bool LogicEngine::isLinked(const LogicNode& logicNode) const
     {
         return m_impl->isLinked(logicNode);
     }
 
+    bool LogicEngine::suspendNodes(const std::vector<LogicNode*>& nodes)
+    {
+        return m_impl->suspendNodes(nodes);
+    }
+
+    bool LogicEngine::resumeNodes(const std::vector<LogicNode*>& nodes)
+    {
+        return m_impl->resumeNodes(nodes);
+    }
+
+    bool LogicEngine::isSuspended(const LogicNode& logicNode) const
+    {
+        return m_impl->isSuspended(logicNode);
+    }
+
     size_t LogicEngine::getTotalSerializedSize() const
     {
         return m_impl->getTotalSerializedSize();
@@ -312,6 +410,7 @@ namespace rlogic
     template RLOGIC_API Collection<AnimationNode>            LogicEngine::getLogicObjectsInternal<AnimationNode>() const;
     template RLOGIC_API Collection<TimerNode>                LogicEngine::getLogicObjectsInternal<TimerNode>() const;
     template RLOGIC_API Collection<AnchorPoint>              LogicEngine::getLogicObjectsInternal<AnchorPoint>() const;
+    template RLOGIC_API Collection<AnimationBlendNode>       LogicEngine::getLogicObjectsInternal<AnimationBlendNode>() const;
 
     template RLOGIC_API const LogicObject*              LogicEngine::findLogicObjectInternal<LogicObject>(std::string_view) const;
     template RLOGIC_API const LuaScript*                LogicEngine::findLogicObjectInternal<LuaScript>(std::string_view) const;
@@ -328,6 +427,7 @@ namespace rlogic
     template RLOGIC_API const AnimationNode*            LogicEngine::findLogicObjectInternal<AnimationNode>(std::string_view) const;
     template RLOGIC_API const TimerNode*                LogicEngine::findLogicObjectInternal<TimerNode>(std::string_view) const;
     template RLOGIC_API const AnchorPoint*              LogicEngine::findLogicObjectInternal<AnchorPoint>(std::string_view) const;
+    template RLOGIC_API const AnimationBlendNode*       LogicEngine::findLogicObjectInternal<AnimationBlendNode>(std::string_view) const;
 
     template RLOGIC_API LogicObject*              LogicEngine::findLogicObjectInternal<LogicObject>(std::string_view);
     template RLOGIC_API LuaScript*                LogicEngine::findLogicObjectInternal<LuaScript>(std::string_view);
@@ -344,6 +444,7 @@ namespace rlogic
     template RLOGIC_API AnimationNode*            LogicEngine::findLogicObjectInternal<AnimationNode>(std::string_view);
     template RLOGIC_API TimerNode*                LogicEngine::findLogicObjectInternal<TimerNode>(std::string_view);
     template RLOGIC_API AnchorPoint*              LogicEngine::findLogicObjectInternal<AnchorPoint>(std::string_view);
+    template RLOGIC_API AnimationBlendNode*       LogicEngine::findLogicObjectInternal<AnimationBlendNode>(std::string_view);
 
     template RLOGIC_API DataArray* LogicEngine::createDataArrayInternal<float>(const std::vector<float>&, std::string_view);
     template RLOGIC_API DataArray* LogicEngine::createDataArrayInternal<vec2f>(const std::vector<vec2f>&, std::string_view);
@@ -370,4 +471,5 @@ namespace rlogic
     template RLOGIC_API size_t LogicEngine::getSerializedSizeInternal<AnimationNode>() const;
     template RLOGIC_API size_t LogicEngine::getSerializedSizeInternal<TimerNode>() const;
     template RLOGIC_API size_t LogicEngine::getSerializedSizeInternal<AnchorPoint>() const;
+    template RLOGIC_API size_t LogicEngine::getSerializedSizeInternal<AnimationBlendNode>() const;
 }
@@ -18,6 +18,8 @@
 #include "ramses-logic/RamsesAppearanceBinding.h"
 #include "ramses-logic/TimerNode.h"
 #include "ramses-logic/AnchorPoint.h"
+#include "ramses-logic/AnimationBlendNode.h"
+#include "ramses-logic/AnimationNode.h"
 #include "ramses-logic/AnimationNodeConfig.h"
 #include "ramses-logic/RamsesRenderGroupBinding.h"
 #include "ramses-logic/RamsesRenderGroupBindingElements.h"
@@ -25,16 +27,23 @@
 #include "ramses-logic/SkinBinding.h"
 
 #include "impl/LogicNodeImpl.h"
+#include "impl/PropertyImpl.h"
 #include "impl/LoggerImpl.h"
 #include "impl/LuaScriptImpl.h"
 #include "impl/LuaModuleImpl.h"
 #include "impl/LuaConfigImpl.h"
 #include "impl/SaveFileConfigImpl.h"
 #include "impl/SkinBindingImpl.h"
+#include "impl/RamsesNodeBindingImpl.h"
+#include "impl/RamsesCameraBindingImpl.h"
+#include "impl/AnimationNodeImpl.h"
 #include "impl/LogicEngineReportImpl.h"
+#include "impl/LogicEngineStateImpl.h"
 #include "impl/RamsesRenderGroupBindingElementsImpl.h"
 
+#include "internals/CompressedContainer.h"
 #include "internals/FileUtils.h"
+#include "internals/MemoryMappedFile.h"
 #include "internals/TypeUtils.h"
 #include "internals/RamsesObjectResolver.h"
 #include "internals/ApiObjects.h"
@@ -50,9 +59,14 @@
 
 #include "fmt/format.h"
 
+#include <algorithm>
+#include <iterator>
+#include <cassert>
 #include <string>
 #include <fstream>
 #include <streambuf>
+#include <optional>
+#include <vector>
 
 namespace
 {
@@ -315,6 +329,12 @@ namespace rlogic::internal
             return nullptr;
         }
 
+        if (config.getPlaybackControlEnabled() && m_featureLevel < EFeatureLevel_06)
+        {
+            m_errors.add(fmt::format("Cannot create AnimationNode '{}' with playback control, feature level 06 or higher is required, feature level in this runtime set to 0{}.", name, m_featureLevel), nullptr, EErrorType::Other);
+            return nullptr;
+        }
+
         for (const auto& channel : config.getChannels())
         {
             if (!containsDataArray(channel.timeStamps) ||
@@ -362,17 +382,189 @@ namespace rlogic::internal
         return m_apiObjects->createAnchorPoint(nodeBinding.m_nodeBinding, cameraBinding.m_cameraBinding, name);
     }
 
+    AnimationBlendNode* LogicEngineImpl::createAnimationBlendNode(const std::vector<const AnimationNode*>& sources, std::string_view name)
+    {
+        m_errors.clear();
+        if (m_featureLevel < EFeatureLevel_06)
+        {
+            m_errors.add(fmt::format("Cannot create AnimationBlendNode, feature level 06 or higher is required, feature level in this runtime set to 0{}.", m_featureLevel), nullptr, EErrorType::Other);
+            return nullptr;
+        }
+
+        if (sources.empty())
+        {
+            m_errors.add(fmt::format("Failed to create AnimationBlendNode '{}': must provide at least one source animation node.", name), nullptr, EErrorType::IllegalArgument);
+            return nullptr;
+        }
+
+        if (sources.size() > MaxArrayPropertySize)
+        {
+            m_errors.add(fmt::format("Failed to create AnimationBlendNode '{}': number of source animation nodes {} exceeds maximum of {}.", name, sources.size(), MaxArrayPropertySize), nullptr, EErrorType::IllegalArgument);
+            return nullptr;
+        }
+
+        const auto& animationNodes = m_apiObjects->getApiObjectContainer<AnimationNode>();
+        std::vector<AnimationNodeImpl*> sourceImpls;
+        sourceImpls.reserve(sources.size());
+        for (const AnimationNode* source : sources)
+        {
+            if (std::find(animationNodes.cbegin(), animationNodes.cend(), source) == animationNodes.cend())
+            {
+                m_errors.add(fmt::format("Failed to create AnimationBlendNode '{}': source animation node was not found in this logic instance.", name), nullptr, EErrorType::IllegalArgument);
+                return nullptr;
+            }
+
+            if (std::find(sourceImpls.cbegin(), sourceImpls.cend(), &source->m_animationNodeImpl) != sourceImpls.cend())
+            {
+                m_errors.add(fmt::format("Failed to create AnimationBlendNode '{}': source animation node '{}' provided more than once.", name, source->getName()), nullptr, EErrorType::IllegalArgument);
+                return nullptr;
+            }
+
+            sourceImpls.push_back(&source->m_animationNodeImpl);
+        }
+
+        return m_apiObjects->createAnimationBlendNode(std::move(sourceImpls), name);
+    }
+
+    void LogicEngineImpl::reserve(size_t objectCount)
+    {
+        // most objects are usually logic nodes, node related storage is prepared for all of them
+        m_apiObjects->reserve(objectCount, objectCount);
+    }
+
     bool LogicEngineImpl::destroy(LogicObject& object)
     {
         m_errors.clear();
+        if (m_transaction)
+            return addObjectsToDestroyOnCommit({ &object });
         return m_apiObjects->destroy(object, m_errors);
     }
 
+    bool LogicEngineImpl::destroy(const std::vector<LogicObject*>& objects)
+    {
+        m_errors.clear();
+        if (m_transaction)
+            return addObjectsToDestroyOnCommit(objects);
+        return m_apiObjects->destroy(objects, m_errors);
+    }
+
+    bool LogicEngineImpl::addObjectsToDestroyOnCommit(const std::vector<LogicObject*>& objects)
+    {
+        assert(m_transaction);
+        // objects are checked right away so that error is reported by the failing call, same as for links
+        for (LogicObject* object : objects)
+        {
+            if (!m_apiObjects->checkObjectToDestroyIsValid(object, m_errors))
+            {
+                m_transaction->failed = true;
+                return false;
+            }
+            if (m_transaction->objectsToDestroySet.count(object) != 0u)
+            {
+                m_errors.add(fmt::format("Tried to destroy object '{}' which is already destroyed within the transaction", object->getName()), object, EErrorType::IllegalArgument);
+                m_transaction->failed = true;
+                return false;
+            }
+        }
+
+        for (LogicObject* object : objects)
+        {
+            if (m_transaction->objectsToDestroySet.insert(object).second)
+                m_transaction->objectsToDestroy.push_back(object);
+        }
+        return true;
+    }
+
     bool LogicEngineImpl::isLinked(const LogicNode& logicNode) const
     {
         return m_apiObjects->getLogicNodeDependencies().isLinked(logicNode.m_impl);
     }
 
+    bool LogicEngineImpl::suspendNodes(const std::vector<LogicNode*>& nodes)
+    {
+        m_errors.clear();
+        const std::optional<NodeVector> nodeImpls = getNodeImpls(nodes, "suspend nodes");
+        if (!nodeImpls)
+            return false;
+
+        for (LogicNodeImpl* node : *nodeImpls)
+            node->setSuspended(true);
+
+        return true;
+    }
+
+    bool LogicEngineImpl::resumeNodes(const std::vector<LogicNode*>& nodes)
+    {
+        m_errors.clear();
+        const std::optional<NodeVector> nodeImpls = getNodeImpls(nodes, "resume nodes");
+        if (!nodeImpls)
+            return false;
+
+        for (LogicNodeImpl* node : *nodeImpls)
+        {
+            if (!node->isSuspended())
+                continue;
+
+            node->setSuspended(false);
+            // values propagated over links while suspended were deferred, take over latest values of link sources
+            Property* inputs = node->getInputs();
+            if (inputs != nullptr && ApplyDeferredLinksRecursive(*inputs->m_impl))
+                node->setDirty(true);
+        }
+
+        return true;
+    }
+
+    bool LogicEngineImpl::isSuspended(const LogicNode& logicNode) const
+    {
+        return logicNode.m_impl.isSuspended();
+    }
+
+    std::optional<NodeVector> LogicEngineImpl::getNodeImpls(const std::vector<LogicNode*>& nodes, std::string_view operation)
+    {
+        NodeVector nodeImpls;
+        nodeImpls.reserve(nodes.size());
+        const auto& reverseImplMapping = m_apiObjects->getReverseImplMapping();
+        for (LogicNode* node : nodes)
+        {
+            if (node == nullptr || reverseImplMapping.count(&node->m_impl) == 0u)
+            {
+                m_errors.add(fmt::format("Failed to {}: one or more of the provided nodes was not found in this logic instance.", operation), nullptr, EErrorType::IllegalArgument);
+                return std::nullopt;
+            }
+            nodeImpls.push_back(&node->m_impl);
+        }
+
+        return nodeImpls;
+    }
+
+    bool LogicEngineImpl::ApplyDeferredLinksRecursive(PropertyImpl& input)
+    {
+        bool valueChanged = false;
+
+        const auto childCount = input.getChildCount();
+        for (size_t i = 0; i < childCount; ++i)
+        {
+            PropertyImpl& child = *input.getChild(i)->m_impl;
+
+            if (TypeUtils::CanHaveChildren(child.getType()))
+            {
+                valueChanged = ApplyDeferredLinksRecursive(child) || valueChanged;
+            }
+            else
+            {
+                const PropertyImpl* linkSource = child.getIncomingLink().property;
+                if (linkSource != nullptr && child.getValue() != linkSource->getValue())
+                {
+                    child.setValue(linkSource->getValue());
+                    valueChanged = true;
+                }
+            }
+        }
+
+        return valueChanged;
+    }
+
     EFeatureLevel LogicEngineImpl::getFeatureLevel() const
     {
         return m_featureLevel;
@@ -397,6 +589,15 @@ namespace rlogic::internal
                 for (const auto& outLink : outgoingLinks)
                 {
                     PropertyImpl* linkedProp = outLink.property;
+                    if (linkedProp->getLogicNode().isSuspended())
+                    {
+                        // value is taken over (and node made dirty if it differs) when node is resumed,
+                        // only animation inputs make node dirty on every activation regardless of value
+                        if (linkedProp->getPropertySemantics() == EPropertySemantics::AnimationInput)
+                            linkedProp->getLogicNode().setDirty(true);
+                        continue;
+                    }
+
                     const bool valueChanged = linkedProp->setValue(child.getValue());
                     if (valueChanged || linkedProp->getPropertySemantics() == EPropertySemantics::AnimationInput)
                     {
@@ -413,7 +614,165 @@ namespace rlogic::internal
     bool LogicEngineImpl::update()
     {
         m_errors.clear();
+        if (!checkNoOpenTransaction("update"))
+            return false;
+
+        return updateInternal(nullptr);
+    }
+
+    bool LogicEngineImpl::updateNodes(const std::vector<LogicNode*>& rootNodes)
+    {
+        m_errors.clear();
+        if (!checkNoOpenTransaction("update nodes"))
+            return false;
+
+        const std::optional<NodeVector> rootNodeImpls = getNodeImpls(rootNodes, "update nodes");
+        if (!rootNodeImpls)
+            return false;
+
+        return updateInternal(&*rootNodeImpls);
+    }
+
+    bool LogicEngineImpl::updateInternal(const NodeVector* rootNodes)
+    {
+        const NodeVector* sortedNodes = startUpdate();
+        if (sortedNodes == nullptr)
+            return false;
+
+        // subgraph update uses plan of the downstream nodes only, it is not cached as roots can differ for every call
+        std::optional<ExecutionPlan> subgraphExecutionPlan;
+        if (rootNodes != nullptr)
+            subgraphExecutionPlan = CreateExecutionPlan(m_apiObjects->getLogicNodeDependencies().getDownstreamNodes(*rootNodes));
+        else
+            m_budgetedUpdate.reset();
+
+        if (m_updateReportEnabled)
+            m_updateReport.sectionFinished(UpdateReport::ETimingSection::TopologySort);
+
+        const ExecutionPlan& executionPlan = (subgraphExecutionPlan ? *subgraphExecutionPlan : getExecutionPlan(*sortedNodes));
+
+        // force dirty all timer nodes, anchor points and skinbindings
+        SetNodesToBeAlwaysUpdatedDirty(executionPlan.alwaysDirtyNodes);
+
+        // Ramses scene could be modified since last update
+        m_apiObjects->getCameraViewProjectionCache().invalidate();
+
+        bool success = updateSortedNodes(executionPlan.nodes);
+
+        // update skin bindings only if updating the other nodes succeeded
+        if (success)
+            success = updateSkinBindings(executionPlan.skinBindings);
+
+        finishUpdate(executionPlan.nodes.size() + executionPlan.skinBindings.size());
+
+        return success;
+    }
+
+    bool LogicEngineImpl::updateWithBudget(std::chrono::microseconds budget, bool applyBindingsWhenSettled)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + budget;
+
+        m_errors.clear();
+        if (!checkNoOpenTransaction("update"))
+            return false;
+
+        const NodeVector* sortedNodes = startUpdate();
+        if (sortedNodes == nullptr)
+            return false;
+
+        const ExecutionPlan& executionPlan = getExecutionPlan(*sortedNodes);
+        // (re)start update if nodes or their order changed in the meantime, nodes updated already are not dirty anymore
+        if (!m_budgetedUpdate || m_budgetedUpdate->topologyCacheVersion != executionPlan.topologyCacheVersion || m_budgetedUpdate->applyBindingsWhenSettled != applyBindingsWhenSettled)
+            m_budgetedUpdate = createBudgetedUpdate(executionPlan, applyBindingsWhenSettled);
+
+        if (m_updateReportEnabled)
+            m_updateReport.sectionFinished(UpdateReport::ETimingSection::TopologySort);
+
+        BudgetedUpdate& budgetedUpdate = *m_budgetedUpdate;
+        if (budgetedUpdate.nextNode == 0u)
+            SetNodesToBeAlwaysUpdatedDirty(executionPlan.alwaysDirtyNodes);
+
+        // Ramses scene could be modified since last update
+        m_apiObjects->getCameraViewProjectionCache().invalidate();
+
+        // at least one node is processed in every call so that the update progresses also with too small budget
+        const bool hasAnchorPoints = !m_apiObjects->getApiObjectContainer<AnchorPoint>().empty();
+        bool success = true;
+        size_t processedNodes = 0u;
+        while (success && budgetedUpdate.nextNode < budgetedUpdate.slicedNodes.size())
+        {
+            success = updateNodeIfDirty(*budgetedUpdate.slicedNodes[budgetedUpdate.nextNode], hasAnchorPoints);
+            ++budgetedUpdate.nextNode;
+            ++processedNodes;
+            if (std::chrono::steady_clock::now() >= deadline)
+                break;
+        }
+
+        if (success && budgetedUpdate.nextNode == budgetedUpdate.slicedNodes.size())
+        {
+            // nodes could be made dirty (e.g. by setting their inputs) after they were updated by one of previous calls,
+            // then update continues from first of them and deferred nodes wait until all other nodes are up to date,
+            // once restarts are exhausted update is finished and the dirty nodes are left to the next update
+            const auto firstDirtyNode = std::find_if(budgetedUpdate.slicedNodes.cbegin(), budgetedUpdate.slicedNodes.cend(),
+                [](const LogicNodeImpl* node) { return node->isDirty() && !node->isSuspended(); });
+            if (m_nodeDirtyMechanismEnabled && firstDirtyNode != budgetedUpdate.slicedNodes.cend() && budgetedUpdate.restarts < MaxBudgetedUpdateRestarts)
+            {
+                budgetedUpdate.nextNode = static_cast<size_t>(std::distance(budgetedUpdate.slicedNodes.cbegin(), firstDirtyNode));
+                ++budgetedUpdate.restarts;
+            }
+            else
+            {
+                // nodes deferred until all other nodes are updated are updated at once regardless of budget
+                success = updateSortedNodes(budgetedUpdate.deferredNodes) && updateSkinBindings(executionPlan.skinBindings);
+                processedNodes += budgetedUpdate.deferredNodes.size() + executionPlan.skinBindings.size();
+                m_budgetedUpdate.reset();
+            }
+        }
+
+        // failed node stays dirty, next call starts over
+        if (!success)
+            m_budgetedUpdate.reset();
+
+        finishUpdate(processedNodes);
 
+        return success;
+    }
+
+    bool LogicEngineImpl::isUpdateSettled() const
+    {
+        return !m_budgetedUpdate;
+    }
+
+    LogicEngineImpl::BudgetedUpdate LogicEngineImpl::createBudgetedUpdate(const ExecutionPlan& executionPlan, bool applyBindingsWhenSettled) const
+    {
+        BudgetedUpdate budgetedUpdate;
+        budgetedUpdate.topologyCacheVersion = executionPlan.topologyCacheVersion;
+        budgetedUpdate.applyBindingsWhenSettled = applyBindingsWhenSettled;
+
+        if (!applyBindingsWhenSettled || executionPlan.ramsesBindings.empty())
+        {
+            budgetedUpdate.slicedNodes = executionPlan.nodes;
+            return budgetedUpdate;
+        }
+
+        // bindings and all nodes depending on them (e.g. anchor points reading Ramses states) are deferred,
+        // none of the other nodes depends on them so they can be updated first
+        NodeVector& deferredNodes = budgetedUpdate.deferredNodes;
+        deferredNodes = m_apiObjects->getLogicNodeDependencies().getDownstreamNodes(executionPlan.ramsesBindings);
+        // skin bindings are updated after all other nodes anyway
+        deferredNodes.erase(std::remove_if(deferredNodes.begin(), deferredNodes.end(),
+            [](const LogicNodeImpl* node) { return node->getObjectType() == ELogicObjectType::SkinBinding; }), deferredNodes.end());
+
+        const NodeSet deferredNodesSet{ deferredNodes.cbegin(), deferredNodes.cend() };
+        budgetedUpdate.slicedNodes.reserve(executionPlan.nodes.size() - deferredNodes.size());
+        std::copy_if(executionPlan.nodes.cbegin(), executionPlan.nodes.cend(), std::back_inserter(budgetedUpdate.slicedNodes),
+            [&deferredNodesSet](LogicNodeImpl* node) { return deferredNodesSet.count(node) == 0u; });
+
+        return budgetedUpdate;
+    }
+
+    const NodeVector* LogicEngineImpl::startUpdate()
+    {
         if (m_statisticsEnabled || m_updateReportEnabled)
         {
             m_updateReport.clear();
@@ -428,60 +787,97 @@ namespace rlogic::internal
         if (!sortedNodes)
         {
             m_errors.add("Failed to sort logic nodes based on links between their properties. Create a loop-free link graph before calling update()!", nullptr, EErrorType::ContentStateError);
-            return false;
+            return nullptr;
         }
 
-        if (m_updateReportEnabled)
-            m_updateReport.sectionFinished(UpdateReport::ETimingSection::TopologySort);
-
-        // force dirty all timer nodes, anchor points and skinbindings
-        setNodeToBeAlwaysUpdatedDirty();
-
-        bool success = updateNodes(*sortedNodes);
-
-        // update skin bindings only if updating the other nodes succeeded
-        if (success)
-            success = updateSkinBindings();
+        return &*sortedNodes;
+    }
 
+    void LogicEngineImpl::finishUpdate(size_t nodeCount)
+    {
         if (m_statisticsEnabled || m_updateReportEnabled)
         {
             m_updateReport.sectionFinished(UpdateReport::ETimingSection::TotalUpdate);
-            m_statistics.collect(m_updateReport, sortedNodes->size());
+            m_statistics.collect(m_updateReport, nodeCount);
             if (m_statistics.checkUpdateFrameFinished())
                 m_statistics.calculateAndLog();
         }
+    }
 
-        return success;
+    bool LogicEngineImpl::updateSkinBindings(const NodeVector& skinBindings)
+    {
+        if (skinBindings.empty())
+            return true;
+
+        m_skinBindingsToUpdate.clear();
+        for (LogicNodeImpl* skinBinding : skinBindings)
+        {
+            if (skinBinding->isSuspended())
+            {
+                if (m_updateReportEnabled)
+                    m_updateReport.nodeSkippedExecution(*skinBinding);
+                continue;
+            }
+            m_skinBindingsToUpdate.push_back(skinBinding);
+        }
+        if (m_skinBindingsToUpdate.empty())
+            return true;
+
+        // world matrices of joints shared by multiple skins are retrieved only once
+        LogicNodeImpl* failedSkinBinding = m_apiObjects->getSkinningBatch().fetchJointWorldMatrices(m_skinBindingsToUpdate);
+        if (failedSkinBinding != nullptr)
+        {
+            m_errors.add("Failed to retrieve model matrix from Ramses node!", &failedSkinBinding->getLogicObject(), EErrorType::RuntimeError);
+            return false;
+        }
+
+        for (LogicNodeImpl* skinBinding : m_skinBindingsToUpdate)
+        {
+            if (!updateNode(*skinBinding))
+                return false;
+        }
+        return true;
     }
 
-    bool LogicEngineImpl::updateSkinBindings()
+    bool LogicEngineImpl::updateSortedNodes(const NodeVector& sortedNodes)
     {
-        for (SkinBinding* skinBinding : m_apiObjects->getApiObjectContainer<SkinBinding>()) {
-            if (!updateNode(skinBinding->m_skinBinding)) {
+        const bool hasAnchorPoints = !m_apiObjects->getApiObjectContainer<AnchorPoint>().empty();
+        for (LogicNodeImpl* node : sortedNodes)
+        {
+            if (!updateNodeIfDirty(*node, hasAnchorPoints))
                 return false;
-            }
         }
+
         return true;
     }
 
-    bool LogicEngineImpl::updateNodes(const NodeVector& sortedNodes)
+    bool LogicEngineImpl::updateNodeIfDirty(LogicNodeImpl& node, bool hasAnchorPoints)
     {
-        for (LogicNodeImpl* nodeIter : sortedNodes)
+        // suspended node keeps its dirtiness until it is resumed
+        if (node.isSuspended())
         {
-            LogicNodeImpl& node = *nodeIter;
+            if (m_updateReportEnabled)
+                m_updateReport.nodeSkippedExecution(node);
+            return true;
+        }
 
-            // skip also processing of SkinBindings, since they will be processed after updating everything else
-            if (!node.isDirty() || dynamic_cast<SkinBindingImpl*>(&node))
-            {
-                if (m_updateReportEnabled)
-                    m_updateReport.nodeSkippedExecution(node);
+        if (!node.isDirty())
+        {
+            if (m_updateReportEnabled)
+                m_updateReport.nodeSkippedExecution(node);
 
-                if(m_nodeDirtyMechanismEnabled)
-                    continue;
-            }
+            if(m_nodeDirtyMechanismEnabled)
+                return true;
+        }
 
-            if (!updateNode(node))
-                return false;
+        if (!updateNode(node))
+            return false;
+
+        // node or camera binding might have modified transformation or parameters of a camera used by anchor points
+        if (hasAnchorPoints &&
+            (node.getObjectType() == ELogicObjectType::RamsesNodeBinding || node.getObjectType() == ELogicObjectType::RamsesCameraBinding))
+        {
+            m_apiObjects->getCameraViewProjectionCache().invalidate();
         }
 
         return true;
@@ -517,17 +913,59 @@ namespace rlogic::internal
         return true;
     }
 
-    void LogicEngineImpl::setNodeToBeAlwaysUpdatedDirty()
+    const LogicEngineImpl::ExecutionPlan& LogicEngineImpl::getExecutionPlan(const NodeVector& sortedNodes)
     {
-        // force timer nodes dirty so they can update their ticker
-        for (TimerNode* timerNode : m_apiObjects->getApiObjectContainer<TimerNode>())
-            timerNode->m_impl.setDirty(true);
-        // force anchor points dirty because they depend on set of ramses states which cannot be monitored
-        for (AnchorPoint* anchorPoint : m_apiObjects->getApiObjectContainer<AnchorPoint>())
-            anchorPoint->m_impl.setDirty(true);
-        // force skinbindings dirty because they depend on set of ramses states which cannot be monitored
-        for (SkinBinding* skinBinding : m_apiObjects->getApiObjectContainer<SkinBinding>())
-            skinBinding->m_impl.setDirty(true);
+        const uint64_t topologyCacheVersion = m_apiObjects->getLogicNodeDependencies().getTopologyCacheVersion();
+        if (m_executionPlan && m_executionPlan->topologyCacheVersion == topologyCacheVersion)
+            return *m_executionPlan;
+
+        m_executionPlan = CreateExecutionPlan(sortedNodes);
+        m_executionPlan->topologyCacheVersion = topologyCacheVersion;
+
+        return *m_executionPlan;
+    }
+
+    LogicEngineImpl::ExecutionPlan LogicEngineImpl::CreateExecutionPlan(const NodeVector& sortedNodes)
+    {
+        ExecutionPlan executionPlan;
+        executionPlan.nodes.reserve(sortedNodes.size());
+        for (LogicNodeImpl* node : sortedNodes)
+        {
+            switch (node->getObjectType())
+            {
+            case ELogicObjectType::SkinBinding:
+                // skin bindings are processed after updating everything else
+                // and forced dirty because they depend on set of ramses states which cannot be monitored
+                executionPlan.skinBindings.push_back(node);
+                executionPlan.alwaysDirtyNodes.push_back(node);
+                continue;
+            case ELogicObjectType::RamsesNodeBinding:
+            case ELogicObjectType::RamsesAppearanceBinding:
+            case ELogicObjectType::RamsesCameraBinding:
+            case ELogicObjectType::RamsesRenderPassBinding:
+            case ELogicObjectType::RamsesRenderGroupBinding:
+            case ELogicObjectType::RamsesMeshNodeBinding:
+                executionPlan.ramsesBindings.push_back(node);
+                break;
+            case ELogicObjectType::TimerNode:
+            case ELogicObjectType::AnchorPoint:
+                // timer nodes are forced dirty so they can update their ticker, anchor points
+                // because they depend on set of ramses states which cannot be monitored
+                executionPlan.alwaysDirtyNodes.push_back(node);
+                break;
+            default:
+                break;
+            }
+            executionPlan.nodes.push_back(node);
+        }
+
+        return executionPlan;
+    }
+
+    void LogicEngineImpl::SetNodesToBeAlwaysUpdatedDirty(const NodeVector& alwaysDirtyNodes)
+    {
+        for (LogicNodeImpl* node : alwaysDirtyNodes)
+            node->setDirty(true);
     }
 
     const std::vector<ErrorData>& LogicEngineImpl::getErrors() const
@@ -559,8 +997,43 @@ namespace rlogic::internal
         return loadFromByteData(rawBuffer, bufferSize, scene, enableMemoryVerification, fmt::format("data buffer '{}' (size: {})", rawBuffer, bufferSize));
     }
 
+    std::optional<uint64_t> LogicEngineImpl::loadPackageFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* scene, bool enableMemoryVerification)
+    {
+        std::optional<uint64_t> packageId;
+        if (!loadFromByteData(rawBuffer, bufferSize, scene, enableMemoryVerification, fmt::format("data buffer '{}' (size: {})", rawBuffer, bufferSize), &packageId))
+            return std::nullopt;
+        return packageId;
+    }
+
     bool LogicEngineImpl::loadFromFile(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification)
     {
+        return loadFromFileData(filename, scene, enableMemoryVerification, nullptr);
+    }
+
+    std::optional<uint64_t> LogicEngineImpl::loadPackageFromFile(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification)
+    {
+        std::optional<uint64_t> packageId;
+        if (!loadFromFileData(filename, scene, enableMemoryVerification, &packageId))
+            return std::nullopt;
+        return packageId;
+    }
+
+    bool LogicEngineImpl::unloadPackage(uint64_t packageId)
+    {
+        m_errors.clear();
+        if (!checkNoOpenTransaction("unload package"))
+            return false;
+        return m_apiObjects->unloadPackage(packageId, m_errors);
+    }
+
+    bool LogicEngineImpl::loadFromFileData(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification, std::optional<uint64_t>* loadedPackageId)
+    {
+        // deserialize directly from mapped file if possible to avoid copying whole file to memory first
+        const std::unique_ptr<MemoryMappedFile> mappedFile = MemoryMappedFile::Map(std::string(filename));
+        if (mappedFile)
+            return loadFromByteData(mappedFile->getData(), mappedFile->getSize(), scene, enableMemoryVerification, fmt::format("file '{}' (size: {})", filename, mappedFile->getSize()), loadedPackageId);
+
+        // fallback to reading file for cases where mapping is not possible, also reports errors for invalid files
         std::optional<std::vector<char>> maybeBytesFromFile = FileUtils::LoadBinary(std::string(filename));
         if (!maybeBytesFromFile)
         {
@@ -569,7 +1042,7 @@ namespace rlogic::internal
         }
 
         const size_t fileSize = (*maybeBytesFromFile).size();
-        return loadFromByteData((*maybeBytesFromFile).data(), fileSize, scene, enableMemoryVerification, fmt::format("file '{}' (size: {})", filename, fileSize));
+        return loadFromByteData((*maybeBytesFromFile).data(), fileSize, scene, enableMemoryVerification, fmt::format("file '{}' (size: {})", filename, fileSize), loadedPackageId);
     }
 
     bool LogicEngineImpl::loadFromFileDescriptor(int fd, size_t offset, size_t size, ramses::Scene* scene, bool enableMemoryVerification)
@@ -584,6 +1057,12 @@ namespace rlogic::internal
             m_errors.add("Failed to load from file descriptor: size may not be 0", nullptr, EErrorType::BinaryDataAccessError);
             return false;
         }
+        // deserialize directly from mapped region if possible to avoid copying it to memory first
+        const std::unique_ptr<MemoryMappedFile> mappedRegion = MemoryMappedFile::MapRegion(fd, offset, size);
+        if (mappedRegion)
+            return loadFromByteData(mappedRegion->getData(), size, scene, enableMemoryVerification, fmt::format("fd: {} (offset: {}, size: {})", fd, offset, size));
+
+        // fallback to reading for descriptors which cannot be mapped (e.g. pipes), also reports errors for invalid regions
         std::optional<std::vector<char>> maybeBytesFromFile = FileUtils::LoadBinary(fd, offset, size);
         if (!maybeBytesFromFile)
         {
@@ -649,9 +1128,12 @@ namespace rlogic::internal
         return m_featureLevel == EFeatureLevel_01 ? rlogic_serialization::LogicEngineIdentifier() : fileIdFeatureLevel02orHigher;
     }
 
-    bool LogicEngineImpl::loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription)
+    bool LogicEngineImpl::loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription,
+        std::optional<uint64_t>* loadedPackageId)
     {
         m_errors.clear();
+        if (!checkNoOpenTransaction("load content"))
+            return false;
 
         if (byteSize < 8)
         {
@@ -667,16 +1149,41 @@ namespace rlogic::internal
             return false;
         }
 
+        // decompressed data must stay alive until all objects are deserialized
+        std::optional<std::vector<uint8_t>> decompressedData;
+        if (CompressedContainer::IsCompressed(byteData, byteSize))
+        {
+            decompressedData = CompressedContainer::Decompress(byteData, byteSize);
+            if (!decompressedData)
+            {
+                m_errors.add(fmt::format("{} contains corrupted compressed data!", dataSourceDescription), nullptr, EErrorType::BinaryDataAccessError);
+                return false;
+            }
+            byteData = decompressedData->data();
+            byteSize = decompressedData->size();
+        }
+
         auto* uint8Data(static_cast<const uint8_t*>(byteData));
         if (enableMemoryVerification)
         {
-            flatbuffers::Verifier bufferVerifier(uint8Data, byteSize);
-            const bool bufferOK = bufferVerifier.VerifyBuffer<rlogic_serialization::LogicEngine>(getFileIdentifierMatchingFeatureLevel());
+            // hashing is much cheaper than verification, content which already passed verification is not verified again
+            std::optional<VerifiedContentCache::ContentId> contentId;
+            if (m_verifiedContentCache)
+                contentId = m_verifiedContentCache->computeContentId(uint8Data, byteSize);
 
-            if (!bufferOK)
+            if (!contentId || !m_verifiedContentCache->contains(*contentId))
             {
-                m_errors.add(fmt::format("{} contains corrupted data!", dataSourceDescription), nullptr, EErrorType::BinaryDataAccessError);
-                return false;
+                flatbuffers::Verifier bufferVerifier(uint8Data, byteSize);
+                const bool bufferOK = bufferVerifier.VerifyBuffer<rlogic_serialization::LogicEngine>(getFileIdentifierMatchingFeatureLevel());
+
+                if (!bufferOK)
+                {
+                    m_errors.add(fmt::format("{} contains corrupted data!", dataSourceDescription), nullptr, EErrorType::BinaryDataAccessError);
+                    return false;
+                }
+
+                if (contentId)
+                    m_verifiedContentCache->insert(*contentId);
             }
         }
 
@@ -724,7 +1231,14 @@ namespace rlogic::internal
         if (scene != nullptr)
             ramsesResolver = std::make_unique<RamsesObjectResolver>(m_errors, *scene);
 
-        std::unique_ptr<ApiObjects> deserializedObjects = ApiObjects::Deserialize(*logicEngine->apiObjects(), ramsesResolver.get(), dataSourceDescription, m_errors, m_featureLevel);
+        if (loadedPackageId)
+        {
+            // loaded objects are added to existing ones, which stay untouched if loading fails
+            *loadedPackageId = m_apiObjects->deserializePackage(*logicEngine->apiObjects(), ramsesResolver.get(), dataSourceDescription, m_errors, m_deserializationOptions);
+            return loadedPackageId->has_value();
+        }
+
+        std::unique_ptr<ApiObjects> deserializedObjects = ApiObjects::Deserialize(*logicEngine->apiObjects(), ramsesResolver.get(), dataSourceDescription, m_errors, m_featureLevel, m_deserializationOptions);
 
         if (!deserializedObjects)
         {
@@ -733,6 +1247,8 @@ namespace rlogic::internal
 
         // No errors -> move data into member
         m_apiObjects = std::move(deserializedObjects);
+        m_executionPlan.reset();
+        m_budgetedUpdate.reset();
 
         return true;
     }
@@ -751,6 +1267,19 @@ namespace rlogic::internal
 
     bool LogicEngineImpl::GetFeatureLevelFromBuffer(std::string_view logname, const void* buffer, size_t bufferSize, EFeatureLevel& detectedFeatureLevel)
     {
+        std::optional<std::vector<uint8_t>> decompressedData;
+        if (CompressedContainer::IsCompressed(buffer, bufferSize))
+        {
+            decompressedData = CompressedContainer::Decompress(buffer, bufferSize);
+            if (!decompressedData)
+            {
+                LOG_ERROR("'{}' contains corrupted compressed data", logname);
+                return false;
+            }
+            buffer = decompressedData->data();
+            bufferSize = decompressedData->size();
+        }
+
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) Safe here, not worth transforming whole vector
         flatbuffers::Verifier bufferVerifier(reinterpret_cast<const uint8_t*>(buffer), bufferSize);
         if (!bufferVerifier.VerifyBuffer<rlogic_serialization::LogicEngine>())
@@ -780,7 +1309,66 @@ namespace rlogic::internal
     bool LogicEngineImpl::saveToFile(std::string_view filename, const SaveFileConfigImpl& config)
     {
         m_errors.clear();
+        if (!checkNoOpenTransaction("save content"))
+            return false;
+
+        flatbuffers::FlatBufferBuilder builder{ getSerializationBufferSizeHint() };
+        if (!serialize(builder, config))
+            return false;
+
+        bool saved = false;
+        if (config.getCompression() == EFileCompression::LZ4)
+        {
+            const std::vector<uint8_t> compressedData = CompressedContainer::Compress(builder.GetBufferPointer(), builder.GetSize());
+            saved = FileUtils::SaveBinary(std::string(filename), compressedData.data(), compressedData.size());
+        }
+        else
+        {
+            saved = FileUtils::SaveBinary(std::string(filename), builder.GetBufferPointer(), builder.GetSize());
+        }
+
+        if (!saved)
+        {
+            m_errors.add(fmt::format("Failed to save content to path '{}'!", filename), nullptr, EErrorType::BinaryDataAccessError);
+            return false;
+        }
+
+        LOG_INFO("Saved logic engine to file: '{}'.", filename);
+
+        return true;
+    }
+
+    bool LogicEngineImpl::saveToBuffer(std::vector<uint8_t>& buffer, const SaveFileConfigImpl& config)
+    {
+        m_errors.clear();
+        if (!checkNoOpenTransaction("save content"))
+            return false;
 
+        flatbuffers::FlatBufferBuilder builder{ getSerializationBufferSizeHint() };
+        if (!serialize(builder, config))
+            return false;
+
+        if (config.getCompression() == EFileCompression::LZ4)
+        {
+            buffer = CompressedContainer::Compress(builder.GetBufferPointer(), builder.GetSize());
+        }
+        else
+        {
+            // keeps capacity of the caller's buffer, reallocates only if it is too small
+            buffer.assign(builder.GetBufferPointer(), builder.GetBufferPointer() + builder.GetSize()); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) end of serialized data
+        }
+
+        return true;
+    }
+
+    size_t LogicEngineImpl::getSerializationBufferSizeHint() const
+    {
+        // the builder grows by doubling and copying its content, sizing it by the previous save avoids that for repeated saves
+        return std::max(m_lastSerializedSize + m_lastSerializedSize / 8u, MinSerializationBufferSize);
+    }
+
+    bool LogicEngineImpl::serialize(flatbuffers::FlatBufferBuilder& builder, const SaveFileConfigImpl& config)
+    {
         if (!m_apiObjects->checkBindingsReferToSameRamsesScene(m_errors))
         {
             m_errors.add("Can't save a logic engine to file while it has references to more than one Ramses scene!", nullptr, EErrorType::ContentStateError);
@@ -828,7 +1416,6 @@ namespace rlogic::internal
             return false;
         }
 
-        flatbuffers::FlatBufferBuilder builder;
         ramses::RamsesVersion ramsesVersion = ramses::GetRamsesVersion();
 
         const auto ramsesVersionOffset = rlogic_serialization::CreateVersion(builder,
@@ -866,14 +1453,7 @@ namespace rlogic::internal
             m_featureLevel);
 
         builder.Finish(logicEngine, getFileIdentifierMatchingFeatureLevel());
-
-        if (!FileUtils::SaveBinary(std::string(filename), builder.GetBufferPointer(), builder.GetSize()))
-        {
-            m_errors.add(fmt::format("Failed to save content to path '{}'!", filename), nullptr, EErrorType::BinaryDataAccessError);
-            return false;
-        }
-
-        LOG_INFO("Saved logic engine to file: '{}'.", filename);
+        m_lastSerializedSize = builder.GetSize();
 
         return true;
     }
@@ -895,21 +1475,148 @@ namespace rlogic::internal
     {
         m_errors.clear();
 
-        return m_apiObjects->getLogicNodeDependencies().link(*sourceProperty.m_impl, *targetProperty.m_impl, false, m_errors);
+        const bool success = m_apiObjects->getLogicNodeDependencies().link(*sourceProperty.m_impl, *targetProperty.m_impl, false, m_errors);
+        if (m_transaction)
+        {
+            m_transaction->failed |= !success;
+            if (success)
+                m_transaction->linkEdits.push_back({ sourceProperty.m_impl.get(), targetProperty.m_impl.get(), false, true });
+        }
+        return success;
     }
 
     bool LogicEngineImpl::linkWeak(const Property& sourceProperty, const Property& targetProperty)
     {
         m_errors.clear();
 
-        return m_apiObjects->getLogicNodeDependencies().link(*sourceProperty.m_impl, *targetProperty.m_impl, true, m_errors);
+        const bool success = m_apiObjects->getLogicNodeDependencies().link(*sourceProperty.m_impl, *targetProperty.m_impl, true, m_errors);
+        if (m_transaction)
+        {
+            m_transaction->failed |= !success;
+            if (success)
+                m_transaction->linkEdits.push_back({ sourceProperty.m_impl.get(), targetProperty.m_impl.get(), true, true });
+        }
+        return success;
     }
 
     bool LogicEngineImpl::unlink(const Property& sourceProperty, const Property& targetProperty)
     {
         m_errors.clear();
 
-        return m_apiObjects->getLogicNodeDependencies().unlink(*sourceProperty.m_impl, *targetProperty.m_impl, m_errors);
+        const bool isWeakLink = targetProperty.m_impl->getIncomingLink().isWeakLink;
+        const bool success = m_apiObjects->getLogicNodeDependencies().unlink(*sourceProperty.m_impl, *targetProperty.m_impl, m_errors);
+        if (m_transaction)
+        {
+            m_transaction->failed |= !success;
+            if (success)
+                m_transaction->linkEdits.push_back({ sourceProperty.m_impl.get(), targetProperty.m_impl.get(), isWeakLink, false });
+        }
+        return success;
+    }
+
+    bool LogicEngineImpl::beginTransaction()
+    {
+        m_errors.clear();
+        if (m_transaction)
+        {
+            m_errors.add("Cannot begin transaction, there is already an open transaction!", nullptr, EErrorType::ContentStateError);
+            return false;
+        }
+
+        m_transaction.emplace();
+        m_transaction->createdObjectsBegin = m_apiObjects->getApiObjectContainer<LogicObject>().size();
+        return true;
+    }
+
+    bool LogicEngineImpl::commitTransaction()
+    {
+        m_errors.clear();
+        if (!m_transaction)
+        {
+            m_errors.add("Cannot commit transaction, there is no open transaction!", nullptr, EErrorType::ContentStateError);
+            return false;
+        }
+
+        if (m_transaction->failed)
+        {
+            revertTransaction();
+            m_errors.add("Transaction was rolled back because some of its operations failed!", nullptr, EErrorType::ContentStateError);
+            return false;
+        }
+
+        // nodes to be destroyed are left out of the new order, so the graph is sorted exactly once per transaction
+        NodeSet nodesToDestroy;
+        for (LogicObject* object : m_transaction->objectsToDestroy)
+        {
+            if (auto* node = object->as<LogicNode>())
+                nodesToDestroy.insert(&node->m_impl);
+        }
+
+        LogicNodeDependencies& dependencies = m_apiObjects->getLogicNodeDependencies();
+        std::optional<NodeVector> sortedNodes = dependencies.sortNodesIgnoring(nodesToDestroy);
+        if (!sortedNodes)
+        {
+            revertTransaction();
+            m_errors.add("Transaction was rolled back because it would result in a link graph with a loop!", nullptr, EErrorType::ContentStateError);
+            return false;
+        }
+
+        if (!m_transaction->objectsToDestroy.empty() && !m_apiObjects->destroy(m_transaction->objectsToDestroy, m_errors))
+        {
+            revertTransaction();
+            m_errors.add("Transaction was rolled back because some of its objects could not be destroyed!", nullptr, EErrorType::ContentStateError);
+            return false;
+        }
+
+        dependencies.setTopologicallySortedNodes(std::move(*sortedNodes));
+        m_transaction.reset();
+        return true;
+    }
+
+    bool LogicEngineImpl::rollbackTransaction()
+    {
+        m_errors.clear();
+        if (!m_transaction)
+        {
+            m_errors.add("Cannot roll back transaction, there is no open transaction!", nullptr, EErrorType::ContentStateError);
+            return false;
+        }
+
+        revertTransaction();
+        return true;
+    }
+
+    void LogicEngineImpl::revertTransaction()
+    {
+        assert(m_transaction);
+        // reverting edits of a valid state cannot fail, errors are collected separately so they do not mix with the reported ones
+        ErrorReporting revertErrors;
+        LogicNodeDependencies& dependencies = m_apiObjects->getLogicNodeDependencies();
+        for (auto it = m_transaction->linkEdits.crbegin(); it != m_transaction->linkEdits.crend(); ++it)
+        {
+            if (it->linked)
+                dependencies.unlink(*it->sourceProperty, *it->targetProperty, revertErrors);
+            else
+                dependencies.link(*it->sourceProperty, *it->targetProperty, it->isWeakLink, revertErrors);
+        }
+
+        const auto& logicObjects = m_apiObjects->getApiObjectContainer<LogicObject>();
+        assert(m_transaction->createdObjectsBegin <= logicObjects.size());
+        const std::vector<LogicObject*> createdObjects(logicObjects.cbegin() + static_cast<std::ptrdiff_t>(m_transaction->createdObjectsBegin), logicObjects.cend());
+        if (!createdObjects.empty())
+            m_apiObjects->destroy(createdObjects, revertErrors);
+
+        assert(revertErrors.getErrors().empty());
+        m_transaction.reset();
+    }
+
+    bool LogicEngineImpl::checkNoOpenTransaction(std::string_view operation)
+    {
+        if (!m_transaction)
+            return true;
+
+        m_errors.add(fmt::format("Cannot {} while a transaction is open, commit or roll back the transaction first!", operation), nullptr, EErrorType::ContentStateError);
+        return false;
     }
 
     ApiObjects& LogicEngineImpl::getApiObjects()
@@ -922,6 +1629,69 @@ namespace rlogic::internal
         m_nodeDirtyMechanismEnabled = false;
     }
 
+    void LogicEngineImpl::enableLazyLuaScriptLoading(bool enable)
+    {
+        m_deserializationOptions.lazyLuaScriptLoading = enable;
+    }
+
+    void LogicEngineImpl::enableParallelLoading(bool enable)
+    {
+        m_deserializationOptions.parallelLoading = enable;
+    }
+
+    void LogicEngineImpl::enableVerificationCache(bool enable, const std::optional<std::array<uint8_t, 16>>& key)
+    {
+        if (!enable)
+        {
+            m_verifiedContentCache.reset();
+        }
+        else if (key)
+        {
+            // key bytes are interpreted as two little endian numbers, same as in SipHash reference implementation
+            VerifiedContentCache::Key cacheKey{ 0u, 0u };
+            for (size_t i = 0u; i < key->size(); ++i)
+                cacheKey[i / 8u] |= static_cast<uint64_t>((*key)[i]) << (8u * (i % 8u));
+
+            if (!m_verifiedContentCache || !m_verifiedContentCache->hasKey(cacheKey))
+                m_verifiedContentCache = std::make_unique<VerifiedContentCache>(cacheKey);
+        }
+        else if (!m_verifiedContentCache)
+        {
+            m_verifiedContentCache = std::make_unique<VerifiedContentCache>();
+        }
+    }
+
+    bool LogicEngineImpl::exportVerificationCache(std::vector<uint8_t>& data)
+    {
+        m_errors.clear();
+        if (!m_verifiedContentCache)
+        {
+            m_errors.add("Cannot export verification cache, verification cache is not enabled!", nullptr, EErrorType::ContentStateError);
+            return false;
+        }
+
+        data = m_verifiedContentCache->exportEntries();
+        return true;
+    }
+
+    bool LogicEngineImpl::importVerificationCache(const std::vector<uint8_t>& data)
+    {
+        m_errors.clear();
+        if (!m_verifiedContentCache)
+        {
+            m_errors.add("Cannot import verification cache, verification cache is not enabled!", nullptr, EErrorType::ContentStateError);
+            return false;
+        }
+
+        if (!m_verifiedContentCache->importEntries(data))
+        {
+            m_errors.add("Cannot import verification cache, data is corrupted or was exported using a different key!", nullptr, EErrorType::IllegalArgument);
+            return false;
+        }
+
+        return true;
+    }
+
     void LogicEngineImpl::enableUpdateReport(bool enable)
     {
         m_updateReportEnabled = enable;
@@ -934,6 +1704,19 @@ namespace rlogic::internal
         return LogicEngineReport{ std::make_unique<LogicEngineReportImpl>(m_updateReport, *m_apiObjects) };
     }
 
+    LogicEngineState LogicEngineImpl::captureState() const
+    {
+        return LogicEngineState{ LogicEngineStateImpl::Capture(*m_apiObjects) };
+    }
+
+    bool LogicEngineImpl::restoreState(const LogicEngineState& state)
+    {
+        m_errors.clear();
+        if (!checkNoOpenTransaction("restore state"))
+            return false;
+        return state.m_impl->restore(*m_apiObjects, m_errors);
+    }
+
     void LogicEngineImpl::setStatisticsLoggingRate(size_t loggingRate)
     {
         m_statistics.setLoggingRate(loggingRate);
@@ -12,6 +12,7 @@
 #include "ramses-logic/ERotationType.h"
 #include "ramses-logic/AnimationTypes.h"
 #include "ramses-logic/LogicEngineReport.h"
+#include "ramses-logic/LogicEngineState.h"
 #include "ramses-logic/DataTypes.h"
 #include "internals/ApiObjects.h"
 #include "internals/LogicNodeDependencies.h"
@@ -19,13 +20,17 @@
 #include "internals/ValidationResults.h"
 #include "internals/UpdateReport.h"
 #include "internals/LogicNodeUpdateStatistics.h"
+#include "internals/VerifiedContentCache.h"
 
 #include "ramses-framework-api/RamsesFrameworkTypes.h"
 
 #include <memory>
+#include <chrono>
 #include <vector>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <unordered_set>
 
 namespace ramses
 {
@@ -55,6 +60,7 @@ namespace rlogic
     class AnimationNodeConfig;
     class TimerNode;
     class AnchorPoint;
+    class AnimationBlendNode;
     class LuaScript;
     class LuaInterface;
     class LuaModule;
@@ -63,6 +69,11 @@ namespace rlogic
     enum class ELogMessageType;
 }
 
+namespace flatbuffers
+{
+    class FlatBufferBuilder;
+}
+
 namespace rlogic_serialization
 {
     struct Version;
@@ -114,10 +125,16 @@ namespace rlogic::internal
         AnimationNode* createAnimationNode(const AnimationNodeConfig& config, std::string_view name);
         TimerNode* createTimerNode(std::string_view name);
         AnchorPoint* createAnchorPoint(RamsesNodeBinding& nodeBinding, RamsesCameraBinding& cameraBinding, std::string_view name);
+        AnimationBlendNode* createAnimationBlendNode(const std::vector<const AnimationNode*>& sources, std::string_view name);
 
+        void reserve(size_t objectCount);
         bool destroy(LogicObject& object);
+        bool destroy(const std::vector<LogicObject*>& objects);
 
         bool update();
+        bool updateNodes(const std::vector<LogicNode*>& rootNodes);
+        bool updateWithBudget(std::chrono::microseconds budget, bool applyBindingsWhenSettled);
+        [[nodiscard]] bool isUpdateSettled() const;
 
         [[nodiscard]] const std::vector<ErrorData>& getErrors() const;
         const std::vector<WarningData>& validate() const;
@@ -125,7 +142,16 @@ namespace rlogic::internal
         bool loadFromFile(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification);
         bool loadFromFileDescriptor(int fd, size_t offset, size_t size, ramses::Scene* scene, bool enableMemoryVerification);
         bool loadFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* scene, bool enableMemoryVerification);
+        std::optional<uint64_t> loadPackageFromFile(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification);
+        std::optional<uint64_t> loadPackageFromBuffer(const void* rawBuffer, size_t bufferSize, ramses::Scene* scene, bool enableMemoryVerification);
+        bool unloadPackage(uint64_t packageId);
+        void enableLazyLuaScriptLoading(bool enable);
+        void enableParallelLoading(bool enable);
+        void enableVerificationCache(bool enable, const std::optional<std::array<uint8_t, 16>>& key);
+        bool exportVerificationCache(std::vector<uint8_t>& data);
+        bool importVerificationCache(const std::vector<uint8_t>& data);
         bool saveToFile(std::string_view filename, const SaveFileConfigImpl& config);
+        bool saveToBuffer(std::vector<uint8_t>& buffer, const SaveFileConfigImpl& config);
         [[nodiscard]] static bool GetFeatureLevelFromFile(std::string_view filename, EFeatureLevel& detectedFeatureLevel);
         [[nodiscard]] static bool GetFeatureLevelFromBuffer(std::string_view logname, const void* buffer, size_t bufferSize, EFeatureLevel& detectedFeatureLevel);
 
@@ -133,8 +159,16 @@ namespace rlogic::internal
         bool linkWeak(const Property& sourceProperty, const Property& targetProperty);
         bool unlink(const Property& sourceProperty, const Property& targetProperty);
 
+        bool beginTransaction();
+        bool commitTransaction();
+        bool rollbackTransaction();
+
         [[nodiscard]] bool isLinked(const LogicNode& logicNode) const;
 
+        bool suspendNodes(const std::vector<LogicNode*>& nodes);
+        bool resumeNodes(const std::vector<LogicNode*>& nodes);
+        [[nodiscard]] bool isSuspended(const LogicNode& logicNode) const;
+
         [[nodiscard]] EFeatureLevel getFeatureLevel() const;
 
         [[nodiscard]] ApiObjects& getApiObjects();
@@ -145,6 +179,9 @@ namespace rlogic::internal
         void enableUpdateReport(bool enable);
         [[nodiscard]] LogicEngineReport getLastUpdateReport() const;
 
+        [[nodiscard]] LogicEngineState captureState() const;
+        bool restoreState(const LogicEngineState& state);
+
         void setStatisticsLoggingRate(size_t loggingRate);
         void setStatisticsLogLevel(ELogMessageType logLevel);
 
@@ -155,20 +192,69 @@ namespace rlogic::internal
 
     private:
         size_t activateLinksRecursive(PropertyImpl& output);
-        void setNodeToBeAlwaysUpdatedDirty();
+        // returns true if any value changed
+        static bool ApplyDeferredLinksRecursive(PropertyImpl& input);
+        // reports error and returns nullopt if any of the nodes does not belong to this logic engine
+        [[nodiscard]] std::optional<NodeVector> getNodeImpls(const std::vector<LogicNode*>& nodes, std::string_view operation);
+        // Nodes to execute in topological order (without skin bindings, which are updated in batch after all other nodes)
+        // and nodes forced dirty on every update, derived from topologically sorted nodes whenever their order changes
+        struct ExecutionPlan
+        {
+            NodeVector nodes;
+            NodeVector skinBindings;
+            // Ramses bindings other than skin bindings, also contained in nodes
+            NodeVector ramsesBindings;
+            NodeVector alwaysDirtyNodes;
+            uint64_t topologyCacheVersion = 0u;
+        };
+        // State of update split into multiple calls of updateWithBudget, nodes are updated in order of slicedNodes
+        // over multiple calls and deferredNodes at once after all slicedNodes are updated
+        struct BudgetedUpdate
+        {
+            NodeVector slicedNodes;
+            NodeVector deferredNodes;
+            size_t nextNode = 0u;
+            // number of times the update continued from a node which got dirty again after it was updated
+            size_t restarts = 0u;
+            bool applyBindingsWhenSettled = false;
+            uint64_t topologyCacheVersion = 0u;
+        };
+        // limits restarts of budgeted update so that it settles even if inputs are set before every call
+        static constexpr size_t MaxBudgetedUpdateRestarts = 2u;
+        // updates all nodes if rootNodes is nullptr, otherwise only given nodes and nodes depending on them
+        [[nodiscard]] bool updateInternal(const NodeVector* rootNodes);
+        // returns sorted nodes or nullptr if they cannot be sorted
+        [[nodiscard]] const NodeVector* startUpdate();
+        void finishUpdate(size_t nodeCount);
+        [[nodiscard]] BudgetedUpdate createBudgetedUpdate(const ExecutionPlan& executionPlan, bool applyBindingsWhenSettled) const;
+        [[nodiscard]] const ExecutionPlan& getExecutionPlan(const NodeVector& sortedNodes);
+        [[nodiscard]] static ExecutionPlan CreateExecutionPlan(const NodeVector& sortedNodes);
+        static void SetNodesToBeAlwaysUpdatedDirty(const NodeVector& alwaysDirtyNodes);
 
         static bool CheckRamsesVersionFromFile(const rlogic_serialization::Version& ramsesVersion);
 
         static void LogAssetMetadata(const rlogic_serialization::Metadata& assetMetadata);
 
-        [[nodiscard]] bool updateNodes(const NodeVector& nodes);
+        [[nodiscard]] bool updateSortedNodes(const NodeVector& sortedNodes);
+        [[nodiscard]] bool updateNodeIfDirty(LogicNodeImpl& node, bool hasAnchorPoints);
 
-        [[nodiscard]] bool updateSkinBindings();
+        [[nodiscard]] bool updateSkinBindings(const NodeVector& skinBindings);
         [[nodiscard]] bool updateNode(LogicNodeImpl& node);
 
-        [[nodiscard]] bool loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription);
+        // loadedPackageId is not null when loading additively, then it receives ID of loaded package
+        [[nodiscard]] bool loadFromFileData(std::string_view filename, ramses::Scene* scene, bool enableMemoryVerification, std::optional<uint64_t>* loadedPackageId);
+        [[nodiscard]] bool loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription,
+            std::optional<uint64_t>* loadedPackageId = nullptr);
         [[nodiscard]] bool checkFileIdentifierBytes(const std::string& dataSourceDescription, const std::string& fileIdBytes);
         [[nodiscard]] const char* getFileIdentifierMatchingFeatureLevel() const;
+        [[nodiscard]] bool serialize(flatbuffers::FlatBufferBuilder& builder, const SaveFileConfigImpl& config);
+        [[nodiscard]] size_t getSerializationBufferSizeHint() const;
+
+        // reports error if operation is called while transaction is open
+        [[nodiscard]] bool checkNoOpenTransaction(std::string_view operation);
+        // checks objects and keeps them to be destroyed when transaction is committed, fails transaction if any is invalid
+        [[nodiscard]] bool addObjectsToDestroyOnCommit(const std::vector<LogicObject*>& objects);
+        void revertTransaction();
 
         std::unique_ptr<ApiObjects> m_apiObjects;
         ErrorReporting m_errors;
@@ -176,9 +262,42 @@ namespace rlogic::internal
         bool m_nodeDirtyMechanismEnabled = true;
 
         bool m_updateReportEnabled = false;
+        DeserializationOptions m_deserializationOptions;
+        std::unique_ptr<VerifiedContentCache> m_verifiedContentCache;
         bool m_statisticsEnabled   = true;
         UpdateReport m_updateReport;
         LogicNodeUpdateStatistics m_statistics;
+        // skin bindings (not suspended) updated in current update, kept as member to avoid reallocs every update
+        NodeVector m_skinBindingsToUpdate;
+
+        // size of last serialized content, used to pre-size the serialization buffer of the next save
+        size_t m_lastSerializedSize = 0u;
+        static constexpr size_t MinSerializationBufferSize = 1024u;
+
+        // Graph edits done between beginTransaction and commitTransaction/rollbackTransaction,
+        // links are applied immediately and journaled to be reverted, destruction is deferred to commit
+        struct LinkEdit
+        {
+            PropertyImpl* sourceProperty;
+            PropertyImpl* targetProperty;
+            bool isWeakLink;
+            bool linked;
+        };
+        struct GraphTransaction
+        {
+            std::vector<LinkEdit> linkEdits;
+            std::vector<LogicObject*> objectsToDestroy;
+            std::unordered_set<const LogicObject*> objectsToDestroySet;
+            // objects created after this index in creation order are destroyed on rollback
+            size_t createdObjectsBegin = 0u;
+            bool failed = false;
+        };
+        std::optional<GraphTransaction> m_transaction;
+
+        // reset whenever content is replaced
+        std::optional<ExecutionPlan> m_executionPlan;
+        // set while update split into multiple calls of updateWithBudget is not finished
+        std::optional<BudgetedUpdate> m_budgetedUpdate;
 
         EFeatureLevel m_featureLevel;
     };
@@ -0,0 +1,22 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-logic/LogicEngineState.h"
+#include "impl/LogicEngineStateImpl.h"
+
+namespace rlogic
+{
+    LogicEngineState::LogicEngineState(std::unique_ptr<internal::LogicEngineStateImpl> impl) noexcept
+        : m_impl{ std::move(impl) }
+    {
+    }
+
+    LogicEngineState::LogicEngineState(LogicEngineState&& other) noexcept = default;
+    LogicEngineState& LogicEngineState::operator=(LogicEngineState&& other) noexcept = default;
+    LogicEngineState::~LogicEngineState() = default;
+}
@@ -0,0 +1,165 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/LogicEngineStateImpl.h"
+
+#include "ramses-logic/LogicNode.h"
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/AnimationNode.h"
+#include "ramses-logic/Property.h"
+
+#include "impl/LuaScriptImpl.h"
+#include "internals/ApiObjects.h"
+#include "internals/ErrorReporting.h"
+#include "internals/TypeUtils.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        void CollectPrimitiveProperties(PropertyImpl& property, std::vector<PropertyImpl*>& primitiveProperties)
+        {
+            if (TypeUtils::IsPrimitiveType(property.getType()))
+            {
+                primitiveProperties.push_back(&property);
+                return;
+            }
+
+            for (size_t i = 0u; i < property.getChildCount(); ++i)
+                CollectPrimitiveProperties(*property.getChild(i)->m_impl, primitiveProperties);
+        }
+
+        void CollectNodeProperties(LogicNodeImpl& node, std::vector<PropertyImpl*>& primitiveProperties)
+        {
+            Property* inputs = node.getInputs();
+            Property* outputs = node.getOutputs();
+            if (inputs)
+                CollectPrimitiveProperties(*inputs->m_impl, primitiveProperties);
+            // interfaces use same property as inputs and outputs
+            if (outputs && outputs != inputs)
+                CollectPrimitiveProperties(*outputs->m_impl, primitiveProperties);
+        }
+    }
+
+    std::unique_ptr<LogicEngineStateImpl> LogicEngineStateImpl::Capture(const ApiObjects& apiObjects)
+    {
+        auto state = std::make_unique<LogicEngineStateImpl>();
+
+        const auto& objects = apiObjects.getApiObjectContainer<LogicObject>();
+        state->m_objectIds.reserve(objects.size());
+
+        std::vector<PropertyImpl*> properties;
+        for (LogicObject* object : objects)
+        {
+            state->m_objectIds.push_back(object->getId());
+
+            auto* node = dynamic_cast<LogicNode*>(object);
+            if (node == nullptr)
+                continue;
+
+            CollectNodeProperties(node->m_impl, properties);
+            state->m_nodes.push_back(NodeState{ properties.size(), node->m_impl.isDirty() });
+        }
+
+        state->m_values.reserve(properties.size());
+        state->m_bindingInputsHaveNewValue.reserve(properties.size());
+        for (const PropertyImpl* property : properties)
+        {
+            state->m_values.push_back(property->getValue());
+            state->m_bindingInputsHaveNewValue.push_back(property->bindingInputHasNewValue());
+        }
+
+        const auto& scripts = apiObjects.getApiObjectContainer<LuaScript>();
+        state->m_scriptGlobals.reserve(scripts.size());
+        for (const LuaScript* script : scripts)
+        {
+            const sol::table& globals = script->m_script.getGlobals();
+            if (globals.valid())
+                state->m_scriptGlobals.emplace_back(LuaTableSnapshot::Capture(globals));
+            else
+                state->m_scriptGlobals.emplace_back(std::nullopt);
+        }
+
+        const auto& animationNodes = apiObjects.getApiObjectContainer<AnimationNode>();
+        state->m_animationPlaybackStates.reserve(animationNodes.size());
+        for (const AnimationNode* animationNode : animationNodes)
+            state->m_animationPlaybackStates.push_back(animationNode->m_animationNodeImpl.getPlaybackState());
+
+        return state;
+    }
+
+    bool LogicEngineStateImpl::restore(ApiObjects& apiObjects, ErrorReporting& errorReporting) const
+    {
+        const auto& objects = apiObjects.getApiObjectContainer<LogicObject>();
+        const bool sameObjects = std::equal(m_objectIds.cbegin(), m_objectIds.cend(), objects.cbegin(), objects.cend(),
+            [](uint64_t id, const LogicObject* object) { return id == object->getId(); });
+        if (!sameObjects)
+        {
+            errorReporting.add("Cannot restore state, logic objects were created or destroyed since the state was captured!", nullptr, EErrorType::ContentStateError);
+            return false;
+        }
+
+        std::vector<LogicNodeImpl*> nodes;
+        nodes.reserve(m_nodes.size());
+        std::vector<PropertyImpl*> properties;
+        properties.reserve(m_values.size());
+        for (LogicObject* object : objects)
+        {
+            auto* node = dynamic_cast<LogicNode*>(object);
+            if (node == nullptr)
+                continue;
+
+            nodes.push_back(&node->m_impl);
+            CollectNodeProperties(node->m_impl, properties);
+        }
+        assert(nodes.size() == m_nodes.size());
+
+        const bool sameProperties = std::equal(properties.cbegin(), properties.cend(), m_values.cbegin(), m_values.cend(),
+            [](const PropertyImpl* property, const PropertyValue& value) { return property->getValue().index() == value.index(); });
+        if (!sameProperties)
+        {
+            errorReporting.add("Cannot restore state, properties of logic nodes do not match the captured state!", nullptr, EErrorType::ContentStateError);
+            return false;
+        }
+
+        size_t valueIdx = 0u;
+        for (size_t nodeIdx = 0u; nodeIdx < nodes.size(); ++nodeIdx)
+        {
+            bool valueChanged = false;
+            for (; valueIdx < m_nodes[nodeIdx].valuesEnd; ++valueIdx)
+            {
+                if (properties[valueIdx]->restoreValue(m_values[valueIdx], m_bindingInputsHaveNewValue[valueIdx]))
+                    valueChanged = true;
+            }
+            // node with changed values is updated even if it was not dirty when captured
+            nodes[nodeIdx]->setDirty(m_nodes[nodeIdx].dirty || valueChanged);
+            // cached Ramses states do not correspond to restored outputs anymore
+            nodes[nodeIdx]->invalidateCache();
+        }
+
+        const auto& scripts = apiObjects.getApiObjectContainer<LuaScript>();
+        assert(scripts.size() == m_scriptGlobals.size());
+        for (size_t i = 0u; i < scripts.size(); ++i)
+        {
+            // globals of script which was not compiled (lazy loading) when captured are kept as they are
+            const sol::table& globals = scripts[i]->m_script.getGlobals();
+            if (m_scriptGlobals[i] && globals.valid())
+                m_scriptGlobals[i]->restore(globals);
+        }
+
+        const auto& animationNodes = apiObjects.getApiObjectContainer<AnimationNode>();
+        assert(animationNodes.size() == m_animationPlaybackStates.size());
+        for (size_t i = 0u; i < animationNodes.size(); ++i)
+            animationNodes[i]->m_animationNodeImpl.setPlaybackState(m_animationPlaybackStates[i]);
+
+        return true;
+    }
+}
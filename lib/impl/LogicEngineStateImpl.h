@@ -0,0 +1,52 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/PropertyImpl.h"
+#include "impl/AnimationNodeImpl.h"
+#include "internals/LuaTableSnapshot.h"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace rlogic::internal
+{
+    class ApiObjects;
+    class ErrorReporting;
+
+    class LogicEngineStateImpl
+    {
+    public:
+        [[nodiscard]] static std::unique_ptr<LogicEngineStateImpl> Capture(const ApiObjects& apiObjects);
+
+        // Fails without modifying anything if logic objects or their properties do not match the captured ones
+        [[nodiscard]] bool restore(ApiObjects& apiObjects, ErrorReporting& errorReporting) const;
+
+    private:
+        struct NodeState
+        {
+            size_t valuesEnd = 0u;
+            bool dirty = false;
+        };
+
+        // IDs of all logic objects in order of creation, used to check that state is restored to same content
+        std::vector<uint64_t> m_objectIds;
+
+        // per logic node in order of creation, values of primitive properties (inputs and outputs) are stored
+        // depth first in one list for all nodes
+        std::vector<NodeState> m_nodes;
+        std::vector<PropertyValue> m_values;
+        std::vector<bool> m_bindingInputsHaveNewValue;
+
+        // per script/animation node in order of creation
+        std::vector<std::optional<LuaTableSnapshot>> m_scriptGlobals;
+        std::vector<AnimationNodeImpl::PlaybackState> m_animationPlaybackStates;
+    };
+}
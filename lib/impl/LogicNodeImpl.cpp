@@ -51,6 +51,30 @@ namespace rlogic::internal
         return m_dirty;
     }
 
+    void LogicNodeImpl::invalidateCache()
+    {
+    }
+
+    void LogicNodeImpl::setSuspended(bool suspended)
+    {
+        m_suspended = suspended;
+    }
+
+    bool LogicNodeImpl::isSuspended() const
+    {
+        return m_suspended;
+    }
+
+    void LogicNodeImpl::setGraphIndex(size_t graphIndex)
+    {
+        m_graphIndex = graphIndex;
+    }
+
+    size_t LogicNodeImpl::getGraphIndex() const
+    {
+        return m_graphIndex;
+    }
+
     void LogicNodeImpl::setRootProperties(std::unique_ptr<Property> rootInput, std::unique_ptr<Property> rootOutput)
     {
         m_inputs = std::move(rootInput);
@@ -11,6 +11,7 @@
 
 #include "impl/LogicObjectImpl.h"
 #include "ramses-logic/EFeatureLevel.h"
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -43,9 +44,21 @@ namespace rlogic::internal
         virtual void createRootProperties() = 0;
         virtual std::optional<LogicNodeRuntimeError> update() = 0;
 
+        // Drops states cached to skip recalculations in update, next update recalculates outputs unconditionally
+        virtual void invalidateCache();
+
         void setDirty(bool dirty);
         [[nodiscard]] bool isDirty() const;
 
+        // Suspended node is not executed by update (but keeps its dirtiness) and does not receive values over links until resumed
+        void setSuspended(bool suspended);
+        [[nodiscard]] bool isSuspended() const;
+
+        // Dense index of the node within the dependency graph it belongs to, assigned by DirectedAcyclicGraph
+        static constexpr size_t InvalidGraphIndex = std::numeric_limits<size_t>::max();
+        void setGraphIndex(size_t graphIndex);
+        [[nodiscard]] size_t getGraphIndex() const;
+
     protected:
         void setRootProperties(std::unique_ptr<Property> rootInput, std::unique_ptr<Property> rootOutput);
 
@@ -54,5 +67,7 @@ namespace rlogic::internal
         std::unique_ptr<Property> m_outputs;
         // Dirty after creation (every node gets executed at least once after creation)
         bool                      m_dirty = true;
+        bool                      m_suspended = false;
+        size_t                    m_graphIndex = InvalidGraphIndex;
     };
 }
@@ -10,6 +10,7 @@
 #include "ramses-logic/LuaInterface.h"
 #include "impl/LoggerImpl.h"
 #include "internals/ErrorReporting.h"
+#include "internals/LogicObjectNameIndex.h"
 #include "flatbuffers/flatbuffers.h"
 #include "generated/LogicObjectGen.h"
 
@@ -30,6 +31,8 @@ namespace rlogic::internal
 
     bool LogicObjectImpl::setName(std::string_view name)
     {
+        if (m_nameIndex)
+            m_nameIndex->rename(*m_logicObject, m_name, name);
         m_name = name;
         return true;
     }
@@ -39,6 +42,27 @@ namespace rlogic::internal
         return m_id;
     }
 
+    void LogicObjectImpl::setId(uint64_t id)
+    {
+        assert(m_logicObject == nullptr);
+        m_id = id;
+    }
+
+    ELogicObjectType LogicObjectImpl::getObjectType() const
+    {
+        return m_objectType;
+    }
+
+    void LogicObjectImpl::setObjectType(ELogicObjectType objectType)
+    {
+        m_objectType = objectType;
+    }
+
+    void LogicObjectImpl::setNameIndex(LogicObjectNameIndex* nameIndex)
+    {
+        m_nameIndex = nameIndex;
+    }
+
     bool LogicObjectImpl::setUserId(uint64_t highId, uint64_t lowId)
     {
         m_userId = { highId, lowId };
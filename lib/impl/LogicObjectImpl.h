@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "internals/ELogicObjectType.h"
+
 #include <string>
 
 namespace flatbuffers
@@ -29,6 +31,7 @@ namespace rlogic
 namespace rlogic::internal
 {
     class ErrorReporting;
+    class LogicObjectNameIndex;
 
     class LogicObjectImpl
     {
@@ -40,6 +43,12 @@ namespace rlogic::internal
 
         [[nodiscard]] std::string_view getName() const;
         [[nodiscard]] uint64_t getId() const;
+        // only to be used by ApiObjects before object is registered (e.g. to remap IDs of content loaded additively)
+        void setId(uint64_t id);
+        [[nodiscard]] ELogicObjectType getObjectType() const;
+        // only to be used by ApiObjects when object is registered
+        void setObjectType(ELogicObjectType objectType);
+        void setNameIndex(LogicObjectNameIndex* nameIndex);
         bool setName(std::string_view name);
         bool setUserId(uint64_t highId, uint64_t lowId);
         [[nodiscard]] std::pair<uint64_t, uint64_t> getUserId() const;
@@ -64,5 +73,7 @@ namespace rlogic::internal
         uint64_t    m_id;
         std::pair<uint64_t, uint64_t> m_userId{ 0u, 0u };
         LogicObject* m_logicObject = nullptr;
+        ELogicObjectType m_objectType = ELogicObjectType::Unknown;
+        LogicObjectNameIndex* m_nameIndex = nullptr;
     };
 }
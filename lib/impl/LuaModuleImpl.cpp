@@ -20,6 +20,7 @@
 #include "internals/EnvironmentProtection.h"
 #include "internals/PropertyTypeExtractor.h"
 #include <fmt/format.h>
+#include <algorithm>
 
 namespace rlogic::internal
 {
@@ -185,6 +186,43 @@ namespace rlogic::internal
         return deserialized;
     }
 
+    bool LuaModuleImpl::isIdenticalTo(const rlogic_serialization::LuaModule& module, const DeserializationMap& deserializationMap) const
+    {
+        if (m_hasDebugLogFunctions || !module.standardModules() || !module.dependencies())
+            return false;
+
+        const auto& stdModules = *module.standardModules();
+        if (!std::equal(stdModules.cbegin(), stdModules.cend(), m_stdModules.cbegin(), m_stdModules.cend(),
+            [](uint8_t serialized, EStandardModule stdModule) { return static_cast<EStandardModule>(serialized) == stdModule; }))
+        {
+            return false;
+        }
+
+        if (module.dependencies()->size() != m_dependencies.size())
+            return false;
+        for (const auto* dependency : *module.dependencies())
+        {
+            if (!dependency || !dependency->name())
+                return false;
+            const auto it = m_dependencies.find(dependency->name()->str());
+            const auto* resolvedModule = deserializationMap.resolveLogicObject<LuaModuleImpl>(dependency->moduleId());
+            if (it == m_dependencies.cend() || !resolvedModule || &it->second->m_impl != resolvedModule)
+                return false;
+        }
+
+        // compare whatever code both modules have, bytecode is only compared if there is no source code to compare
+        if (module.source() && module.source()->size() > 0 && !m_sourceCode.empty())
+            return module.source()->string_view() == m_sourceCode;
+        if (module.luaByteCode() && module.luaByteCode()->size() > 0 && !m_byteCode.empty())
+        {
+            const auto& byteCode = *module.luaByteCode();
+            return std::equal(byteCode.cbegin(), byteCode.cend(), m_byteCode.cbegin(), m_byteCode.cend(),
+                [](uint8_t serialized, std::byte b) { return std::byte(serialized) == b; });
+        }
+
+        return false;
+    }
+
     const ModuleMapping& LuaModuleImpl::getDependencies() const
     {
         return m_dependencies;
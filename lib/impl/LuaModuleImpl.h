@@ -47,6 +47,10 @@ namespace rlogic::internal
         [[nodiscard]] const ModuleMapping& getDependencies() const;
         [[nodiscard]] bool hasDebugLogFunctions() const;
 
+        // True if serialized module has same code (source or bytecode), standard modules and dependencies (resolved
+        // using deserializationMap) as this module, i.e. this module can be used instead of deserializing it
+        [[nodiscard]] bool isIdenticalTo(const rlogic_serialization::LuaModule& module, const DeserializationMap& deserializationMap) const;
+
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::LuaModule> Serialize(
             const LuaModuleImpl& module,
             flatbuffers::FlatBufferBuilder& builder,
@@ -33,6 +33,7 @@ namespace rlogic::internal
         , m_wrappedRootInput(*compiledScript.rootInput->m_impl)
         , m_wrappedRootOutput(*compiledScript.rootOutput->m_impl)
         , m_runFunction(std::move(compiledScript.runFunction))
+        , m_globals(std::move(compiledScript.globals))
         , m_modules(std::move(compiledScript.source.userModules))
         , m_stdModules(std::move(compiledScript.source.stdModules))
         , m_hasDebugLogFunctions{ compiledScript.source.hasDebugLogFunctions }
@@ -40,6 +41,21 @@ namespace rlogic::internal
         setRootProperties(std::move(compiledScript.rootInput), std::move(compiledScript.rootOutput));
     }
 
+    LuaScriptImpl::LuaScriptImpl(LuaCompiledSource source, std::unique_ptr<Property> rootInput, std::unique_ptr<Property> rootOutput, EFeatureLevel featureLevel, std::string_view name, uint64_t id)
+        : LogicNodeImpl(name, id)
+        , m_source(std::move(source.sourceCode))
+        , m_byteCode(std::move(source.byteCode))
+        , m_wrappedRootInput(*rootInput->m_impl)
+        , m_wrappedRootOutput(*rootOutput->m_impl)
+        , m_modules(std::move(source.userModules))
+        , m_stdModules(std::move(source.stdModules))
+        , m_hasDebugLogFunctions{ source.hasDebugLogFunctions }
+        , m_deferredCompilationSolState{ &source.solState.get() }
+        , m_featureLevel{ featureLevel }
+    {
+        setRootProperties(std::move(rootInput), std::move(rootOutput));
+    }
+
     void LuaScriptImpl::createRootProperties()
     {
         // unlike other logic objects, luascript properties created outside of it (from script or deserialized)
@@ -121,7 +137,8 @@ namespace rlogic::internal
         const rlogic_serialization::LuaScript& luaScript,
         ErrorReporting& errorReporting,
         DeserializationMap& deserializationMap,
-        EFeatureLevel featureLevel)
+        EFeatureLevel featureLevel,
+        bool lazyCompilation)
     {
         std::string name;
         uint64_t id = 0u;
@@ -222,6 +239,20 @@ namespace rlogic::internal
             std::transform(luaScript.luaByteCode()->cbegin(), luaScript.luaByteCode()->cend(), std::back_inserter(byteCode), [](uint8_t b) { return std::byte(b); });
         }
 
+        if (lazyCompilation)
+        {
+            // properties are needed right away for links, only the script environment is created later
+            auto deferredScript = std::make_unique<LuaScriptImpl>(
+                LuaCompiledSource{ std::move(sourceCode), std::move(byteCode), solState, std::move(stdModules), std::move(userModules), false },
+                std::move(inputs),
+                std::move(outputs),
+                featureLevel,
+                name, id);
+            deferredScript->setUserId(userIdHigh, userIdLow);
+
+            return deferredScript;
+        }
+
         auto compiledScript = LuaCompilationUtils::CompileScriptOrImportPrecompiled(
             solState,
             userModules,
@@ -252,6 +283,12 @@ namespace rlogic::internal
 
     std::optional<LogicNodeRuntimeError> LuaScriptImpl::update()
     {
+        if (m_deferredCompilationSolState)
+        {
+            if (auto compileError = compileDeferred())
+                return compileError;
+        }
+
         sol::protected_function_result result = m_runFunction(std::ref(m_wrappedRootInput), std::ref(m_wrappedRootOutput));
 
         if (!result.valid())
@@ -263,6 +300,44 @@ namespace rlogic::internal
         return std::nullopt;
     }
 
+    std::optional<LogicNodeRuntimeError> LuaScriptImpl::compileDeferred()
+    {
+        ErrorReporting compilationErrors;
+        auto runFunction = LuaCompilationUtils::LoadPrecompiledScriptRunFunction(
+            *m_deferredCompilationSolState,
+            m_modules,
+            m_stdModules,
+            m_source,
+            m_byteCode,
+            getName(),
+            compilationErrors,
+            m_featureLevel,
+            m_globals);
+
+        if (!runFunction)
+        {
+            std::string errorMessage = fmt::format("Failed to load LuaScript '{}' from serialized data", getName());
+            for (const auto& error : compilationErrors.getErrors())
+                errorMessage += fmt::format("\n{}", error.message);
+            return LogicNodeRuntimeError{ std::move(errorMessage) };
+        }
+
+        m_runFunction = std::move(*runFunction);
+        m_deferredCompilationSolState = nullptr;
+
+        return std::nullopt;
+    }
+
+    bool LuaScriptImpl::isCompiled() const
+    {
+        return m_deferredCompilationSolState == nullptr;
+    }
+
+    const sol::table& LuaScriptImpl::getGlobals() const
+    {
+        return m_globals;
+    }
+
     const ModuleMapping& LuaScriptImpl::getModules() const
     {
         return m_modules;
@@ -50,6 +50,8 @@ namespace rlogic::internal
     {
     public:
         explicit LuaScriptImpl(LuaCompiledScript compiledScript, std::string_view name, uint64_t id);
+        // Script with deserialized properties which is compiled only when it is updated for the first time
+        LuaScriptImpl(LuaCompiledSource source, std::unique_ptr<Property> rootInput, std::unique_ptr<Property> rootOutput, EFeatureLevel featureLevel, std::string_view name, uint64_t id);
         ~LuaScriptImpl() noexcept override = default;
         LuaScriptImpl(const LuaScriptImpl & other) = delete;
         LuaScriptImpl& operator=(const LuaScriptImpl & other) = delete;
@@ -65,23 +67,35 @@ namespace rlogic::internal
             const rlogic_serialization::LuaScript& luaScript,
             ErrorReporting& errorReporting,
             DeserializationMap& deserializationMap,
-            EFeatureLevel featureLevel);
+            EFeatureLevel featureLevel,
+            bool lazyCompilation = false);
 
         std::optional<LogicNodeRuntimeError> update() override;
 
+        [[nodiscard]] bool isCompiled() const;
+        // GLOBAL table of the script, invalid if script is not compiled yet
+        [[nodiscard]] const sol::table& getGlobals() const;
+
         [[nodiscard]] const ModuleMapping& getModules() const;
         [[nodiscard]] bool hasDebugLogFunctions() const;
 
         void createRootProperties() final;
 
     private:
+        [[nodiscard]] std::optional<LogicNodeRuntimeError> compileDeferred();
+
         std::string             m_source;
         sol::bytecode           m_byteCode;
         WrappedLuaProperty      m_wrappedRootInput;
         WrappedLuaProperty      m_wrappedRootOutput;
         sol::protected_function m_runFunction;
+        sol::table              m_globals;
         ModuleMapping           m_modules;
         StandardModules         m_stdModules;
         bool m_hasDebugLogFunctions;
+
+        // set only for scripts which were not compiled yet
+        SolState*               m_deferredCompilationSolState = nullptr;
+        EFeatureLevel           m_featureLevel = EFeatureLevel_01;
     };
 }
@@ -610,6 +610,21 @@ namespace rlogic::internal
         return valueChanged;
     }
 
+    bool PropertyImpl::restoreValue(const PropertyValue& value, bool bindingInputHasNewValue)
+    {
+        assert(m_value.index() == value.index());
+        assert(TypeUtils::IsPrimitiveType(m_typeData.type));
+
+        const bool valueChanged = (m_value != value);
+        if (valueChanged)
+            m_value = value;
+
+        if (m_semantics == EPropertySemantics::BindingInput)
+            m_bindingInputHasNewValue = bindingInputHasNewValue || valueChanged;
+
+        return valueChanged;
+    }
+
     void PropertyImpl::setPropertyInstance(Property& property)
     {
         assert(m_propertyInstance == nullptr);
@@ -103,6 +103,9 @@ namespace rlogic::internal
         bool setValue(PropertyValue value);
         // Special setter for binding value init
         void initializeBindingInputValue(PropertyValue value);
+        // Sets value and binding input flag captured earlier, binding input is flagged also if value changed.
+        // Returns true if value changed
+        bool restoreValue(const PropertyValue& value, bool bindingInputHasNewValue);
 
         // Generic getter for use in other non-template code
         [[nodiscard]] const PropertyValue& getValue() const;
@@ -52,4 +52,9 @@ namespace rlogic
     {
         m_impl->setLuaSavingMode(mode);
     }
+
+    void SaveFileConfig::setCompression(EFileCompression compression)
+    {
+        m_impl->setCompression(compression);
+    }
 }
@@ -72,4 +72,14 @@ namespace rlogic::internal
     {
         return m_luaSavingMode;
     }
+
+    void SaveFileConfigImpl::setCompression(EFileCompression compression)
+    {
+        m_compression = compression;
+    }
+
+    EFileCompression SaveFileConfigImpl::getCompression() const
+    {
+        return m_compression;
+    }
 }
@@ -16,6 +16,7 @@
 #include "internals/DeserializationMap.h"
 #include "generated/SkinBindingGen.h"
 #include "fmt/format.h"
+#include <cassert>
 
 namespace rlogic::internal
 {
@@ -158,28 +159,72 @@ namespace rlogic::internal
 
     std::optional<LogicNodeRuntimeError> SkinBindingImpl::update()
     {
-        // NOLINTNEXTLINE(modernize-avoid-c-arrays) Ramses uses C array in matrix getters
-        float tempData[16];
-
-        m_jointMatricesArray.clear();
-        for (size_t i = 0u; i < m_joints.size(); ++i)
+        // SkinBinding is updated every frame because joint transformations cannot be monitored,
+        // compare world matrices of joints to those used last time and skip calculation and upload if none changed
+        bool jointsChanged = !m_jointMatricesUpToDate;
+        m_lastJointWorldMatrices.resize(m_joints.size());
+        if (m_prefetchedJointWorldMatrices)
+        {
+            assert(m_prefetchedJointWorldMatrices->size() == m_joints.size());
+            for (size_t i = 0u; i < m_joints.size(); ++i)
+            {
+                const math::Matrix44f& jointNodeWorld = *(*m_prefetchedJointWorldMatrices)[i];
+                if (jointNodeWorld != m_lastJointWorldMatrices[i])
+                {
+                    m_lastJointWorldMatrices[i] = jointNodeWorld;
+                    jointsChanged = true;
+                }
+            }
+        }
+        else
         {
-            if (m_joints[i]->getRamsesNode().getModelMatrix(tempData) != ramses::StatusOK)
-                return LogicNodeRuntimeError{ "Failed to retrieve model matrix from Ramses node!" };
-            const math::Matrix44f jointNodeWorld{ tempData };
-            const math::Matrix44f& inverseBindMatForJoint = m_inverseBindMatrices[i];
-            const math::Matrix44f jointMat = jointNodeWorld * inverseBindMatForJoint;
-
-            const auto jointMatArray = jointMat.toStdArray();
-            m_jointMatricesArray.insert(m_jointMatricesArray.end(), jointMatArray.cbegin(), jointMatArray.cend());
+            // NOLINTNEXTLINE(modernize-avoid-c-arrays) Ramses uses C array in matrix getters
+            float tempData[16];
+            for (size_t i = 0u; i < m_joints.size(); ++i)
+            {
+                if (m_joints[i]->getRamsesNode().getModelMatrix(tempData) != ramses::StatusOK)
+                {
+                    m_jointMatricesUpToDate = false;
+                    return LogicNodeRuntimeError{ "Failed to retrieve model matrix from Ramses node!" };
+                }
+                const math::Matrix44f jointNodeWorld{ tempData };
+                if (jointNodeWorld != m_lastJointWorldMatrices[i])
+                {
+                    m_lastJointWorldMatrices[i] = jointNodeWorld;
+                    jointsChanged = true;
+                }
+            }
         }
 
-        if (m_appearanceBinding.getRamsesAppearance().setInputValueMatrix44f(m_jointMatInput, uint32_t(m_joints.size()), m_jointMatricesArray.data()) != ramses::StatusOK)
+        if (!jointsChanged)
+            return std::nullopt;
+
+        m_jointMatrices.resize(m_joints.size());
+        for (size_t i = 0u; i < m_joints.size(); ++i)
+            math::Matrix44f::Multiply(m_lastJointWorldMatrices[i], m_inverseBindMatrices[i], m_jointMatrices[i]);
+
+        // matrices are tightly packed column-major floats, can be passed to Ramses directly
+        if (m_appearanceBinding.getRamsesAppearance().setInputValueMatrix44f(m_jointMatInput, uint32_t(m_joints.size()), m_jointMatrices.front().data()) != ramses::StatusOK)
+        {
+            m_jointMatricesUpToDate = false;
             return LogicNodeRuntimeError{ "Failed to set matrix array uniform to Ramses appearance!" };
+        }
+        m_jointMatricesUpToDate = true;
 
         return std::nullopt;
     }
 
+    void SkinBindingImpl::invalidateCache()
+    {
+        m_jointMatricesUpToDate = false;
+        m_lastJointWorldMatrices.clear();
+    }
+
+    void SkinBindingImpl::setPrefetchedJointWorldMatrices(const std::vector<const math::Matrix44f*>* jointWorldMatrices)
+    {
+        m_prefetchedJointWorldMatrices = jointWorldMatrices;
+    }
+
     const std::vector<const RamsesNodeBindingImpl*>& SkinBindingImpl::getJoints() const
     {
         return m_joints;
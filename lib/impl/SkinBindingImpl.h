@@ -66,6 +66,11 @@ namespace rlogic::internal
         [[nodiscard]] const ramses::UniformInput& getAppearanceUniformInput() const;
 
         std::optional<LogicNodeRuntimeError> update() override;
+        void invalidateCache() override;
+
+        // world matrices of joints (in same order as joints) retrieved by SkinningBatch, if set they are used
+        // in update instead of retrieving the world matrix of each joint from Ramses
+        void setPrefetchedJointWorldMatrices(const std::vector<const math::Matrix44f*>* jointWorldMatrices);
 
         void createRootProperties() final;
 
@@ -75,7 +80,13 @@ namespace rlogic::internal
         RamsesAppearanceBindingImpl& m_appearanceBinding;
         ramses::UniformInput m_jointMatInput;
 
+        const std::vector<const math::Matrix44f*>* m_prefetchedJointWorldMatrices = nullptr;
+
+        // joint world matrices used in last successful update, uniform is only recalculated and uploaded if any of them changes
+        std::vector<math::Matrix44f> m_lastJointWorldMatrices;
+        bool m_jointMatricesUpToDate = false;
+
         // temp variable used only in update kept as member to avoid reallocs every update call
-        std::vector<float> m_jointMatricesArray;
+        std::vector<math::Matrix44f> m_jointMatrices;
     };
 }
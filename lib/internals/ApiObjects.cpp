@@ -28,6 +28,7 @@
 #include "ramses-logic/AnimationNode.h"
 #include "ramses-logic/TimerNode.h"
 #include "ramses-logic/AnchorPoint.h"
+#include "ramses-logic/AnimationBlendNode.h"
 
 #include "impl/PropertyImpl.h"
 #include "impl/LuaScriptImpl.h"
@@ -45,6 +46,10 @@
 #include "impl/AnimationNodeConfigImpl.h"
 #include "impl/TimerNodeImpl.h"
 #include "impl/AnchorPointImpl.h"
+#include "impl/AnimationBlendNodeImpl.h"
+
+#include "internals/DeserializationMap.h"
+#include "internals/RamsesObjectResolver.h"
 
 #include "ramses-client-api/Node.h"
 #include "ramses-client-api/Appearance.h"
@@ -62,11 +67,14 @@
 #include "generated/DataArrayGen.h"
 #include "generated/AnimationNodeGen.h"
 #include "generated/TimerNodeGen.h"
+#include "generated/AnimationBlendNodeGen.h"
 
 #include "fmt/format.h"
 #include "TypeUtils.h"
 #include "ValidationResults.h"
-#include <deque>
+#include <algorithm>
+#include <future>
+#include <limits>
 
 namespace rlogic::internal
 {
@@ -273,6 +281,7 @@ namespace rlogic::internal
         std::unique_ptr<SkinBinding> up = std::make_unique<SkinBinding>(std::make_unique<SkinBindingImpl>(std::move(joints), inverseBindMatrices, appearanceBinding, jointMatInput, name, getNextLogicObjectId()));
         SkinBinding* binding = up.get();
         m_skinBindings.push_back(binding);
+        m_skinningBatch.invalidate();
         registerLogicObject(std::move(up));
         binding->m_impl.createRootProperties();
 
@@ -299,7 +308,7 @@ namespace rlogic::internal
     AnimationNode* ApiObjects::createAnimationNode(const AnimationNodeConfigImpl& config, std::string_view name)
     {
         std::unique_ptr<AnimationNode> up = std::make_unique<AnimationNode>(
-            std::make_unique<AnimationNodeImpl>(config.getChannels(), config.getExposingOfChannelDataAsProperties(), name, getNextLogicObjectId()));
+            std::make_unique<AnimationNodeImpl>(config.getChannels(), config.getExposingOfChannelDataAsProperties(), config.getPlaybackControlEnabled(), name, getNextLogicObjectId()));
         AnimationNode* animation = up.get();
         m_animationNodes.push_back(animation);
         registerLogicObject(std::move(up));
@@ -327,6 +336,7 @@ namespace rlogic::internal
         m_anchorPoints.push_back(anchor);
         registerLogicObject(std::move(up));
         anchor->m_impl.createRootProperties();
+        anchor->m_anchorPointImpl.setCameraViewProjectionCache(&m_cameraViewProjectionCache);
 
         m_logicNodeDependencies.addBindingDependency(nodeBinding, anchor->m_impl);
         m_logicNodeDependencies.addBindingDependency(cameraBinding, anchor->m_impl);
@@ -334,390 +344,414 @@ namespace rlogic::internal
         return anchor;
     }
 
-    void ApiObjects::registerLogicNode(LogicNode& logicNode)
+    AnimationBlendNode* ApiObjects::createAnimationBlendNode(std::vector<AnimationNodeImpl*> sources, std::string_view name)
     {
-        m_reverseImplMapping.emplace(std::make_pair(&logicNode.m_impl, &logicNode));
-        m_logicNodeDependencies.addNode(logicNode.m_impl);
-    }
+        assert(m_featureLevel >= EFeatureLevel_06);
+        auto up = std::make_unique<AnimationBlendNode>(std::make_unique<AnimationBlendNodeImpl>(std::move(sources), name, getNextLogicObjectId()));
+        AnimationBlendNode* blendNode = up.get();
+        m_animationBlendNodes.push_back(blendNode);
+        registerLogicObject(std::move(up));
+        blendNode->m_impl.createRootProperties();
 
-    void ApiObjects::unregisterLogicNode(LogicNode& logicNode)
-    {
-        LogicNodeImpl& logicNodeImpl = logicNode.m_impl;
-        auto implIter = m_reverseImplMapping.find(&logicNodeImpl);
-        assert(implIter != m_reverseImplMapping.end());
-        m_reverseImplMapping.erase(implIter);
+        for (auto* source : blendNode->m_animationBlendNodeImpl.getSources())
+        {
+            source->addDependentNode(blendNode->m_impl);
+            m_logicNodeDependencies.addNodeDependency(*source, blendNode->m_impl);
+        }
 
-        m_logicNodeDependencies.removeNode(logicNodeImpl);
+        return blendNode;
     }
 
-    bool ApiObjects::destroy(LogicObject& object, ErrorReporting& errorReporting)
+    void ApiObjects::reserve(size_t objectCount, size_t nodeCount)
     {
-        auto luaScript = dynamic_cast<LuaScript*>(&object);
-        if (luaScript)
-            return destroyInternal(*luaScript, errorReporting);
-
-        auto luaInterface = dynamic_cast<LuaInterface*>(&object);
-        if (luaInterface)
-            return destroyInternal(*luaInterface, errorReporting);
-
-        auto luaModule = dynamic_cast<LuaModule*>(&object);
-        if (luaModule)
-            return destroyInternal(*luaModule, errorReporting);
-
-        auto ramsesNodeBinding = dynamic_cast<RamsesNodeBinding*>(&object);
-        if (ramsesNodeBinding)
-            return destroyInternal(*ramsesNodeBinding, errorReporting);
-
-        auto ramsesAppearanceBinding = dynamic_cast<RamsesAppearanceBinding*>(&object);
-        if (ramsesAppearanceBinding)
-            return destroyInternal(*ramsesAppearanceBinding, errorReporting);
-
-        auto ramsesCameraBinding = dynamic_cast<RamsesCameraBinding*>(&object);
-        if (ramsesCameraBinding)
-            return destroyInternal(*ramsesCameraBinding, errorReporting);
-
-        auto ramsesRenderPassBinding = dynamic_cast<RamsesRenderPassBinding*>(&object);
-        if (ramsesRenderPassBinding)
-            return destroyInternal(*ramsesRenderPassBinding, errorReporting);
-
-        auto ramsesRenderGroupBinding = dynamic_cast<RamsesRenderGroupBinding*>(&object);
-        if (ramsesRenderGroupBinding)
-            return destroyInternal(*ramsesRenderGroupBinding, errorReporting);
-
-        auto ramsesMeshNodeBinding = dynamic_cast<RamsesMeshNodeBinding*>(&object);
-        if (ramsesMeshNodeBinding)
-            return destroyInternal(*ramsesMeshNodeBinding, errorReporting);
-
-        auto skinBinding = dynamic_cast<SkinBinding*>(&object);
-        if (skinBinding)
-            return destroyInternal(*skinBinding, errorReporting);
-
-        auto animNode = dynamic_cast<AnimationNode*>(&object);
-        if (animNode)
-            return destroyInternal(*animNode, errorReporting);
-
-        auto dataArray = dynamic_cast<DataArray*>(&object);
-        if (dataArray)
-            return destroyInternal(*dataArray, errorReporting);
-
-        auto timer = dynamic_cast<TimerNode*>(&object);
-        if (timer)
-            return destroyInternal(*timer, errorReporting);
-
-        auto anchor = dynamic_cast<AnchorPoint*>(&object);
-        if (anchor)
-            return destroyInternal(*anchor, errorReporting);
-
-        errorReporting.add(fmt::format("Tried to destroy object '{}' with unknown type", object.getName()), &object, EErrorType::IllegalArgument);
+        assert(nodeCount <= objectCount);
+        if (objectCount <= m_logicObjects.size())
+            return;
+
+        m_objectsOwningContainer.reserve(objectCount);
+        m_logicObjects.reserve(objectCount);
+        m_logicObjectIdMapping.reserve(objectCount);
+        m_nameIndex.reserve(objectCount);
+        m_reverseImplMapping.reserve(nodeCount);
+        m_logicNodeDependencies.reserve(nodeCount);
+    }
 
-        return false;
+    void ApiObjects::registerLogicNode(LogicNode& logicNode)
+    {
+        m_reverseImplMapping.emplace(std::make_pair(&logicNode.m_impl, &logicNode));
+        m_logicNodeDependencies.addNode(logicNode.m_impl);
     }
 
-    bool ApiObjects::destroyInternal(DataArray& dataArray, ErrorReporting& errorReporting)
+    namespace
     {
-        const auto it = std::find(m_dataArrays.cbegin(), m_dataArrays.cend(), &dataArray);
-        if (it == m_dataArrays.cend())
+        constexpr bool IsLogicNodeType(ELogicObjectType type)
         {
-            errorReporting.add("Can't find data array in logic engine!", &dataArray, EErrorType::IllegalArgument);
-            return false;
+            return type != ELogicObjectType::LuaModule && type != ELogicObjectType::DataArray && type != ELogicObjectType::Unknown;
         }
-        for (const auto& animNode : m_animationNodes)
+
+        const char* GetNotFoundErrorMessage(ELogicObjectType type)
         {
-            for (const auto& channel : animNode->getChannels())
+            switch (type)
             {
-                if (channel.timeStamps == &dataArray ||
-                    channel.keyframes == &dataArray ||
-                    channel.tangentsIn == &dataArray ||
-                    channel.tangentsOut == &dataArray)
-                {
-                    errorReporting.add(fmt::format("Failed to destroy data array '{}', it is used in animation node '{}' channel '{}'", dataArray.getName(), animNode->getName(), channel.name), &dataArray, EErrorType::IllegalArgument);
-                    return false;
-                }
+            case ELogicObjectType::LuaScript:
+                return "Can't find script in logic engine!";
+            case ELogicObjectType::LuaInterface:
+                return "Can't find interface in logic engine!";
+            case ELogicObjectType::LuaModule:
+                return "Can't find Lua module in logic engine!";
+            case ELogicObjectType::RamsesNodeBinding:
+                return "Can't find RamsesNodeBinding in logic engine!";
+            case ELogicObjectType::RamsesAppearanceBinding:
+                return "Can't find RamsesAppearanceBinding in logic engine!";
+            case ELogicObjectType::RamsesCameraBinding:
+                return "Can't find RamsesCameraBinding in logic engine!";
+            case ELogicObjectType::RamsesRenderPassBinding:
+                return "Can't find RamsesRenderPassBinding in logic engine!";
+            case ELogicObjectType::RamsesRenderGroupBinding:
+                return "Can't find RamsesRenderGroupBinding in logic engine!";
+            case ELogicObjectType::RamsesMeshNodeBinding:
+                return "Can't find RamsesMeshNodeBinding in logic engine!";
+            case ELogicObjectType::SkinBinding:
+                return "Can't find SkinBinding in logic engine!";
+            case ELogicObjectType::DataArray:
+                return "Can't find data array in logic engine!";
+            case ELogicObjectType::AnimationNode:
+                return "Can't find AnimationNode in logic engine!";
+            case ELogicObjectType::TimerNode:
+                return "Can't find TimerNode in logic engine!";
+            case ELogicObjectType::AnchorPoint:
+                return "Can't find AnchorPoint in logic engine!";
+            case ELogicObjectType::AnimationBlendNode:
+                return "Can't find AnimationBlendNode in logic engine!";
+            case ELogicObjectType::Unknown:
+            case ELogicObjectType::Count:
+                break;
             }
+            assert(false);
+            return "";
         }
-        unregisterLogicObject(dataArray);
-        m_dataArrays.erase(it);
-        return true;
-    }
 
-    bool ApiObjects::destroyInternal(LuaScript& luaScript, ErrorReporting& errorReporting)
-    {
-        auto scriptIter = std::find(m_scripts.begin(), m_scripts.end(), &luaScript);
-        if (scriptIter == m_scripts.end())
+        // Removes destroyed objects keeping order of remaining ones, single object is searched from the back
+        // because objects are usually destroyed in reverse order of their creation
+        template <typename T, typename IsDestroyedFunc>
+        void EraseObjects(std::vector<T>& container, size_t destroyedCount, const IsDestroyedFunc& isDestroyed)
         {
-            errorReporting.add("Can't find script in logic engine!", &luaScript, EErrorType::IllegalArgument);
-            return false;
-        }
+            if (destroyedCount == 0u)
+                return;
 
-        unregisterLogicObject(luaScript);
-        m_scripts.erase(scriptIter);
-        return true;
+            if (destroyedCount == 1u)
+            {
+                const auto it = std::find_if(container.rbegin(), container.rend(), isDestroyed);
+                assert(it != container.rend());
+                container.erase(std::next(it).base());
+                return;
+            }
+
+            container.erase(std::remove_if(container.begin(), container.end(), isDestroyed), container.end());
+        }
     }
 
-    bool ApiObjects::destroyInternal(LuaInterface& luaInterface, ErrorReporting& errorReporting)
+    bool ApiObjects::checkObjectToDestroyIsValid(const LogicObject* object, ErrorReporting& errorReporting) const
     {
-        auto interfaceIter = std::find(m_interfaces.begin(), m_interfaces.end(), &luaInterface);
-        if (interfaceIter == m_interfaces.end())
+        if (object == nullptr)
         {
-            errorReporting.add("Can't find interface in logic engine!", &luaInterface, EErrorType::IllegalArgument);
+            errorReporting.add("Tried to destroy null object", nullptr, EErrorType::IllegalArgument);
             return false;
         }
 
-        unregisterLogicObject(luaInterface);
-        m_interfaces.erase(interfaceIter);
-        return true;
-    }
-
-    bool ApiObjects::destroyInternal(LuaModule& luaModule, ErrorReporting& errorReporting)
-    {
-        const auto it = std::find(m_luaModules.cbegin(), m_luaModules.cend(), &luaModule);
-        if (it == m_luaModules.cend())
+        const ELogicObjectType type = object->m_impl->getObjectType();
+        if (type == ELogicObjectType::Unknown)
         {
-            errorReporting.add("Can't find Lua module in logic engine!", &luaModule, EErrorType::IllegalArgument);
+            errorReporting.add(fmt::format("Tried to destroy object '{}' with unknown type", object->getName()), object, EErrorType::IllegalArgument);
             return false;
         }
-        for (const auto& script : m_scripts)
+
+        if (getApiObjectById(object->getId()) != object)
         {
-            for (const auto& moduleInUse : script->m_script.getModules())
-            {
-                if (moduleInUse.second == &luaModule)
-                {
-                    errorReporting.add(fmt::format("Failed to destroy LuaModule '{}', it is used in LuaScript '{}'", luaModule.getName(), script->getName()), &luaModule, EErrorType::IllegalArgument);
-                    return false;
-                }
-            }
+            errorReporting.add(GetNotFoundErrorMessage(type), object, EErrorType::IllegalArgument);
+            return false;
         }
 
-        unregisterLogicObject(luaModule);
-        m_luaModules.erase(it);
         return true;
     }
 
-    bool ApiObjects::destroyInternal(RamsesNodeBinding& ramsesNodeBinding, ErrorReporting& errorReporting)
+    bool ApiObjects::destroy(LogicObject& object, ErrorReporting& errorReporting)
     {
-        auto nodeIter = std::find(m_ramsesNodeBindings.begin(), m_ramsesNodeBindings.end(), &ramsesNodeBinding);
-        if (nodeIter == m_ramsesNodeBindings.end())
-        {
-            errorReporting.add("Can't find RamsesNodeBinding in logic engine!", &ramsesNodeBinding, EErrorType::IllegalArgument);
-            return false;
-        }
+        return destroy(std::vector<LogicObject*>{ &object }, errorReporting);
+    }
 
-        for (const auto& anchor : m_anchorPoints)
-        {
-            if (anchor->m_anchorPointImpl.getRamsesNodeBinding().getId() == ramsesNodeBinding.getId())
-            {
-                errorReporting.add(fmt::format("Failed to destroy Ramses node binding '{}', it is used in anchor point '{}'", ramsesNodeBinding.getName(), anchor->getName()), &ramsesNodeBinding, EErrorType::Other);
+    bool ApiObjects::destroy(const std::vector<LogicObject*>& objects, ErrorReporting& errorReporting)
+    {
+        std::unordered_set<const LogicObject*> destroyedObjects;
+        destroyedObjects.reserve(objects.size());
+        std::vector<LogicObject*> uniqueObjects;
+        uniqueObjects.reserve(objects.size());
+        ObjectTypeCounts destroyedCounts{};
+        for (LogicObject* object : objects)
+        {
+            if (!checkObjectToDestroyIsValid(object, errorReporting))
                 return false;
-            }
-        }
 
-        for (const auto& skin : m_skinBindings)
-        {
-            for (const auto node : skin->m_skinBinding.getJoints())
+            if (destroyedObjects.insert(object).second)
             {
-                if (node->getId() == ramsesNodeBinding.getId())
-                {
-                    errorReporting.add(fmt::format("Failed to destroy Ramses node binding '{}', it is used in skin binding '{}'", ramsesNodeBinding.getName(), skin->getName()), &ramsesNodeBinding, EErrorType::Other);
-                    return false;
-                }
+                uniqueObjects.push_back(object);
+                ++destroyedCounts[static_cast<size_t>(object->m_impl->getObjectType())];
             }
         }
 
-        unregisterLogicObject(ramsesNodeBinding);
-        m_ramsesNodeBindings.erase(nodeIter);
-
-        return true;
-    }
+        if (uniqueObjects.empty())
+            return true;
 
-    bool ApiObjects::destroyInternal(RamsesAppearanceBinding& ramsesAppearanceBinding, ErrorReporting& errorReporting)
-    {
-        auto appearanceIter = std::find(m_ramsesAppearanceBindings.begin(), m_ramsesAppearanceBindings.end(), &ramsesAppearanceBinding);
-        if (appearanceIter == m_ramsesAppearanceBindings.end())
-        {
-            errorReporting.add("Can't find RamsesAppearanceBinding in logic engine!", &ramsesAppearanceBinding, EErrorType::IllegalArgument);
+        if (!checkObjectsCanBeDestroyed(destroyedObjects, destroyedCounts, errorReporting))
             return false;
-        }
 
-        for (const auto& skin : m_skinBindings)
+        // remove dependencies while all objects are still alive
+        for (LogicObject* object : uniqueObjects)
         {
-            if (skin->m_skinBinding.getAppearanceBinding().getId() == ramsesAppearanceBinding.getId())
+            switch (object->m_impl->getObjectType())
             {
-                errorReporting.add(fmt::format("Failed to destroy Ramses appearance binding '{}', it is used in skin binding '{}'", ramsesAppearanceBinding.getName(), skin->getName()), &ramsesAppearanceBinding, EErrorType::Other);
-                return false;
+            case ELogicObjectType::AnchorPoint:
+            {
+                auto& anchor = static_cast<AnchorPoint&>(*object);
+                m_logicNodeDependencies.removeBindingDependency(anchor.m_anchorPointImpl.getRamsesNodeBinding(), anchor.m_impl);
+                m_logicNodeDependencies.removeBindingDependency(anchor.m_anchorPointImpl.getRamsesCameraBinding(), anchor.m_impl);
+                break;
+            }
+            case ELogicObjectType::AnimationBlendNode:
+            {
+                auto& blendNode = static_cast<AnimationBlendNode&>(*object);
+                for (auto* source : blendNode.m_animationBlendNodeImpl.getSources())
+                {
+                    source->removeDependentNode(blendNode.m_impl);
+                    m_logicNodeDependencies.removeNodeDependency(*source, blendNode.m_impl);
+                }
+                break;
+            }
+            default:
+                break;
             }
         }
 
-        unregisterLogicObject(ramsesAppearanceBinding);
-        m_ramsesAppearanceBindings.erase(appearanceIter);
-
-        return true;
-    }
+        if (destroyedCounts[static_cast<size_t>(ELogicObjectType::SkinBinding)] != 0u)
+            m_skinningBatch.invalidate();
 
-    bool ApiObjects::destroyInternal(RamsesCameraBinding& ramsesCameraBinding, ErrorReporting& errorReporting)
-    {
-        auto cameraIter = std::find(m_ramsesCameraBindings.begin(), m_ramsesCameraBindings.end(), &ramsesCameraBinding);
-        if (cameraIter == m_ramsesCameraBindings.end())
-        {
-            errorReporting.add("Can't find RamsesCameraBinding in logic engine!", &ramsesCameraBinding, EErrorType::IllegalArgument);
-            return false;
-        }
+        if (uniqueObjects.size() == 1u)
+            m_nameIndex.remove(*uniqueObjects.front());
+        else
+            m_nameIndex.remove(destroyedObjects);
 
-        for (const auto& anchor : m_anchorPoints)
+        NodeSet destroyedNodes;
+        for (LogicObject* object : uniqueObjects)
         {
-            if (anchor->m_anchorPointImpl.getRamsesCameraBinding().getId() == ramsesCameraBinding.getId())
+            if (IsLogicNodeType(object->m_impl->getObjectType()))
             {
-                errorReporting.add(fmt::format("Failed to destroy Ramses camera binding '{}', it is used in anchor point '{}'", ramsesCameraBinding.getName(), anchor->getName()), &ramsesCameraBinding, EErrorType::Other);
-                return false;
+                LogicNodeImpl& logicNodeImpl = static_cast<LogicNode&>(*object).m_impl;
+                m_reverseImplMapping.erase(&logicNodeImpl);
+                if (uniqueObjects.size() == 1u)
+                    m_logicNodeDependencies.removeNode(logicNodeImpl);
+                else
+                    destroyedNodes.insert(&logicNodeImpl);
+            }
+            m_logicObjectIdMapping.erase(object->getId());
+        }
+        if (!destroyedNodes.empty())
+            m_logicNodeDependencies.removeNodes(destroyedNodes);
+
+        const auto isDestroyed = [&destroyedObjects](const LogicObject* obj) { return destroyedObjects.count(obj) != 0u; };
+        const auto countOf = [&destroyedCounts](ELogicObjectType type) { return destroyedCounts[static_cast<size_t>(type)]; };
+        EraseObjects(m_scripts, countOf(ELogicObjectType::LuaScript), isDestroyed);
+        EraseObjects(m_interfaces, countOf(ELogicObjectType::LuaInterface), isDestroyed);
+        EraseObjects(m_luaModules, countOf(ELogicObjectType::LuaModule), isDestroyed);
+        EraseObjects(m_ramsesNodeBindings, countOf(ELogicObjectType::RamsesNodeBinding), isDestroyed);
+        EraseObjects(m_ramsesAppearanceBindings, countOf(ELogicObjectType::RamsesAppearanceBinding), isDestroyed);
+        EraseObjects(m_ramsesCameraBindings, countOf(ELogicObjectType::RamsesCameraBinding), isDestroyed);
+        EraseObjects(m_ramsesRenderPassBindings, countOf(ELogicObjectType::RamsesRenderPassBinding), isDestroyed);
+        EraseObjects(m_ramsesRenderGroupBindings, countOf(ELogicObjectType::RamsesRenderGroupBinding), isDestroyed);
+        EraseObjects(m_ramsesMeshNodeBindings, countOf(ELogicObjectType::RamsesMeshNodeBinding), isDestroyed);
+        EraseObjects(m_skinBindings, countOf(ELogicObjectType::SkinBinding), isDestroyed);
+        EraseObjects(m_dataArrays, countOf(ELogicObjectType::DataArray), isDestroyed);
+        EraseObjects(m_animationNodes, countOf(ELogicObjectType::AnimationNode), isDestroyed);
+        EraseObjects(m_timerNodes, countOf(ELogicObjectType::TimerNode), isDestroyed);
+        EraseObjects(m_anchorPoints, countOf(ELogicObjectType::AnchorPoint), isDestroyed);
+        EraseObjects(m_animationBlendNodes, countOf(ELogicObjectType::AnimationBlendNode), isDestroyed);
+        EraseObjects(m_logicObjects, uniqueObjects.size(), isDestroyed);
+
+        // take ownership of destroyed objects first and delete them in reverse order of their creation
+        ApiObjectOwningContainer objectsToDelete;
+        objectsToDelete.reserve(uniqueObjects.size());
+        if (uniqueObjects.size() == 1u)
+        {
+            const auto it = std::find_if(m_objectsOwningContainer.rbegin(), m_objectsOwningContainer.rend(), [&](const auto& obj) { return obj.get() == uniqueObjects.front(); });
+            assert(it != m_objectsOwningContainer.rend() && "Can't find LogicObject in owned objects!");
+            objectsToDelete.push_back(std::move(*it));
+            m_objectsOwningContainer.erase(std::next(it).base());
+        }
+        else
+        {
+            size_t remainingCount = 0u;
+            for (size_t i = 0u; i < m_objectsOwningContainer.size(); ++i)
+            {
+                auto& obj = m_objectsOwningContainer[i];
+                if (isDestroyed(obj.get()))
+                {
+                    objectsToDelete.push_back(std::move(obj));
+                    continue;
+                }
+                if (i != remainingCount)
+                    m_objectsOwningContainer[remainingCount] = std::move(obj);
+                ++remainingCount;
             }
+            m_objectsOwningContainer.resize(remainingCount);
         }
-
-        unregisterLogicObject(ramsesCameraBinding);
-        m_ramsesCameraBindings.erase(cameraIter);
+        assert(objectsToDelete.size() == uniqueObjects.size());
+        while (!objectsToDelete.empty())
+            objectsToDelete.pop_back();
 
         return true;
     }
 
-    bool ApiObjects::destroyInternal(RamsesRenderPassBinding& ramsesRenderPassBinding, ErrorReporting& errorReporting)
+    bool ApiObjects::checkObjectsCanBeDestroyed(const std::unordered_set<const LogicObject*>& destroyedObjects, const ObjectTypeCounts& destroyedCounts, ErrorReporting& errorReporting) const
     {
-        assert(m_featureLevel >= EFeatureLevel_02);
-        auto bindingIter = std::find(m_ramsesRenderPassBindings.begin(), m_ramsesRenderPassBindings.end(), &ramsesRenderPassBinding);
-        if (bindingIter == m_ramsesRenderPassBindings.end())
-        {
-            errorReporting.add("Can't find RamsesRenderPassBinding in logic engine!", &ramsesRenderPassBinding, EErrorType::IllegalArgument);
-            return false;
-        }
-
-        unregisterLogicObject(ramsesRenderPassBinding);
-        m_ramsesRenderPassBindings.erase(bindingIter);
-
-        return true;
-    }
+        // objects can be destroyed only if no remaining object uses them, objects destroyed together can use each other
+        const auto isDestroyed = [&destroyedObjects](const LogicObject* obj) { return destroyedObjects.count(obj) != 0u; };
+        const auto isAnyDestroyed = [&destroyedCounts](ELogicObjectType type) { return destroyedCounts[static_cast<size_t>(type)] != 0u; };
 
-    bool ApiObjects::destroyInternal(RamsesRenderGroupBinding& ramsesRenderGroupBinding, ErrorReporting& errorReporting)
-    {
-        assert(m_featureLevel >= EFeatureLevel_03);
-        auto bindingIter = std::find(m_ramsesRenderGroupBindings.begin(), m_ramsesRenderGroupBindings.end(), &ramsesRenderGroupBinding);
-        if (bindingIter == m_ramsesRenderGroupBindings.end())
+        if (isAnyDestroyed(ELogicObjectType::LuaModule))
         {
-            errorReporting.add("Can't find RamsesRenderGroupBinding in logic engine!", &ramsesRenderGroupBinding, EErrorType::IllegalArgument);
-            return false;
+            for (const auto* script : m_scripts)
+            {
+                if (isDestroyed(script))
+                    continue;
+                for (const auto& moduleInUse : script->m_script.getModules())
+                {
+                    if (isDestroyed(moduleInUse.second))
+                    {
+                        errorReporting.add(fmt::format("Failed to destroy LuaModule '{}', it is used in LuaScript '{}'", moduleInUse.second->getName(), script->getName()), moduleInUse.second, EErrorType::IllegalArgument);
+                        return false;
+                    }
+                }
+            }
         }
 
-        unregisterLogicObject(ramsesRenderGroupBinding);
-        m_ramsesRenderGroupBindings.erase(bindingIter);
-
-        return true;
-    }
-
-    bool ApiObjects::destroyInternal(RamsesMeshNodeBinding& ramsesMeshNodeBinding, ErrorReporting& errorReporting)
-    {
-        assert(m_featureLevel >= EFeatureLevel_05);
-        auto bindingIter = std::find(m_ramsesMeshNodeBindings.begin(), m_ramsesMeshNodeBindings.end(), &ramsesMeshNodeBinding);
-        if (bindingIter == m_ramsesMeshNodeBindings.end())
+        if (isAnyDestroyed(ELogicObjectType::RamsesNodeBinding))
         {
-            errorReporting.add("Can't find RamsesMeshNodeBinding in logic engine!", &ramsesMeshNodeBinding, EErrorType::IllegalArgument);
-            return false;
-        }
-
-        unregisterLogicObject(ramsesMeshNodeBinding);
-        m_ramsesMeshNodeBindings.erase(bindingIter);
+            for (const auto* anchor : m_anchorPoints)
+            {
+                const LogicObject& nodeBinding = anchor->m_anchorPointImpl.getRamsesNodeBinding().getLogicObject();
+                if (!isDestroyed(anchor) && isDestroyed(&nodeBinding))
+                {
+                    errorReporting.add(fmt::format("Failed to destroy Ramses node binding '{}', it is used in anchor point '{}'", nodeBinding.getName(), anchor->getName()), &nodeBinding, EErrorType::Other);
+                    return false;
+                }
+            }
 
-        return true;
-    }
+            for (const auto* skin : m_skinBindings)
+            {
+                if (isDestroyed(skin))
+                    continue;
+                for (const auto* joint : skin->m_skinBinding.getJoints())
+                {
+                    const LogicObject& nodeBinding = joint->getLogicObject();
+                    if (isDestroyed(&nodeBinding))
+                    {
+                        errorReporting.add(fmt::format("Failed to destroy Ramses node binding '{}', it is used in skin binding '{}'", nodeBinding.getName(), skin->getName()), &nodeBinding, EErrorType::Other);
+                        return false;
+                    }
+                }
+            }
+        }
 
-    bool ApiObjects::destroyInternal(SkinBinding& skinBinding, ErrorReporting& errorReporting)
-    {
-        assert(m_featureLevel >= EFeatureLevel_04);
-        auto bindingIter = std::find(m_skinBindings.begin(), m_skinBindings.end(), &skinBinding);
-        if (bindingIter == m_skinBindings.end())
+        if (isAnyDestroyed(ELogicObjectType::RamsesAppearanceBinding))
         {
-            errorReporting.add("Can't find SkinBinding in logic engine!", &skinBinding, EErrorType::IllegalArgument);
-            return false;
+            for (const auto* skin : m_skinBindings)
+            {
+                const LogicObject& appearanceBinding = skin->m_skinBinding.getAppearanceBinding().getLogicObject();
+                if (!isDestroyed(skin) && isDestroyed(&appearanceBinding))
+                {
+                    errorReporting.add(fmt::format("Failed to destroy Ramses appearance binding '{}', it is used in skin binding '{}'", appearanceBinding.getName(), skin->getName()), &appearanceBinding, EErrorType::Other);
+                    return false;
+                }
+            }
         }
 
-        unregisterLogicObject(skinBinding);
-        m_skinBindings.erase(bindingIter);
-
-        return true;
-    }
-
-    bool ApiObjects::destroyInternal(AnimationNode& node, ErrorReporting& errorReporting)
-    {
-        auto nodeIt = std::find(m_animationNodes.begin(), m_animationNodes.end(), &node);
-        if (nodeIt == m_animationNodes.end())
+        if (isAnyDestroyed(ELogicObjectType::RamsesCameraBinding))
         {
-            errorReporting.add("Can't find AnimationNode in logic engine!", &node, EErrorType::IllegalArgument);
-            return false;
+            for (const auto* anchor : m_anchorPoints)
+            {
+                const LogicObject& cameraBinding = anchor->m_anchorPointImpl.getRamsesCameraBinding().getLogicObject();
+                if (!isDestroyed(anchor) && isDestroyed(&cameraBinding))
+                {
+                    errorReporting.add(fmt::format("Failed to destroy Ramses camera binding '{}', it is used in anchor point '{}'", cameraBinding.getName(), anchor->getName()), &cameraBinding, EErrorType::Other);
+                    return false;
+                }
+            }
         }
 
-        unregisterLogicObject(node);
-        m_animationNodes.erase(nodeIt);
-
-        return true;
-    }
-
-    bool ApiObjects::destroyInternal(TimerNode& node, ErrorReporting& errorReporting)
-    {
-        auto nodeIt = std::find(m_timerNodes.begin(), m_timerNodes.end(), &node);
-        if (nodeIt == m_timerNodes.end())
+        if (isAnyDestroyed(ELogicObjectType::DataArray))
         {
-            errorReporting.add("Can't find TimerNode in logic engine!", &node, EErrorType::IllegalArgument);
-            return false;
+            for (const auto* animNode : m_animationNodes)
+            {
+                if (isDestroyed(animNode))
+                    continue;
+                for (const auto& channel : animNode->getChannels())
+                {
+                    for (const DataArray* dataArray : { channel.timeStamps, channel.keyframes, channel.tangentsIn, channel.tangentsOut })
+                    {
+                        if (dataArray && isDestroyed(dataArray))
+                        {
+                            errorReporting.add(fmt::format("Failed to destroy data array '{}', it is used in animation node '{}' channel '{}'", dataArray->getName(), animNode->getName(), channel.name), dataArray, EErrorType::IllegalArgument);
+                            return false;
+                        }
+                    }
+                }
+            }
         }
 
-        unregisterLogicObject(node);
-        m_timerNodes.erase(nodeIt);
-
-        return true;
-    }
-
-    bool ApiObjects::destroyInternal(AnchorPoint& node, ErrorReporting& errorReporting)
-    {
-        assert(m_featureLevel >= EFeatureLevel_02);
-        auto nodeIt = std::find(m_anchorPoints.begin(), m_anchorPoints.end(), &node);
-        if (nodeIt == m_anchorPoints.end())
+        if (isAnyDestroyed(ELogicObjectType::AnimationNode))
         {
-            errorReporting.add("Can't find AnchorPoint in logic engine!", &node, EErrorType::IllegalArgument);
-            return false;
+            for (const auto* blendNode : m_animationBlendNodes)
+            {
+                if (isDestroyed(blendNode))
+                    continue;
+                for (const auto* source : blendNode->m_animationBlendNodeImpl.getSources())
+                {
+                    const LogicObject& animNode = source->getLogicObject();
+                    if (isDestroyed(&animNode))
+                    {
+                        errorReporting.add(fmt::format("Failed to destroy animation node '{}', it is used in animation blend node '{}'", animNode.getName(), blendNode->getName()), &animNode, EErrorType::IllegalArgument);
+                        return false;
+                    }
+                }
+            }
         }
 
-        m_logicNodeDependencies.removeBindingDependency(node.m_anchorPointImpl.getRamsesNodeBinding(), node.m_impl);
-        m_logicNodeDependencies.removeBindingDependency(node.m_anchorPointImpl.getRamsesCameraBinding(), node.m_impl);
-
-        unregisterLogicObject(node);
-        m_anchorPoints.erase(nodeIt);
-
         return true;
     }
 
-    void ApiObjects::registerLogicObject(std::unique_ptr<LogicObject> obj)
+    template <typename T>
+    void ApiObjects::registerLogicObject(std::unique_ptr<T> obj)
     {
-        m_logicObjects.push_back(obj.get());
-        obj->m_impl->setLogicObject(*obj);
-
-        auto logicNode = dynamic_cast<LogicNode*>(obj.get());
-        if (logicNode)
-            registerLogicNode(*logicNode);
-
-        m_logicObjectIdMapping.emplace(obj->getId(), obj.get());
-        m_objectsOwningContainer.push_back(move(obj));
+        static_assert(LogicObjectTypeOf<T> != ELogicObjectType::Unknown, "Unknown logic object type");
+        LogicObject& logicObject = *obj;
+        logicObject.m_impl->setObjectType(LogicObjectTypeOf<T>);
+        logicObject.m_impl->setLogicObject(logicObject);
+        logicObject.m_impl->setNameIndex(&m_nameIndex);
+        m_nameIndex.add(logicObject);
+        m_logicObjects.push_back(&logicObject);
+
+        if constexpr (std::is_base_of_v<LogicNode, T>)
+            registerLogicNode(*obj);
+
+        m_logicObjectIdMapping.emplace(logicObject.getId(), &logicObject);
+        m_objectsOwningContainer.push_back(std::move(obj));
     }
 
-    void ApiObjects::unregisterLogicObject(LogicObject& objToDelete)
+    template <typename T>
+    void ApiObjects::registerDeserializedLogicObject(std::unique_ptr<T> obj, const DeserializationMap& deserializationMap)
     {
-        const auto findOwnedObj = std::find_if(m_objectsOwningContainer.cbegin(), m_objectsOwningContainer.cend(), [&](const auto& obj) { return obj.get() == &objToDelete; });
-        assert(findOwnedObj != m_objectsOwningContainer.cend() && "Can't find LogicObject in owned objects!");
-
-        const auto findLogicNode = std::find(m_logicObjects.cbegin(), m_logicObjects.cend(), &objToDelete);
-        assert(findLogicNode != m_logicObjects.cend() && "Can't find LogicObject in logic objects!");
-
-        auto logicNode = dynamic_cast<LogicNode*>(&objToDelete);
-        if (logicNode)
-            unregisterLogicNode(*logicNode);
-
-        m_logicObjectIdMapping.erase(objToDelete.getId());
-        m_objectsOwningContainer.erase(findOwnedObj);
-        m_logicObjects.erase(findLogicNode);
+        LogicObject& logicObject = *obj;
+        logicObject.m_impl->setId(deserializationMap.remapId(logicObject.getId()));
+        registerLogicObject(std::move(obj));
     }
 
     bool ApiObjects::checkBindingsReferToSameRamsesScene(ErrorReporting& errorReporting) const
@@ -981,6 +1015,10 @@ namespace rlogic::internal
         {
             return m_anchorPoints;
         }
+        else if constexpr (std::is_same_v<T, AnimationBlendNode>)
+        {
+            return m_animationBlendNodes;
+        }
     }
 
     template <typename T>
@@ -1005,6 +1043,16 @@ namespace rlogic::internal
         return m_logicNodeDependencies;
     }
 
+    SkinningBatch& ApiObjects::getSkinningBatch()
+    {
+        return m_skinningBatch;
+    }
+
+    CameraViewProjectionCache& ApiObjects::getCameraViewProjectionCache()
+    {
+        return m_cameraViewProjectionCache;
+    }
+
     LogicNode* ApiObjects::getApiObject(LogicNodeImpl& impl) const
     {
         auto apiObjectIter = m_reverseImplMapping.find(&impl);
@@ -1012,6 +1060,11 @@ namespace rlogic::internal
         return apiObjectIter->second;
     }
 
+    const LogicObjectNameIndex& ApiObjects::getNameIndex() const
+    {
+        return m_nameIndex;
+    }
+
     LogicObject* ApiObjects::getApiObjectById(uint64_t id) const
     {
         auto apiObjectIter = m_logicObjectIdMapping.find(id);
@@ -1132,6 +1185,13 @@ namespace rlogic::internal
             skinBindings.push_back(SkinBindingImpl::Serialize(skinBinding->m_skinBinding, builder, serializationMap, apiObjects.m_featureLevel));
         assert(apiObjects.m_featureLevel >= EFeatureLevel_04 || skinBindings.empty());
 
+        // animation blend nodes must go after animation nodes because they reference them
+        std::vector<flatbuffers::Offset<rlogic_serialization::AnimationBlendNode>> animationBlendNodes;
+        animationBlendNodes.reserve(apiObjects.m_animationBlendNodes.size());
+        for (const auto& blendNode : apiObjects.m_animationBlendNodes)
+            animationBlendNodes.push_back(AnimationBlendNodeImpl::Serialize(blendNode->m_animationBlendNodeImpl, builder, serializationMap, apiObjects.m_featureLevel));
+        assert(apiObjects.m_featureLevel >= EFeatureLevel_06 || animationBlendNodes.empty());
+
         // links must go last due to dependency on serialized properties
         const auto collectedLinks = apiObjects.collectPropertyLinks();
         std::vector<flatbuffers::Offset<rlogic_serialization::Link>> links;
@@ -1159,6 +1219,7 @@ namespace rlogic::internal
         const auto fbRenderGroupBindings = builder.CreateVector(ramsesRenderGroupBindings);
         const auto fbMeshNodeBindings = builder.CreateVector(ramsesMeshNodeBindings);
         const auto fbSkinBindings = builder.CreateVector(skinBindings);
+        const auto fbAnimationBlendNodes = builder.CreateVector(animationBlendNodes);
 
         const auto logicEngine = rlogic_serialization::CreateApiObjects(
             builder,
@@ -1177,7 +1238,8 @@ namespace rlogic::internal
             fbAnchorPoints,
             fbRenderGroupBindings,
             fbSkinBindings,
-            fbMeshNodeBindings
+            fbMeshNodeBindings,
+            fbAnimationBlendNodes
             );
 
         builder.Finish(logicEngine);
@@ -1190,7 +1252,8 @@ namespace rlogic::internal
         const IRamsesObjectResolver* ramsesResolver,
         const std::string& dataSourceDescription,
         ErrorReporting& errorReporting,
-        EFeatureLevel featureLevel)
+        EFeatureLevel featureLevel,
+        const DeserializationOptions& options)
     {
         // Collect data here, only return if no error occurred
         auto deserialized = std::make_unique<ApiObjects>(featureLevel);
@@ -1198,97 +1261,250 @@ namespace rlogic::internal
         // Collect deserialized object mappings to resolve dependencies
         DeserializationMap deserializationMap;
 
-        if (!apiObjects.luaModules())
-        {
-            errorReporting.add("Fatal error during loading from serialized data: missing Lua modules container!", nullptr, EErrorType::BinaryVersionMismatch);
+        if (!deserialized->deserializeObjects(apiObjects, ramsesResolver, dataSourceDescription, errorReporting, options, deserializationMap, nullptr))
             return nullptr;
-        }
 
-        if (!apiObjects.luaScripts())
+        return deserialized;
+    }
+
+    std::optional<uint64_t> ApiObjects::deserializePackage(
+        const rlogic_serialization::ApiObjects& apiObjects,
+        const IRamsesObjectResolver* ramsesResolver,
+        const std::string& dataSourceDescription,
+        ErrorReporting& errorReporting,
+        const DeserializationOptions& options)
+    {
+        // IDs of loaded objects are offset by last used ID, so that they follow IDs of existing objects
+        const uint64_t idOffset = m_lastObjectId;
+        if (apiObjects.lastObjectId() > std::numeric_limits<uint64_t>::max() - idOffset)
         {
-            errorReporting.add("Fatal error during loading from serialized data: missing Lua scripts container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            errorReporting.add(fmt::format("Failed to load {} additively, object IDs exceed the range of IDs!", dataSourceDescription), nullptr, EErrorType::ContentStateError);
+            return std::nullopt;
         }
 
-        if (!apiObjects.luaInterfaces())
+        // loaded nodes are linked only among each other, if the existing nodes are sorted already,
+        // only loaded nodes are sorted and appended to the existing order
+        const bool existingNodesSorted = m_logicNodeDependencies.isTopologyCacheValid();
+
+        const size_t existingObjectsCount = m_logicObjects.size();
+        DeserializationMap deserializationMap{ idOffset };
+        LoadedPackage package;
+        if (!deserializeObjects(apiObjects, ramsesResolver, dataSourceDescription, errorReporting, options, deserializationMap, &package.sharedModuleIds))
         {
-            errorReporting.add("Fatal error during loading from serialized data: missing Lua interfaces container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            // remove everything loaded so far
+            const std::vector<LogicObject*> loadedObjects(m_logicObjects.cbegin() + static_cast<std::ptrdiff_t>(existingObjectsCount), m_logicObjects.cend());
+            [[maybe_unused]] const bool destroyed = destroy(loadedObjects, errorReporting);
+            assert(destroyed);
+            // IDs reserved for the loaded objects are released, next created object follows existing objects again
+            m_lastObjectId = idOffset;
+            return std::nullopt;
         }
 
-        if (!apiObjects.nodeBindings())
+        package.objectIds.reserve(m_logicObjects.size() - existingObjectsCount);
+        NodeVector loadedNodes;
+        for (size_t i = existingObjectsCount; i < m_logicObjects.size(); ++i)
         {
-            errorReporting.add("Fatal error during loading from serialized data: missing node bindings container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            LogicObject* object = m_logicObjects[i];
+            package.objectIds.push_back(object->getId());
+            if (IsLogicNodeType(object->m_impl->getObjectType()))
+                loadedNodes.push_back(&static_cast<LogicNode*>(object)->m_impl);
         }
 
-        if (!apiObjects.appearanceBindings())
+        if (existingNodesSorted)
+            m_logicNodeDependencies.appendToTopologyCache(loadedNodes);
+
+        const uint64_t packageId = ++m_lastPackageId;
+        m_loadedPackages.emplace(packageId, std::move(package));
+        return packageId;
+    }
+
+    bool ApiObjects::unloadPackage(uint64_t packageId, ErrorReporting& errorReporting)
+    {
+        const auto packageIt = m_loadedPackages.find(packageId);
+        if (packageIt == m_loadedPackages.cend())
         {
-            errorReporting.add("Fatal error during loading from serialized data: missing appearance bindings container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            errorReporting.add(fmt::format("Cannot unload package with id={}, no such package was loaded!", packageId), nullptr, EErrorType::IllegalArgument);
+            return false;
         }
+        const LoadedPackage& package = packageIt->second;
 
-        if (!apiObjects.cameraBindings())
+        // objects destroyed by user in the meantime are skipped, modules still used by objects which are not destroyed are kept
+        std::vector<LogicObject*> objectsToDestroy;
+        objectsToDestroy.reserve(package.objectIds.size());
+        std::unordered_set<const LogicObject*> destroyedObjects;
+        std::vector<LuaModule*> luaModules;
+        for (const uint64_t objectId : package.objectIds)
         {
-            errorReporting.add("Fatal error during loading from serialized data: missing camera bindings container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            LogicObject* object = getApiObjectById(objectId);
+            if (!object)
+                continue;
+
+            if (object->m_impl->getObjectType() == ELogicObjectType::LuaModule)
+            {
+                luaModules.push_back(static_cast<LuaModule*>(object));
+            }
+            else
+            {
+                objectsToDestroy.push_back(object);
+                destroyedObjects.insert(object);
+            }
         }
 
-        if (featureLevel >= EFeatureLevel_02 && !apiObjects.renderPassBindings())
+        const auto isModuleUsed = [&](const LuaModule& luaModule) {
+            const auto usesModule = [&luaModule](const ModuleMapping& modules) {
+                return std::any_of(modules.cbegin(), modules.cend(), [&luaModule](const auto& m) { return m.second == &luaModule; });
+            };
+            return std::any_of(m_scripts.cbegin(), m_scripts.cend(), [&](const LuaScript* s) { return destroyedObjects.count(s) == 0u && usesModule(s->m_script.getModules()); }) ||
+                std::any_of(m_luaModules.cbegin(), m_luaModules.cend(), [&](const LuaModule* m) { return destroyedObjects.count(m) == 0u && usesModule(m->m_impl.getDependencies()); });
+        };
+
+        // modules are checked in reverse order so that module dependencies within package are destroyed too
+        std::vector<uint64_t> keptModuleIds;
+        for (auto it = luaModules.crbegin(); it != luaModules.crend(); ++it)
         {
-            errorReporting.add("Fatal error during loading from serialized data: missing renderpass bindings container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            LuaModule* luaModule = *it;
+            if (isModuleUsed(*luaModule))
+            {
+                keptModuleIds.push_back(luaModule->getId());
+            }
+            else
+            {
+                objectsToDestroy.push_back(luaModule);
+                destroyedObjects.insert(luaModule);
+            }
         }
 
-        if (!apiObjects.links())
+        if (!destroy(objectsToDestroy, errorReporting))
+            return false;
+        m_loadedPackages.erase(packageIt);
+
+        // kept module is shared with other package (which takes over its ownership) or used by other content (which keeps it)
+        for (const uint64_t moduleId : keptModuleIds)
         {
-            errorReporting.add("Fatal error during loading from serialized data: missing links container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            const auto sharingPackage = std::find_if(m_loadedPackages.begin(), m_loadedPackages.end(), [moduleId](const auto& p) {
+                return std::find(p.second.sharedModuleIds.cbegin(), p.second.sharedModuleIds.cend(), moduleId) != p.second.sharedModuleIds.cend();
+            });
+            if (sharingPackage != m_loadedPackages.end())
+            {
+                auto& sharedModuleIds = sharingPackage->second.sharedModuleIds;
+                sharedModuleIds.erase(std::find(sharedModuleIds.begin(), sharedModuleIds.end(), moduleId));
+                // modules are destroyed last, after all objects of the package which can use them
+                auto& objectIds = sharingPackage->second.objectIds;
+                objectIds.insert(objectIds.begin(), moduleId);
+            }
+        }
+
+        return true;
+    }
+
+    bool ApiObjects::deserializeObjects(
+        const rlogic_serialization::ApiObjects& apiObjects,
+        const IRamsesObjectResolver* ramsesResolver,
+        const std::string& dataSourceDescription,
+        ErrorReporting& errorReporting,
+        const DeserializationOptions& options,
+        DeserializationMap& deserializationMap,
+        std::vector<uint64_t>* sharedModuleIds)
+    {
+        const EFeatureLevel featureLevel = m_featureLevel;
+
+        if (!apiObjects.luaModules())
+        {
+            errorReporting.add("Fatal error during loading from serialized data: missing Lua modules container!", nullptr, EErrorType::BinaryVersionMismatch);
+            return false;
+        }
+
+        if (!apiObjects.luaScripts())
+        {
+            errorReporting.add("Fatal error during loading from serialized data: missing Lua scripts container!", nullptr, EErrorType::BinaryVersionMismatch);
+            return false;
+        }
+
+        if (!apiObjects.luaInterfaces())
+        {
+            errorReporting.add("Fatal error during loading from serialized data: missing Lua interfaces container!", nullptr, EErrorType::BinaryVersionMismatch);
+            return false;
+        }
+
+        if (!apiObjects.nodeBindings())
+        {
+            errorReporting.add("Fatal error during loading from serialized data: missing node bindings container!", nullptr, EErrorType::BinaryVersionMismatch);
+            return false;
+        }
+
+        if (!apiObjects.appearanceBindings())
+        {
+            errorReporting.add("Fatal error during loading from serialized data: missing appearance bindings container!", nullptr, EErrorType::BinaryVersionMismatch);
+            return false;
+        }
+
+        if (!apiObjects.cameraBindings())
+        {
+            errorReporting.add("Fatal error during loading from serialized data: missing camera bindings container!", nullptr, EErrorType::BinaryVersionMismatch);
+            return false;
+        }
+
+        if (featureLevel >= EFeatureLevel_02 && !apiObjects.renderPassBindings())
+        {
+            errorReporting.add("Fatal error during loading from serialized data: missing renderpass bindings container!", nullptr, EErrorType::BinaryVersionMismatch);
+            return false;
+        }
+
+        if (!apiObjects.links())
+        {
+            errorReporting.add("Fatal error during loading from serialized data: missing links container!", nullptr, EErrorType::BinaryVersionMismatch);
+            return false;
         }
 
         if (!apiObjects.dataArrays())
         {
             errorReporting.add("Fatal error during loading from serialized data: missing data arrays container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return false;
         }
 
         if (!apiObjects.animationNodes())
         {
             errorReporting.add("Fatal error during loading from serialized data: missing animation nodes container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return false;
         }
 
         if (!apiObjects.timerNodes())
         {
             errorReporting.add("Fatal error during loading from serialized data: missing timer nodes container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return false;
         }
 
         if (featureLevel >= EFeatureLevel_02 && !apiObjects.anchorPoints())
         {
             errorReporting.add("Fatal error during loading from serialized data: missing anchor points container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return false;
         }
 
         if (featureLevel >= EFeatureLevel_03 && !apiObjects.renderGroupBindings())
         {
             errorReporting.add("Fatal error during loading from serialized data: missing rendergroup bindings container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return false;
         }
 
         if (featureLevel >= EFeatureLevel_05 && !apiObjects.meshNodeBindings())
         {
             errorReporting.add("Fatal error during loading from serialized data: missing meshnode bindings container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return false;
         }
 
         if (featureLevel >= EFeatureLevel_04 && !apiObjects.skinBindings())
         {
             errorReporting.add("Fatal error during loading from serialized data: missing skin bindings container!", nullptr, EErrorType::BinaryVersionMismatch);
-            return nullptr;
+            return false;
         }
 
-        deserialized->m_lastObjectId = apiObjects.lastObjectId();
+        if (featureLevel >= EFeatureLevel_06 && !apiObjects.animationBlendNodes())
+        {
+            errorReporting.add("Fatal error during loading from serialized data: missing animation blend nodes container!", nullptr, EErrorType::BinaryVersionMismatch);
+            return false;
+        }
+
+        m_lastObjectId = deserializationMap.remapId(apiObjects.lastObjectId());
 
         const size_t logicObjectsTotalSize =
             static_cast<size_t>(apiObjects.luaModules()->size()) +
@@ -1304,223 +1520,109 @@ namespace rlogic::internal
             (featureLevel >= EFeatureLevel_02 ? static_cast<size_t>(apiObjects.anchorPoints()->size()) : 0u) +
             (featureLevel >= EFeatureLevel_03 ? static_cast<size_t>(apiObjects.renderGroupBindings()->size()) : 0u) +
             (featureLevel >= EFeatureLevel_05 ? static_cast<size_t>(apiObjects.meshNodeBindings()->size()) : 0u) +
-            (featureLevel >= EFeatureLevel_04 ? static_cast<size_t>(apiObjects.skinBindings()->size()) : 0u);
+            (featureLevel >= EFeatureLevel_04 ? static_cast<size_t>(apiObjects.skinBindings()->size()) : 0u) +
+            (featureLevel >= EFeatureLevel_06 ? static_cast<size_t>(apiObjects.animationBlendNodes()->size()) : 0u);
 
-        deserialized->m_objectsOwningContainer.reserve(logicObjectsTotalSize);
-        deserialized->m_logicObjects.reserve(logicObjectsTotalSize);
+        // all counts are known upfront, so neither containers nor mappings need to grow while registering the objects
+        const size_t nonNodeObjectsSize = static_cast<size_t>(apiObjects.luaModules()->size()) + static_cast<size_t>(apiObjects.dataArrays()->size());
+        reserve(m_logicObjects.size() + logicObjectsTotalSize, m_reverseImplMapping.size() + logicObjectsTotalSize - nonNodeObjectsSize);
+        deserializationMap.reserveLogicObjects(logicObjectsTotalSize);
 
-        const auto& luaModules = *apiObjects.luaModules();
-        deserialized->m_luaModules.reserve(luaModules.size());
-        for (const auto* module : luaModules)
-        {
-            std::unique_ptr<LuaModuleImpl> deserializedModule = LuaModuleImpl::Deserialize(*deserialized->m_solState, *module, errorReporting, deserializationMap, featureLevel);
-            if (!deserializedModule)
-                return nullptr;
-
-            std::unique_ptr<LuaModule> up        = std::make_unique<LuaModule>(std::move(deserializedModule));
-            LuaModule*                 luaModule = up.get();
-            deserialized->m_luaModules.push_back(luaModule);
-            deserialized->registerLogicObject(std::move(up));
-            deserializationMap.storeLogicObject(luaModule->getId(), deserialized->m_luaModules.back()->m_impl);
-        }
-
-        const auto& luascripts = *apiObjects.luaScripts();
-        deserialized->m_scripts.reserve(luascripts.size());
-        for (const auto* script : luascripts)
-        {
-            // TODO Violin find ways to unit-test this case - also for other container types
-            // Ideas: see if verifier catches it; or: disable flatbuffer's internal asserts if possible
-            assert (script);
-            std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(*deserialized->m_solState, *script, errorReporting, deserializationMap, featureLevel);
-
-            if (deserializedScript)
-            {
-                std::unique_ptr<LuaScript> up             = std::make_unique<LuaScript>(std::move(deserializedScript));
-                LuaScript*                 luascript = up.get();
-                deserialized->m_scripts.push_back(luascript);
-                deserialized->registerLogicObject(std::move(up));
-            }
-            else
-            {
-                return nullptr;
-            }
-        }
-
-        const auto& luaInterfaces = *apiObjects.luaInterfaces();
-        deserialized->m_interfaces.reserve(luaInterfaces.size());
-        for (const auto* intf : luaInterfaces)
-        {
-            assert(intf);
-            std::unique_ptr<LuaInterfaceImpl> deserializedInterface = LuaInterfaceImpl::Deserialize(*intf, errorReporting, deserializationMap);
-
-            if (deserializedInterface)
-            {
-                std::unique_ptr<LuaInterface> up = std::make_unique<LuaInterface>(std::move(deserializedInterface));
-                LuaInterface* luaInterface = up.get();
-                deserialized->m_interfaces.push_back(luaInterface);
-                deserialized->registerLogicObject(std::move(up));
-            }
-            else
-            {
-                return nullptr;
-            }
-        }
-
-        if (apiObjects.nodeBindings()->size() != 0u ||
+        const bool containsRamsesBindings =
+            apiObjects.nodeBindings()->size() != 0u ||
             apiObjects.appearanceBindings()->size() != 0u ||
             apiObjects.cameraBindings()->size() != 0u ||
             (featureLevel >= EFeatureLevel_02 && apiObjects.renderPassBindings()->size() != 0u) ||
             (featureLevel >= EFeatureLevel_03 && apiObjects.renderGroupBindings()->size() != 0u) ||
-            (featureLevel >= EFeatureLevel_05 && apiObjects.meshNodeBindings()->size() != 0u))
+            (featureLevel >= EFeatureLevel_05 && apiObjects.meshNodeBindings()->size() != 0u);
+        if (containsRamsesBindings && ramsesResolver == nullptr)
         {
-            if (ramsesResolver == nullptr)
-            {
-                errorReporting.add("Fatal error during loading from file! File contains references to Ramses objects but no Ramses scene was provided!", nullptr, EErrorType::BinaryVersionMismatch);
-                return nullptr;
-            }
+            errorReporting.add("Fatal error during loading from file! File contains references to Ramses objects but no Ramses scene was provided!", nullptr, EErrorType::BinaryVersionMismatch);
+            return false;
         }
 
-        const auto& ramsesNodeBindings = *apiObjects.nodeBindings();
-        deserialized->m_ramsesNodeBindings.reserve(ramsesNodeBindings.size());
-        for (const auto* binding : ramsesNodeBindings)
+        // Objects not using Lua are deserialized concurrently with Lua modules, scripts and interfaces if parallel loading enabled,
+        // worker collects its errors (also those of resolving Ramses objects) and mappings separately,
+        // these are merged after Lua objects in fixed order
+        ErrorReporting luaIndependentErrors;
+        DeserializationMap luaIndependentDeserializationMap{ deserializationMap.getIdOffset() };
+        std::unique_ptr<IRamsesObjectResolver> luaIndependentRamsesResolver;
+        std::future<std::optional<LuaIndependentObjects>> luaIndependentObjectsFuture;
+        if (options.parallelLoading)
         {
-            assert(binding);
-            assert(ramsesResolver);
-            std::unique_ptr<RamsesNodeBindingImpl> deserializedBinding = RamsesNodeBindingImpl::Deserialize(*binding, *ramsesResolver, errorReporting, deserializationMap, featureLevel);
-
-            if (deserializedBinding)
-            {
-                std::unique_ptr<RamsesNodeBinding> up = std::make_unique<RamsesNodeBinding>(std::move(deserializedBinding));
-                RamsesNodeBinding* nodeBinding = up.get();
-                deserialized->m_ramsesNodeBindings.push_back(nodeBinding);
-                deserialized->registerLogicObject(std::move(up));
-                deserializationMap.storeLogicObject(nodeBinding->getId(), nodeBinding->m_nodeBinding);
-            }
-            else
-            {
-                return nullptr;
-            }
+            if (ramsesResolver != nullptr)
+                luaIndependentRamsesResolver = ramsesResolver->createWithErrorReporting(luaIndependentErrors);
+            luaIndependentObjectsFuture = std::async(std::launch::async,
+                [&apiObjects, resolver = luaIndependentRamsesResolver.get(), &luaIndependentErrors, &luaIndependentDeserializationMap, featureLevel]() {
+                    return DeserializeLuaIndependentObjects(apiObjects, resolver, luaIndependentErrors, luaIndependentDeserializationMap, featureLevel);
+                });
         }
 
-        const auto& ramsesAppearanceBindings = *apiObjects.appearanceBindings();
-        deserialized->m_ramsesAppearanceBindings.reserve(ramsesAppearanceBindings.size());
-        for (const auto* binding : ramsesAppearanceBindings)
-        {
-            assert(binding);
-            assert(ramsesResolver);
-            std::unique_ptr<RamsesAppearanceBindingImpl> deserializedBinding = RamsesAppearanceBindingImpl::Deserialize(*binding, *ramsesResolver, errorReporting, deserializationMap);
+        const bool luaObjectsDeserialized = deserializeLuaObjects(apiObjects, errorReporting, deserializationMap, featureLevel, options.lazyLuaScriptLoading, sharedModuleIds);
 
-            if (deserializedBinding)
-            {
-                std::unique_ptr<RamsesAppearanceBinding> up      = std::make_unique<RamsesAppearanceBinding>(std::move(deserializedBinding));
-                RamsesAppearanceBinding*                 appBinding = up.get();
-                deserialized->m_ramsesAppearanceBindings.push_back(appBinding);
-                deserialized->registerLogicObject(std::move(up));
-                deserializationMap.storeLogicObject(appBinding->getId(), appBinding->m_appearanceBinding);
-            }
-            else
-            {
-                return nullptr;
-            }
+        std::optional<LuaIndependentObjects> luaIndependentObjects;
+        if (luaIndependentObjectsFuture.valid())
+        {
+            luaIndependentObjects = luaIndependentObjectsFuture.get();
+            errorReporting.append(std::move(luaIndependentErrors));
+            deserializationMap.merge(std::move(luaIndependentDeserializationMap));
         }
 
-        const auto& ramsesCameraBindings = *apiObjects.cameraBindings();
-        deserialized->m_ramsesCameraBindings.reserve(ramsesCameraBindings.size());
-        for (const auto* binding : ramsesCameraBindings)
-        {
-            assert(binding);
-            assert(ramsesResolver);
-            std::unique_ptr<RamsesCameraBindingImpl> deserializedBinding = RamsesCameraBindingImpl::Deserialize(*binding, *ramsesResolver, errorReporting, deserializationMap);
+        if (!luaObjectsDeserialized)
+            return false;
 
-            if (deserializedBinding)
-            {
-                std::unique_ptr<RamsesCameraBinding> up      = std::make_unique<RamsesCameraBinding>(std::move(deserializedBinding));
-                RamsesCameraBinding*                 camBinding = up.get();
-                deserialized->m_ramsesCameraBindings.push_back(camBinding);
-                deserialized->registerLogicObject(std::move(up));
-                deserializationMap.storeLogicObject(camBinding->getId(), camBinding->m_cameraBinding);
-            }
-            else
-            {
-                return nullptr;
-            }
-        }
+        if (!options.parallelLoading)
+            luaIndependentObjects = DeserializeLuaIndependentObjects(apiObjects, ramsesResolver, errorReporting, deserializationMap, featureLevel);
 
-        if (featureLevel >= EFeatureLevel_02)
+        if (!luaIndependentObjects)
+            return false;
+
+        registerLuaIndependentObjects(std::move(*luaIndependentObjects), deserializationMap);
+
+        // animation blend nodes must go after animation nodes because they need to resolve references
+        if (featureLevel >= EFeatureLevel_06)
         {
-            const auto& ramsesRenderPassBindings = *apiObjects.renderPassBindings();
-            deserialized->m_ramsesRenderPassBindings.reserve(ramsesRenderPassBindings.size());
-            for (const auto* binding : ramsesRenderPassBindings)
+            const auto& blendNodes = *apiObjects.animationBlendNodes();
+            m_animationBlendNodes.reserve(blendNodes.size());
+            for (const auto* fbData : blendNodes)
             {
-                assert(binding);
-                assert(ramsesResolver);
-                std::unique_ptr<RamsesRenderPassBindingImpl> deserializedBinding = RamsesRenderPassBindingImpl::Deserialize(*binding, *ramsesResolver, errorReporting, deserializationMap);
+                assert(fbData);
+                auto deserializedBlendNode = AnimationBlendNodeImpl::Deserialize(*fbData, errorReporting, deserializationMap);
+                if (!deserializedBlendNode)
+                    return false;
 
-                if (deserializedBinding)
-                {
-                    std::unique_ptr<RamsesRenderPassBinding> up = std::make_unique<RamsesRenderPassBinding>(std::move(deserializedBinding));
-                    RamsesRenderPassBinding* rpBinding = up.get();
-                    deserialized->m_ramsesRenderPassBindings.push_back(rpBinding);
-                    deserialized->registerLogicObject(std::move(up));
-                }
-                else
+                auto up = std::make_unique<AnimationBlendNode>(std::move(deserializedBlendNode));
+                AnimationBlendNode* blendNode = up.get();
+                m_animationBlendNodes.push_back(blendNode);
+                registerDeserializedLogicObject(std::move(up), deserializationMap);
+
+                for (auto* source : blendNode->m_animationBlendNodeImpl.getSources())
                 {
-                    return nullptr;
+                    source->addDependentNode(blendNode->m_impl);
+                    m_logicNodeDependencies.addNodeDependency(*source, blendNode->m_impl);
                 }
             }
         }
 
-        const auto& dataArrays = *apiObjects.dataArrays();
-        deserialized->m_dataArrays.reserve(dataArrays.size());
-        for (const auto* fbData : dataArrays)
-        {
-            assert(fbData);
-            auto deserializedDataArray = DataArrayImpl::Deserialize(*fbData, errorReporting);
-            if (!deserializedDataArray)
-                return nullptr;
-
-            std::unique_ptr<DataArray> up        = std::make_unique<DataArray>(std::move(deserializedDataArray));
-            DataArray*                 dataArray = up.get();
-            deserialized->m_dataArrays.push_back(dataArray);
-            deserialized->registerLogicObject(std::move(up));
-            deserializationMap.storeDataArray(*fbData, *deserialized->m_dataArrays.back());
-        }
-
-        // animation nodes must go after data arrays because they need to resolve references
-        const auto& animNodes = *apiObjects.animationNodes();
-        deserialized->m_animationNodes.reserve(animNodes.size());
-        for (const auto* fbData : animNodes)
-        {
-            assert(fbData);
-            auto deserializedAnimNode = AnimationNodeImpl::Deserialize(*fbData, errorReporting, deserializationMap);
-            if (!deserializedAnimNode)
-                return nullptr;
-
-            std::unique_ptr<AnimationNode> up        = std::make_unique<AnimationNode>(std::move(deserializedAnimNode));
-            AnimationNode*                 animation = up.get();
-            deserialized->m_animationNodes.push_back(animation);
-            deserialized->registerLogicObject(std::move(up));
-        }
-
         const auto& timerNodes = *apiObjects.timerNodes();
-        deserialized->m_timerNodes.reserve(timerNodes.size());
+        m_timerNodes.reserve(timerNodes.size());
         for (const auto* fbData : timerNodes)
         {
             assert(fbData);
             auto deserializedTimer = TimerNodeImpl::Deserialize(*fbData, errorReporting, deserializationMap);
             if (!deserializedTimer)
-                return nullptr;
+                return false;
 
             auto up = std::make_unique<TimerNode>(std::move(deserializedTimer));
-            deserialized->m_timerNodes.push_back(up.get());
-            deserialized->registerLogicObject(std::move(up));
+            m_timerNodes.push_back(up.get());
+            registerDeserializedLogicObject(std::move(up), deserializationMap);
         }
 
         // anchor points must go after node and camera bindings because they need to resolve references
         if (featureLevel >= EFeatureLevel_02)
         {
             const auto& anchorPoints = *apiObjects.anchorPoints();
-            deserialized->m_anchorPoints.reserve(anchorPoints.size());
+            m_anchorPoints.reserve(anchorPoints.size());
             for (const auto* fbAnchor : anchorPoints)
             {
                 assert(fbAnchor);
@@ -1531,12 +1633,13 @@ namespace rlogic::internal
                 {
                     auto up = std::make_unique<AnchorPoint>(std::move(deserializedAnchor));
                     AnchorPoint* anchor = up.get();
-                    deserialized->m_anchorPoints.push_back(anchor);
-                    deserialized->registerLogicObject(std::move(up));
+                    anchor->m_anchorPointImpl.setCameraViewProjectionCache(&m_cameraViewProjectionCache);
+                    m_anchorPoints.push_back(anchor);
+                    registerDeserializedLogicObject(std::move(up), deserializationMap);
                 }
                 else
                 {
-                    return nullptr;
+                    return false;
                 }
             }
         }
@@ -1544,7 +1647,7 @@ namespace rlogic::internal
         if (featureLevel >= EFeatureLevel_03)
         {
             const auto& ramsesRenderGroupBindings = *apiObjects.renderGroupBindings();
-            deserialized->m_ramsesRenderGroupBindings.reserve(ramsesRenderGroupBindings.size());
+            m_ramsesRenderGroupBindings.reserve(ramsesRenderGroupBindings.size());
             for (const auto* binding : ramsesRenderGroupBindings)
             {
                 assert(binding);
@@ -1555,12 +1658,12 @@ namespace rlogic::internal
                 {
                     std::unique_ptr<RamsesRenderGroupBinding> up = std::make_unique<RamsesRenderGroupBinding>(std::move(deserializedBinding));
                     RamsesRenderGroupBinding* rgBinding = up.get();
-                    deserialized->m_ramsesRenderGroupBindings.push_back(rgBinding);
-                    deserialized->registerLogicObject(std::move(up));
+                    m_ramsesRenderGroupBindings.push_back(rgBinding);
+                    registerDeserializedLogicObject(std::move(up), deserializationMap);
                 }
                 else
                 {
-                    return nullptr;
+                    return false;
                 }
             }
         }
@@ -1569,7 +1672,8 @@ namespace rlogic::internal
         {
             // skin bindings must go after node and appearance bindings because they need to resolve references
             const auto& skinBindings = *apiObjects.skinBindings();
-            deserialized->m_skinBindings.reserve(skinBindings.size());
+            m_skinBindings.reserve(skinBindings.size());
+            m_skinningBatch.invalidate();
             for (const auto* binding : skinBindings)
             {
                 assert(binding);
@@ -1579,12 +1683,12 @@ namespace rlogic::internal
                 {
                     std::unique_ptr<SkinBinding> up = std::make_unique<SkinBinding>(std::move(deserializedBinding));
                     SkinBinding* skinBinding = up.get();
-                    deserialized->m_skinBindings.push_back(skinBinding);
-                    deserialized->registerLogicObject(std::move(up));
+                    m_skinBindings.push_back(skinBinding);
+                    registerDeserializedLogicObject(std::move(up), deserializationMap);
                 }
                 else
                 {
-                    return nullptr;
+                    return false;
                 }
             }
         }
@@ -1592,7 +1696,7 @@ namespace rlogic::internal
         if (featureLevel >= EFeatureLevel_05)
         {
             const auto& ramsesMeshNodeBindings = *apiObjects.meshNodeBindings();
-            deserialized->m_ramsesMeshNodeBindings.reserve(ramsesMeshNodeBindings.size());
+            m_ramsesMeshNodeBindings.reserve(ramsesMeshNodeBindings.size());
             for (const auto* binding : ramsesMeshNodeBindings)
             {
                 assert(binding);
@@ -1603,12 +1707,12 @@ namespace rlogic::internal
                 {
                     auto up = std::make_unique<RamsesMeshNodeBinding>(std::move(deserializedBinding));
                     RamsesMeshNodeBinding* mnBinding = up.get();
-                    deserialized->m_ramsesMeshNodeBindings.push_back(mnBinding);
-                    deserialized->registerLogicObject(std::move(up));
+                    m_ramsesMeshNodeBindings.push_back(mnBinding);
+                    registerDeserializedLogicObject(std::move(up), deserializationMap);
                 }
                 else
                 {
-                    return nullptr;
+                    return false;
                 }
             }
         }
@@ -1623,19 +1727,19 @@ namespace rlogic::internal
             if (!rLink->sourceProperty())
             {
                 errorReporting.add("Fatal error during loading from serialized data: missing link source property!", nullptr, EErrorType::BinaryVersionMismatch);
-                return nullptr;
+                return false;
             }
 
             if (!rLink->targetProperty())
             {
                 errorReporting.add("Fatal error during loading from serialized data: missing link target property!", nullptr, EErrorType::BinaryVersionMismatch);
-                return nullptr;
+                return false;
             }
 
             const rlogic_serialization::Property* sourceProp = rLink->sourceProperty();
             const rlogic_serialization::Property* targetProp = rLink->targetProperty();
 
-            const bool success = deserialized->m_logicNodeDependencies.link(
+            const bool success = m_logicNodeDependencies.link(
                 deserializationMap.resolvePropertyImpl(*sourceProp),
                 deserializationMap.resolvePropertyImpl(*targetProp),
                 rLink->isWeak(),
@@ -1651,13 +1755,243 @@ namespace rlogic::internal
                         sourceProp->name()->string_view(),
                         targetProp->name()->string_view()
                     ), nullptr, EErrorType::BinaryVersionMismatch);
-                return nullptr;
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool ApiObjects::deserializeLuaObjects(
+        const rlogic_serialization::ApiObjects& apiObjects,
+        ErrorReporting& errorReporting,
+        DeserializationMap& deserializationMap,
+        EFeatureLevel featureLevel,
+        bool lazyLuaScriptLoading,
+        std::vector<uint64_t>* sharedModuleIds)
+    {
+        const auto& luaModules = *apiObjects.luaModules();
+        const size_t existingModulesCount = m_luaModules.size();
+        m_luaModules.reserve(existingModulesCount + luaModules.size());
+        for (const auto* module : luaModules)
+        {
+            // content loaded additively uses identical module which already exists instead of loading it again
+            if (sharedModuleIds && module->base())
+            {
+                const auto existingModulesEnd = m_luaModules.cbegin() + static_cast<std::ptrdiff_t>(existingModulesCount);
+                const auto identicalModule = std::find_if(m_luaModules.cbegin(), existingModulesEnd,
+                    [&](const LuaModule* m) { return m->m_impl.isIdenticalTo(*module, deserializationMap); });
+                if (identicalModule != existingModulesEnd)
+                {
+                    deserializationMap.storeLogicObject(deserializationMap.remapId(module->base()->id()), (*identicalModule)->m_impl);
+                    if (std::find(sharedModuleIds->cbegin(), sharedModuleIds->cend(), (*identicalModule)->getId()) == sharedModuleIds->cend())
+                        sharedModuleIds->push_back((*identicalModule)->getId());
+                    continue;
+                }
+            }
+
+            std::unique_ptr<LuaModuleImpl> deserializedModule = LuaModuleImpl::Deserialize(*m_solState, *module, errorReporting, deserializationMap, featureLevel);
+            if (!deserializedModule)
+                return false;
+
+            std::unique_ptr<LuaModule> up        = std::make_unique<LuaModule>(std::move(deserializedModule));
+            LuaModule*                 luaModule = up.get();
+            m_luaModules.push_back(luaModule);
+            registerDeserializedLogicObject(std::move(up), deserializationMap);
+            deserializationMap.storeLogicObject(luaModule->getId(), m_luaModules.back()->m_impl);
+        }
+
+        const auto& luascripts = *apiObjects.luaScripts();
+        m_scripts.reserve(luascripts.size());
+        for (const auto* script : luascripts)
+        {
+            // TODO Violin find ways to unit-test this case - also for other container types
+            // Ideas: see if verifier catches it; or: disable flatbuffer's internal asserts if possible
+            assert (script);
+            std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(*m_solState, *script, errorReporting, deserializationMap, featureLevel, lazyLuaScriptLoading);
+
+            if (deserializedScript)
+            {
+                std::unique_ptr<LuaScript> up             = std::make_unique<LuaScript>(std::move(deserializedScript));
+                LuaScript*                 luascript = up.get();
+                m_scripts.push_back(luascript);
+                registerDeserializedLogicObject(std::move(up), deserializationMap);
+            }
+            else
+            {
+                return false;
             }
         }
 
+        const auto& luaInterfaces = *apiObjects.luaInterfaces();
+        m_interfaces.reserve(luaInterfaces.size());
+        for (const auto* intf : luaInterfaces)
+        {
+            assert(intf);
+            std::unique_ptr<LuaInterfaceImpl> deserializedInterface = LuaInterfaceImpl::Deserialize(*intf, errorReporting, deserializationMap);
+
+            if (deserializedInterface)
+            {
+                std::unique_ptr<LuaInterface> up = std::make_unique<LuaInterface>(std::move(deserializedInterface));
+                LuaInterface* luaInterface = up.get();
+                m_interfaces.push_back(luaInterface);
+                registerDeserializedLogicObject(std::move(up), deserializationMap);
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::optional<ApiObjects::LuaIndependentObjects> ApiObjects::DeserializeLuaIndependentObjects(
+        const rlogic_serialization::ApiObjects& apiObjects,
+        const IRamsesObjectResolver* ramsesResolver,
+        ErrorReporting& errorReporting,
+        DeserializationMap& deserializationMap,
+        EFeatureLevel featureLevel)
+    {
+        LuaIndependentObjects deserialized;
+
+        const auto& ramsesNodeBindings = *apiObjects.nodeBindings();
+        deserialized.nodeBindings.reserve(ramsesNodeBindings.size());
+        for (const auto* binding : ramsesNodeBindings)
+        {
+            assert(binding);
+            assert(ramsesResolver);
+            std::unique_ptr<RamsesNodeBindingImpl> deserializedBinding = RamsesNodeBindingImpl::Deserialize(*binding, *ramsesResolver, errorReporting, deserializationMap, featureLevel);
+            if (!deserializedBinding)
+                return std::nullopt;
+
+            deserialized.nodeBindings.push_back(std::make_unique<RamsesNodeBinding>(std::move(deserializedBinding)));
+        }
+
+        const auto& ramsesAppearanceBindings = *apiObjects.appearanceBindings();
+        deserialized.appearanceBindings.reserve(ramsesAppearanceBindings.size());
+        for (const auto* binding : ramsesAppearanceBindings)
+        {
+            assert(binding);
+            assert(ramsesResolver);
+            std::unique_ptr<RamsesAppearanceBindingImpl> deserializedBinding = RamsesAppearanceBindingImpl::Deserialize(*binding, *ramsesResolver, errorReporting, deserializationMap);
+            if (!deserializedBinding)
+                return std::nullopt;
+
+            deserialized.appearanceBindings.push_back(std::make_unique<RamsesAppearanceBinding>(std::move(deserializedBinding)));
+        }
+
+        const auto& ramsesCameraBindings = *apiObjects.cameraBindings();
+        deserialized.cameraBindings.reserve(ramsesCameraBindings.size());
+        for (const auto* binding : ramsesCameraBindings)
+        {
+            assert(binding);
+            assert(ramsesResolver);
+            std::unique_ptr<RamsesCameraBindingImpl> deserializedBinding = RamsesCameraBindingImpl::Deserialize(*binding, *ramsesResolver, errorReporting, deserializationMap);
+            if (!deserializedBinding)
+                return std::nullopt;
+
+            deserialized.cameraBindings.push_back(std::make_unique<RamsesCameraBinding>(std::move(deserializedBinding)));
+        }
+
+        if (featureLevel >= EFeatureLevel_02)
+        {
+            const auto& ramsesRenderPassBindings = *apiObjects.renderPassBindings();
+            deserialized.renderPassBindings.reserve(ramsesRenderPassBindings.size());
+            for (const auto* binding : ramsesRenderPassBindings)
+            {
+                assert(binding);
+                assert(ramsesResolver);
+                std::unique_ptr<RamsesRenderPassBindingImpl> deserializedBinding = RamsesRenderPassBindingImpl::Deserialize(*binding, *ramsesResolver, errorReporting, deserializationMap);
+                if (!deserializedBinding)
+                    return std::nullopt;
+
+                deserialized.renderPassBindings.push_back(std::make_unique<RamsesRenderPassBinding>(std::move(deserializedBinding)));
+            }
+        }
+
+        const auto& dataArrays = *apiObjects.dataArrays();
+        deserialized.dataArrays.reserve(dataArrays.size());
+        for (const auto* fbData : dataArrays)
+        {
+            assert(fbData);
+            auto deserializedDataArray = DataArrayImpl::Deserialize(*fbData, errorReporting);
+            if (!deserializedDataArray)
+                return std::nullopt;
+
+            deserialized.dataArrays.push_back(std::make_unique<DataArray>(std::move(deserializedDataArray)));
+            deserializationMap.storeDataArray(*fbData, *deserialized.dataArrays.back());
+        }
+
+        // animation nodes must go after data arrays because they need to resolve references
+        const auto& animNodes = *apiObjects.animationNodes();
+        deserialized.animationNodes.reserve(animNodes.size());
+        for (const auto* fbData : animNodes)
+        {
+            assert(fbData);
+            auto deserializedAnimNode = AnimationNodeImpl::Deserialize(*fbData, errorReporting, deserializationMap, featureLevel);
+            if (!deserializedAnimNode)
+                return std::nullopt;
+
+            deserialized.animationNodes.push_back(std::make_unique<AnimationNode>(std::move(deserializedAnimNode)));
+        }
+
         return deserialized;
     }
 
+    void ApiObjects::registerLuaIndependentObjects(LuaIndependentObjects&& objects, DeserializationMap& deserializationMap)
+    {
+        m_ramsesNodeBindings.reserve(objects.nodeBindings.size());
+        for (auto& up : objects.nodeBindings)
+        {
+            RamsesNodeBinding* nodeBinding = up.get();
+            m_ramsesNodeBindings.push_back(nodeBinding);
+            registerDeserializedLogicObject(std::move(up), deserializationMap);
+            deserializationMap.storeLogicObject(nodeBinding->getId(), nodeBinding->m_nodeBinding);
+        }
+
+        m_ramsesAppearanceBindings.reserve(objects.appearanceBindings.size());
+        for (auto& up : objects.appearanceBindings)
+        {
+            RamsesAppearanceBinding* appBinding = up.get();
+            m_ramsesAppearanceBindings.push_back(appBinding);
+            registerDeserializedLogicObject(std::move(up), deserializationMap);
+            deserializationMap.storeLogicObject(appBinding->getId(), appBinding->m_appearanceBinding);
+        }
+
+        m_ramsesCameraBindings.reserve(objects.cameraBindings.size());
+        for (auto& up : objects.cameraBindings)
+        {
+            RamsesCameraBinding* camBinding = up.get();
+            m_ramsesCameraBindings.push_back(camBinding);
+            registerDeserializedLogicObject(std::move(up), deserializationMap);
+            deserializationMap.storeLogicObject(camBinding->getId(), camBinding->m_cameraBinding);
+        }
+
+        m_ramsesRenderPassBindings.reserve(objects.renderPassBindings.size());
+        for (auto& up : objects.renderPassBindings)
+        {
+            m_ramsesRenderPassBindings.push_back(up.get());
+            registerDeserializedLogicObject(std::move(up), deserializationMap);
+        }
+
+        m_dataArrays.reserve(objects.dataArrays.size());
+        for (auto& up : objects.dataArrays)
+        {
+            m_dataArrays.push_back(up.get());
+            registerDeserializedLogicObject(std::move(up), deserializationMap);
+        }
+
+        m_animationNodes.reserve(objects.animationNodes.size());
+        for (auto& up : objects.animationNodes)
+        {
+            AnimationNode* animation = up.get();
+            m_animationNodes.push_back(animation);
+            registerDeserializedLogicObject(std::move(up), deserializationMap);
+            deserializationMap.storeLogicObject(animation->getId(), animation->m_animationNodeImpl);
+        }
+    }
+
     bool ApiObjects::bindingsDirty() const
     {
         return
@@ -1682,7 +2016,12 @@ namespace rlogic::internal
 
     const std::vector<PropertyLink>& ApiObjects::getAllPropertyLinks() const
     {
-        m_collectedLinks = collectPropertyLinks();
+        const uint64_t linksVersion = m_logicNodeDependencies.getLinksVersion();
+        if (m_collectedLinksVersion != linksVersion)
+        {
+            m_collectedLinks = collectPropertyLinks();
+            m_collectedLinksVersion = linksVersion;
+        }
         return m_collectedLinks;
     }
 
@@ -1690,7 +2029,7 @@ namespace rlogic::internal
     {
         std::vector<PropertyLink> links;
 
-        std::deque<const Property*> propsStack;
+        std::vector<const Property*> propsStack;
         for (const auto& obj : m_logicObjects)
         {
             const auto logicNode = obj->as<LogicNode>();
@@ -1744,6 +2083,7 @@ namespace rlogic::internal
     template ApiObjectContainer<AnimationNode>&            ApiObjects::getApiObjectContainer<AnimationNode>();
     template ApiObjectContainer<TimerNode>&                ApiObjects::getApiObjectContainer<TimerNode>();
     template ApiObjectContainer<AnchorPoint>&              ApiObjects::getApiObjectContainer<AnchorPoint>();
+    template ApiObjectContainer<AnimationBlendNode>&       ApiObjects::getApiObjectContainer<AnimationBlendNode>();
 
     template const ApiObjectContainer<LogicObject>&              ApiObjects::getApiObjectContainer<LogicObject>() const;
     template const ApiObjectContainer<LuaScript>&                ApiObjects::getApiObjectContainer<LuaScript>() const;
@@ -1760,4 +2100,5 @@ namespace rlogic::internal
     template const ApiObjectContainer<AnimationNode>&            ApiObjects::getApiObjectContainer<AnimationNode>() const;
     template const ApiObjectContainer<TimerNode>&                ApiObjects::getApiObjectContainer<TimerNode>() const;
     template const ApiObjectContainer<AnchorPoint>&              ApiObjects::getApiObjectContainer<AnchorPoint>() const;
+    template const ApiObjectContainer<AnimationBlendNode>&       ApiObjects::getApiObjectContainer<AnimationBlendNode>() const;
 }
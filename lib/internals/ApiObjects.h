@@ -20,10 +20,18 @@
 #include "internals/LuaCompilationUtils.h"
 #include "internals/SolState.h"
 #include "internals/LogicNodeDependencies.h"
+#include "internals/SkinningBatch.h"
+#include "internals/CameraViewProjectionCache.h"
+#include "internals/ELogicObjectType.h"
+#include "internals/LogicObjectNameIndex.h"
 
+#include <array>
 #include <vector>
 #include <memory>
+#include <optional>
 #include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace ramses
 {
@@ -67,6 +75,7 @@ namespace rlogic
     class AnimationNode;
     class TimerNode;
     class AnchorPoint;
+    class AnimationBlendNode;
 }
 
 namespace rlogic::internal
@@ -79,6 +88,16 @@ namespace rlogic::internal
     class RamsesNodeBindingImpl;
     class RamsesCameraBindingImpl;
     class RamsesAppearanceBindingImpl;
+    class AnimationNodeImpl;
+    class DeserializationMap;
+    class ErrorReporting;
+
+    // Options affecting how ApiObjects are loaded, configured on LogicEngine
+    struct DeserializationOptions
+    {
+        bool lazyLuaScriptLoading = false;
+        bool parallelLoading = false;
+    };
 
     template <typename T>
     using ApiObjectContainer = std::vector<T*>;
@@ -114,7 +133,17 @@ namespace rlogic::internal
             const IRamsesObjectResolver* ramsesResolver,
             const std::string& dataSourceDescription,
             ErrorReporting& errorReporting,
-            EFeatureLevel featureLevel);
+            EFeatureLevel featureLevel,
+            const DeserializationOptions& options = {});
+
+        // Loads content in addition to existing objects, returns ID of loaded package or nullopt if failed (no objects are added then)
+        std::optional<uint64_t> deserializePackage(
+            const rlogic_serialization::ApiObjects& apiObjects,
+            const IRamsesObjectResolver* ramsesResolver,
+            const std::string& dataSourceDescription,
+            ErrorReporting& errorReporting,
+            const DeserializationOptions& options);
+        bool unloadPackage(uint64_t packageId, ErrorReporting& errorReporting);
 
         // Create/destroy API objects
         LuaScript* createLuaScript(
@@ -150,7 +179,16 @@ namespace rlogic::internal
         AnimationNode* createAnimationNode(const AnimationNodeConfigImpl& config, std::string_view name);
         TimerNode* createTimerNode(std::string_view name);
         AnchorPoint* createAnchorPoint(RamsesNodeBindingImpl& nodeBinding, RamsesCameraBindingImpl& cameraBinding, std::string_view name);
+        AnimationBlendNode* createAnimationBlendNode(std::vector<AnimationNodeImpl*> sources, std::string_view name);
         bool destroy(LogicObject& object, ErrorReporting& errorReporting);
+        // Destroys all given objects or none of them if any of them cannot be destroyed
+        bool destroy(const std::vector<LogicObject*>& objects, ErrorReporting& errorReporting);
+        // Reports error if object is null, of unknown type or not owned by this instance
+        [[nodiscard]] bool checkObjectToDestroyIsValid(const LogicObject* object, ErrorReporting& errorReporting) const;
+
+        // Prepares containers and mappings for given total number of objects (of which nodeCount are logic nodes),
+        // so that registering them does not reallocate or rehash
+        void reserve(size_t objectCount, size_t nodeCount);
 
         // Invariance checks
         [[nodiscard]] bool checkBindingsReferToSameRamsesScene(ErrorReporting& errorReporting) const;
@@ -165,9 +203,12 @@ namespace rlogic::internal
         [[nodiscard]] const ApiObjectOwningContainer& getApiObjectOwningContainer() const;
         [[nodiscard]] const LogicNodeDependencies& getLogicNodeDependencies() const;
         [[nodiscard]] LogicNodeDependencies& getLogicNodeDependencies();
+        [[nodiscard]] SkinningBatch& getSkinningBatch();
+        [[nodiscard]] CameraViewProjectionCache& getCameraViewProjectionCache();
 
         [[nodiscard]] LogicNode* getApiObject(LogicNodeImpl& impl) const;
         [[nodiscard]] LogicObject* getApiObjectById(uint64_t id) const;
+        [[nodiscard]] const LogicObjectNameIndex& getNameIndex() const;
 
         // Internally used
         [[nodiscard]] bool bindingsDirty() const;
@@ -183,32 +224,59 @@ namespace rlogic::internal
     private:
         // Handle internal data structures and mappings
         void registerLogicNode(LogicNode& logicNode);
-        void unregisterLogicNode(LogicNode& logicNode);
-        void registerLogicObject(std::unique_ptr<LogicObject> obj);
-        void unregisterLogicObject(LogicObject& objToDelete);
+        template <typename T>
+        void registerLogicObject(std::unique_ptr<T> obj);
+        template <typename T>
+        void registerDeserializedLogicObject(std::unique_ptr<T> obj, const DeserializationMap& deserializationMap);
 
         bool checkLuaModules(
             const ModuleMapping& moduleMapping,
             ErrorReporting& errorReporting);
 
-        // Type-specific destruction logic
-        [[nodiscard]] bool destroyInternal(RamsesNodeBinding& ramsesNodeBinding, ErrorReporting& errorReporting);
-        [[nodiscard]] bool destroyInternal(LuaScript& luaScript, ErrorReporting& errorReporting);
-        [[nodiscard]] bool destroyInternal(LuaInterface& luaInterface, ErrorReporting& errorReporting);
-        [[nodiscard]] bool destroyInternal(LuaModule& luaModule, ErrorReporting& errorReporting);
-        [[nodiscard]] bool destroyInternal(RamsesAppearanceBinding& ramsesAppearanceBinding, ErrorReporting& errorReporting);
-        [[nodiscard]] bool destroyInternal(RamsesCameraBinding& ramsesCameraBinding, ErrorReporting& errorReporting);
-        [[nodiscard]] bool destroyInternal(RamsesRenderPassBinding& ramsesRenderPassBinding, ErrorReporting& errorReporting);
-        [[nodiscard]] bool destroyInternal(RamsesRenderGroupBinding& ramsesRenderGroupBinding, ErrorReporting& errorReporting);
-        [[nodiscard]] bool destroyInternal(RamsesMeshNodeBinding& ramsesMeshNodeBinding, ErrorReporting& errorReporting);
-        [[nodiscard]] bool destroyInternal(SkinBinding& skinBinding, ErrorReporting& errorReporting);
-        [[nodiscard]] bool destroyInternal(AnimationNode& node, ErrorReporting& errorReporting);
-        [[nodiscard]] bool destroyInternal(DataArray& dataArray, ErrorReporting& errorReporting);
-        [[nodiscard]] bool destroyInternal(TimerNode& node, ErrorReporting& errorReporting);
-        [[nodiscard]] bool destroyInternal(AnchorPoint& node, ErrorReporting& errorReporting);
+        // Number of objects of each type, indexed by ELogicObjectType
+        using ObjectTypeCounts = std::array<size_t, static_cast<size_t>(ELogicObjectType::Count)>;
+        [[nodiscard]] bool checkObjectsCanBeDestroyed(const std::unordered_set<const LogicObject*>& destroyedObjects, const ObjectTypeCounts& destroyedCounts, ErrorReporting& errorReporting) const;
 
         std::vector<PropertyLink> collectPropertyLinks() const;
 
+        // Deserializes all objects into this instance, sharedModuleIds is not null when loading additively
+        // and collects IDs of existing modules which are used instead of identical modules from serialized data
+        [[nodiscard]] bool deserializeObjects(
+            const rlogic_serialization::ApiObjects& apiObjects,
+            const IRamsesObjectResolver* ramsesResolver,
+            const std::string& dataSourceDescription,
+            ErrorReporting& errorReporting,
+            const DeserializationOptions& options,
+            DeserializationMap& deserializationMap,
+            std::vector<uint64_t>* sharedModuleIds);
+
+        // Deserialization phases, objects which don't use Lua can be deserialized in parallel with Lua objects
+        struct LuaIndependentObjects
+        {
+            std::vector<std::unique_ptr<RamsesNodeBinding>>       nodeBindings;
+            std::vector<std::unique_ptr<RamsesAppearanceBinding>> appearanceBindings;
+            std::vector<std::unique_ptr<RamsesCameraBinding>>     cameraBindings;
+            std::vector<std::unique_ptr<RamsesRenderPassBinding>> renderPassBindings;
+            std::vector<std::unique_ptr<DataArray>>               dataArrays;
+            std::vector<std::unique_ptr<AnimationNode>>           animationNodes;
+        };
+
+        [[nodiscard]] bool deserializeLuaObjects(
+            const rlogic_serialization::ApiObjects& apiObjects,
+            ErrorReporting& errorReporting,
+            DeserializationMap& deserializationMap,
+            EFeatureLevel featureLevel,
+            bool lazyLuaScriptLoading,
+            std::vector<uint64_t>* sharedModuleIds);
+        // does not access any ApiObjects instance, can run concurrently with deserializeLuaObjects
+        [[nodiscard]] static std::optional<LuaIndependentObjects> DeserializeLuaIndependentObjects(
+            const rlogic_serialization::ApiObjects& apiObjects,
+            const IRamsesObjectResolver* ramsesResolver,
+            ErrorReporting& errorReporting,
+            DeserializationMap& deserializationMap,
+            EFeatureLevel featureLevel);
+        void registerLuaIndependentObjects(LuaIndependentObjects&& objects, DeserializationMap& deserializationMap);
+
         std::unique_ptr<SolState> m_solState {std::make_unique<SolState>()};
 
         ApiObjectContainer<LuaScript>                m_scripts;
@@ -225,17 +293,32 @@ namespace rlogic::internal
         ApiObjectContainer<AnimationNode>            m_animationNodes;
         ApiObjectContainer<TimerNode>                m_timerNodes;
         ApiObjectContainer<AnchorPoint>              m_anchorPoints;
+        ApiObjectContainer<AnimationBlendNode>       m_animationBlendNodes;
         ApiObjectContainer<LogicObject>              m_logicObjects;
         ApiObjectOwningContainer                     m_objectsOwningContainer;
 
         LogicNodeDependencies                        m_logicNodeDependencies;
+        SkinningBatch                                m_skinningBatch;
+        CameraViewProjectionCache                    m_cameraViewProjectionCache;
         uint64_t                                     m_lastObjectId = 0;
 
         std::unordered_map<LogicNodeImpl*, LogicNode*> m_reverseImplMapping;
         std::unordered_map<uint64_t, LogicObject*>     m_logicObjectIdMapping;
+        LogicObjectNameIndex                           m_nameIndex;
+
+        // content loaded additively, objects are referenced by IDs because they can be destroyed individually too
+        struct LoadedPackage
+        {
+            std::vector<uint64_t> objectIds;
+            std::vector<uint64_t> sharedModuleIds;
+        };
+        std::unordered_map<uint64_t, LoadedPackage> m_loadedPackages;
+        uint64_t m_lastPackageId = 0u;
 
         // persistent storage for links to be given out via public API getPropertyLinks()
         mutable std::vector<PropertyLink> m_collectedLinks;
+        // links version of LogicNodeDependencies at time of collection, links are collected again only if it changed
+        mutable std::optional<uint64_t> m_collectedLinksVersion;
 
         EFeatureLevel m_featureLevel;
     };
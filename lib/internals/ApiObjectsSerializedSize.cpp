@@ -11,6 +11,7 @@
 #include "ramses-logic/EFeatureLevel.h"
 
 #include "ramses-logic/AnchorPoint.h"
+#include "ramses-logic/AnimationBlendNode.h"
 #include "ramses-logic/AnimationNode.h"
 #include "ramses-logic/DataArray.h"
 #include "ramses-logic/LuaInterface.h"
@@ -28,6 +29,7 @@
 #include "generated/ApiObjectsGen.h"
 
 #include "impl/AnchorPointImpl.h"
+#include "impl/AnimationBlendNodeImpl.h"
 #include "impl/AnimationNodeImpl.h"
 #include "impl/DataArrayImpl.h"
 #include "impl/LuaInterfaceImpl.h"
@@ -205,6 +207,12 @@ namespace rlogic::internal
         return calculateSerializedSize<AnchorPoint, AnchorPointImpl>(getApiObjectContainer<AnchorPoint>(), m_featureLevel);
     }
 
+    template<>
+    size_t ApiObjects::getSerializedSize<AnimationBlendNode>() const
+    {
+        return calculateSerializedSize<AnimationBlendNode, AnimationBlendNodeImpl>(getApiObjectContainer<AnimationBlendNode>(), m_featureLevel);
+    }
+
     template<>
     size_t ApiObjects::getSerializedSize<LogicObject>() const
     {
@@ -0,0 +1,59 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/CameraViewProjectionCache.h"
+#include "ramses-client-api/Camera.h"
+
+namespace rlogic::internal
+{
+    void CameraViewProjectionCache::invalidate()
+    {
+        m_cache.clear();
+    }
+
+    std::optional<LogicNodeRuntimeError> CameraViewProjectionCache::getViewProjection(const ramses::Camera& camera, CameraViewProjection& viewProjection)
+    {
+        const auto it = m_cache.find(&camera);
+        if (it != m_cache.cend())
+        {
+            viewProjection = it->second;
+            return std::nullopt;
+        }
+
+        auto potentialError = Calculate(camera, viewProjection);
+        if (!potentialError)
+            m_cache.emplace(&camera, viewProjection);
+
+        return potentialError;
+    }
+
+    size_t CameraViewProjectionCache::getCachedCameraCount() const
+    {
+        return m_cache.size();
+    }
+
+    std::optional<LogicNodeRuntimeError> CameraViewProjectionCache::Calculate(const ramses::Camera& camera, CameraViewProjection& viewProjection)
+    {
+        // NOLINTNEXTLINE(modernize-avoid-c-arrays) Ramses uses C array in matrix getters
+        float tempData[16];
+
+        if (camera.getProjectionMatrix(tempData) != ramses::StatusOK)
+            return LogicNodeRuntimeError{ "Failed to retrieve projection matrix from Ramses camera!" };
+        const math::Matrix44f projectionMatrix{ tempData };
+
+        if (camera.getInverseModelMatrix(tempData) != ramses::StatusOK)
+            return LogicNodeRuntimeError{ "Failed to retrieve view matrix from Ramses camera!" };
+        const math::Matrix44f cameraViewMatrix{ tempData };
+
+        math::Matrix44f::Multiply(projectionMatrix, cameraViewMatrix, viewProjection.viewProjectionMatrix);
+        viewProjection.viewportWidth = camera.getViewportWidth();
+        viewProjection.viewportHeight = camera.getViewportHeight();
+
+        return std::nullopt;
+    }
+}
@@ -0,0 +1,48 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/LogicNodeImpl.h"
+#include "internals/Math.h"
+#include <optional>
+#include <unordered_map>
+
+namespace ramses
+{
+    class Camera;
+}
+
+namespace rlogic::internal
+{
+    struct CameraViewProjection
+    {
+        math::Matrix44f viewProjectionMatrix;
+        uint32_t viewportWidth = 0u;
+        uint32_t viewportHeight = 0u;
+    };
+
+    // Caches view-projection matrix and viewport of cameras used by AnchorPoints so that it is retrieved
+    // from Ramses and calculated only once per camera, regardless of number of AnchorPoints using it.
+    // The cache must be invalidated whenever any Ramses state affecting cameras might have changed,
+    // i.e. at the beginning of every update and after execution of every node or camera binding.
+    class CameraViewProjectionCache
+    {
+    public:
+        void invalidate();
+
+        [[nodiscard]] std::optional<LogicNodeRuntimeError> getViewProjection(const ramses::Camera& camera, CameraViewProjection& viewProjection);
+
+        [[nodiscard]] size_t getCachedCameraCount() const;
+
+        [[nodiscard]] static std::optional<LogicNodeRuntimeError> Calculate(const ramses::Camera& camera, CameraViewProjection& viewProjection);
+
+    private:
+        std::unordered_map<const ramses::Camera*, CameraViewProjection> m_cache;
+    };
+}
@@ -0,0 +1,283 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/CompressedContainer.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        constexpr std::array<uint8_t, 4> ContainerMagic{ 'R', 'L', 'Z', '4' };
+        constexpr uint32_t StoredBlockFlag = 0x80000000u;
+
+        // LZ4 block format constants
+        constexpr size_t MinMatch = 4u;
+        constexpr size_t LastLiterals = 5u;
+        constexpr size_t MatchFindLimit = 12u;
+        constexpr size_t MaxOffset = 65535u;
+        constexpr uint32_t HashLog = 12u;
+        constexpr uint8_t RunMask = 15u;
+
+        // worst case LZ4 ratio is about 255:1, larger uncompressed size in header means corrupted data
+        constexpr uint64_t MaxCompressionRatio = 256u;
+
+        uint8_t ByteAt(const uint8_t* data, size_t index)
+        {
+            return data[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) callers check bounds
+        }
+
+        uint32_t Read32(const uint8_t* data, size_t index)
+        {
+            uint32_t value = 0u;
+            std::memcpy(&value, data + index, sizeof(value)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) callers check bounds
+            return value;
+        }
+
+        uint32_t Hash(uint32_t sequence)
+        {
+            return (sequence * 2654435761u) >> (32u - HashLog);
+        }
+
+        void WriteLE(std::vector<uint8_t>& out, uint64_t value, size_t byteCount)
+        {
+            for (size_t i = 0u; i < byteCount; ++i)
+                out.push_back(static_cast<uint8_t>(value >> (8u * i)));
+        }
+
+        uint64_t ReadLE(const uint8_t* data, size_t index, size_t byteCount)
+        {
+            uint64_t value = 0u;
+            for (size_t i = 0u; i < byteCount; ++i)
+                value |= static_cast<uint64_t>(ByteAt(data, index + i)) << (8u * i);
+            return value;
+        }
+
+        void WriteLengthExtension(std::vector<uint8_t>& out, size_t length)
+        {
+            while (length >= 255u)
+            {
+                out.push_back(255u);
+                length -= 255u;
+            }
+            out.push_back(static_cast<uint8_t>(length));
+        }
+
+        void WriteSequence(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalCount, size_t offset, size_t matchLength)
+        {
+            const size_t matchCode = matchLength - MinMatch;
+            const auto token = static_cast<uint8_t>((std::min<size_t>(literalCount, RunMask) << 4u) | std::min<size_t>(matchCode, RunMask));
+            out.push_back(token);
+            if (literalCount >= RunMask)
+                WriteLengthExtension(out, literalCount - RunMask);
+            out.insert(out.end(), literals, literals + literalCount); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) range within input block
+            WriteLE(out, offset, 2u);
+            if (matchCode >= RunMask)
+                WriteLengthExtension(out, matchCode - RunMask);
+        }
+
+        void WriteLastLiterals(std::vector<uint8_t>& out, const uint8_t* literals, size_t literalCount)
+        {
+            out.push_back(static_cast<uint8_t>(std::min<size_t>(literalCount, RunMask) << 4u));
+            if (literalCount >= RunMask)
+                WriteLengthExtension(out, literalCount - RunMask);
+            out.insert(out.end(), literals, literals + literalCount); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) range within input block
+        }
+
+        // greedy single pass compressor producing standard LZ4 block format
+        void CompressBlock(const uint8_t* src, size_t size, std::vector<uint8_t>& out)
+        {
+            std::array<uint32_t, 1u << HashLog> hashTable{};
+            size_t anchor = 0u;
+            size_t pos = 0u;
+
+            if (size > MatchFindLimit)
+            {
+                const size_t lastMatchStart = size - MatchFindLimit;
+                const size_t matchEndLimit = size - LastLiterals;
+                while (pos <= lastMatchStart)
+                {
+                    const uint32_t sequence = Read32(src, pos);
+                    const uint32_t hash = Hash(sequence);
+                    const size_t candidate = hashTable[hash];
+                    hashTable[hash] = static_cast<uint32_t>(pos);
+
+                    if (candidate >= pos || pos - candidate > MaxOffset || Read32(src, candidate) != sequence)
+                    {
+                        ++pos;
+                        continue;
+                    }
+
+                    size_t matchLength = MinMatch;
+                    while (pos + matchLength < matchEndLimit && ByteAt(src, candidate + matchLength) == ByteAt(src, pos + matchLength))
+                        ++matchLength;
+
+                    WriteSequence(out, src + anchor, pos - anchor, pos - candidate, matchLength); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) anchor within block
+                    pos += matchLength;
+                    anchor = pos;
+                }
+            }
+
+            WriteLastLiterals(out, src + anchor, size - anchor); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) anchor within block
+        }
+
+        bool ReadLengthExtension(const uint8_t* src, size_t srcSize, size_t& pos, size_t& length)
+        {
+            uint8_t value = 255u;
+            while (value == 255u)
+            {
+                if (pos >= srcSize)
+                    return false;
+                value = ByteAt(src, pos++);
+                length += value;
+            }
+            return true;
+        }
+
+        // bounds checked decoder, fails if block does not decode to exactly dstSize bytes
+        bool DecompressBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize)
+        {
+            size_t ip = 0u;
+            size_t op = 0u;
+            while (ip < srcSize)
+            {
+                const uint8_t token = ByteAt(src, ip++);
+
+                size_t literalCount = token >> 4u;
+                if (literalCount == RunMask && !ReadLengthExtension(src, srcSize, ip, literalCount))
+                    return false;
+                if (literalCount > srcSize - ip || literalCount > dstSize - op)
+                    return false;
+                std::memcpy(dst + op, src + ip, literalCount); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds checked above
+                ip += literalCount;
+                op += literalCount;
+
+                // last sequence has literals only
+                if (ip == srcSize)
+                    break;
+
+                if (srcSize - ip < 2u)
+                    return false;
+                const auto offset = static_cast<size_t>(ReadLE(src, ip, 2u));
+                ip += 2u;
+                if (offset == 0u || offset > op)
+                    return false;
+
+                size_t matchLength = token & RunMask;
+                if (matchLength == RunMask && !ReadLengthExtension(src, srcSize, ip, matchLength))
+                    return false;
+                matchLength += MinMatch;
+                if (matchLength > dstSize - op)
+                    return false;
+
+                // byte-wise copy, match can overlap with the bytes being written
+                for (size_t i = 0u; i < matchLength; ++i)
+                    dst[op + i] = dst[op - offset + i]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds checked above
+                op += matchLength;
+            }
+
+            return op == dstSize;
+        }
+    }
+
+    std::vector<uint8_t> CompressedContainer::Compress(const void* data, size_t size)
+    {
+        assert(size >= 8u);
+        const auto* src = static_cast<const uint8_t*>(data);
+
+        std::vector<uint8_t> result;
+        result.reserve(HeaderSize + size / 2u);
+        WriteLE(result, 0u, 4u);
+        result.insert(result.end(), src + 4u, src + 8u); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) file identifier bytes
+        result.insert(result.end(), ContainerMagic.cbegin(), ContainerMagic.cend());
+        WriteLE(result, BlockSize, 4u);
+        WriteLE(result, size, 8u);
+
+        std::vector<uint8_t> compressedBlock;
+        compressedBlock.reserve(BlockSize + BlockSize / 255u + 16u);
+        for (size_t blockStart = 0u; blockStart < size; blockStart += BlockSize)
+        {
+            const size_t blockSize = std::min(BlockSize, size - blockStart);
+            const uint8_t* block = src + blockStart; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) within input
+
+            compressedBlock.clear();
+            CompressBlock(block, blockSize, compressedBlock);
+            if (compressedBlock.size() < blockSize)
+            {
+                WriteLE(result, compressedBlock.size(), 4u);
+                result.insert(result.end(), compressedBlock.cbegin(), compressedBlock.cend());
+            }
+            else
+            {
+                // incompressible data is stored as is
+                WriteLE(result, blockSize | StoredBlockFlag, 4u);
+                result.insert(result.end(), block, block + blockSize); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) within input
+            }
+        }
+
+        return result;
+    }
+
+    bool CompressedContainer::IsCompressed(const void* data, size_t size)
+    {
+        if (size < HeaderSize)
+            return false;
+
+        const auto* src = static_cast<const uint8_t*>(data);
+        return ReadLE(src, 0u, 4u) == 0u && std::equal(ContainerMagic.cbegin(), ContainerMagic.cend(), src + 8u); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) within header
+    }
+
+    std::optional<std::vector<uint8_t>> CompressedContainer::Decompress(const void* data, size_t size)
+    {
+        if (!IsCompressed(data, size))
+            return std::nullopt;
+
+        const auto* src = static_cast<const uint8_t*>(data);
+        const auto blockSize = static_cast<size_t>(ReadLE(src, 12u, 4u));
+        const uint64_t uncompressedSize = ReadLE(src, 16u, 8u);
+        if (blockSize == 0u || blockSize >= StoredBlockFlag || uncompressedSize < 8u || uncompressedSize / MaxCompressionRatio > size)
+            return std::nullopt;
+
+        std::vector<uint8_t> result(static_cast<size_t>(uncompressedSize));
+        size_t pos = HeaderSize;
+        for (size_t blockStart = 0u; blockStart < result.size(); blockStart += blockSize)
+        {
+            const size_t expectedBlockSize = std::min(blockSize, result.size() - blockStart);
+            if (size - pos < 4u)
+                return std::nullopt;
+            const auto blockHeader = static_cast<uint32_t>(ReadLE(src, pos, 4u));
+            pos += 4u;
+
+            const size_t storedSize = blockHeader & ~StoredBlockFlag;
+            if (storedSize > size - pos)
+                return std::nullopt;
+
+            const uint8_t* block = src + pos; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) bounds checked above
+            if ((blockHeader & StoredBlockFlag) != 0u)
+            {
+                if (storedSize != expectedBlockSize)
+                    return std::nullopt;
+                std::memcpy(&result[blockStart], block, storedSize);
+            }
+            else if (!DecompressBlock(block, storedSize, &result[blockStart], expectedBlockSize))
+            {
+                return std::nullopt;
+            }
+            pos += storedSize;
+        }
+
+        if (pos != size)
+            return std::nullopt;
+
+        return result;
+    }
+}
@@ -0,0 +1,38 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace rlogic::internal
+{
+    // Wraps serialized logic engine data into LZ4 compressed blocks.
+    // Container layout (all integers little endian):
+    //  - bytes 0-3: zero (never a valid flatbuffers root offset, distinguishes container from plain flatbuffers data)
+    //  - bytes 4-7: file identifier copied from the wrapped flatbuffers data
+    //  - bytes 8-11: container magic
+    //  - bytes 12-15: uncompressed block size
+    //  - bytes 16-23: total uncompressed size
+    //  - blocks: 4 bytes compressed size (highest bit set if block is stored uncompressed) followed by block data
+    class CompressedContainer
+    {
+    public:
+        static constexpr size_t HeaderSize = 24u;
+        static constexpr size_t BlockSize = 256u * 1024u;
+
+        // data must be at least 8 bytes (flatbuffers root offset and file identifier)
+        [[nodiscard]] static std::vector<uint8_t> Compress(const void* data, size_t size);
+        [[nodiscard]] static bool IsCompressed(const void* data, size_t size);
+        // decompresses block by block directly into the returned buffer, returns nullopt if data is corrupted
+        [[nodiscard]] static std::optional<std::vector<uint8_t>> Decompress(const void* data, size_t size);
+    };
+}
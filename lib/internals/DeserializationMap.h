@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <unordered_map>
 
 namespace rlogic_serialization
@@ -30,6 +31,25 @@ namespace rlogic::internal
     class DeserializationMap
     {
     public:
+        DeserializationMap() = default;
+
+        // content loaded additively gets IDs offset by the given value to not collide with IDs of existing objects
+        explicit DeserializationMap(uint64_t idOffset)
+            : m_idOffset{ idOffset }
+        {
+        }
+
+        [[nodiscard]] uint64_t getIdOffset() const
+        {
+            return m_idOffset;
+        }
+
+        // maps ID read from serialized data to ID of the deserialized object
+        [[nodiscard]] uint64_t remapId(uint64_t serializedId) const
+        {
+            return serializedId + m_idOffset;
+        }
+
         void storePropertyImpl(const rlogic_serialization::Property& flatbufferObject, PropertyImpl& impl)
         {
             Store(&flatbufferObject, &impl, m_properties);
@@ -50,24 +70,48 @@ namespace rlogic::internal
             return *Get(&flatbufferObject, m_dataArrays);
         }
 
+        void reserveLogicObjects(size_t count)
+        {
+            m_logicObjects.reserve(count);
+        }
+
+        // id is the (remapped) ID of deserialized object
         void storeLogicObject(uint64_t id, LogicObjectImpl& obj)
         {
             Store(id, &obj, m_logicObjects);
         }
 
+        // id is the ID as read from serialized data
         template <typename ImplT>
         ImplT* resolveLogicObject(uint64_t id) const
         {
             // fail queries using IDs gracefully if given ID not found
             // file can be OK on flatbuffer schema level but might still contain corrupted ID value
-            const auto it = m_logicObjects.find(id);
+            const auto it = m_logicObjects.find(remapId(id));
             if (it != m_logicObjects.cend())
                 return dynamic_cast<ImplT*>(it->second);
 
             return nullptr;
         }
 
+        // merges mappings collected separately (e.g. on other thread), each object must be stored only once
+        void merge(DeserializationMap&& other)
+        {
+            Merge(std::move(other.m_properties), m_properties);
+            Merge(std::move(other.m_dataArrays), m_dataArrays);
+            Merge(std::move(other.m_logicObjects), m_logicObjects);
+        }
+
     private:
+        template <typename Key, typename Value>
+        static void Merge(std::unordered_map<Key, Value>&& source, std::unordered_map<Key, Value>& container)
+        {
+            container.reserve(container.size() + source.size());
+            for (const auto& entry : source)
+                Store(entry.first, entry.second, container);
+            source.clear();
+        }
+
         template <typename Key, typename Value>
         static void Store(Key key, Value value, std::unordered_map<Key, Value>& container)
         {
@@ -87,6 +131,7 @@ namespace rlogic::internal
         std::unordered_map<const rlogic_serialization::Property*, PropertyImpl*> m_properties;
         std::unordered_map<const rlogic_serialization::DataArray*, const DataArray*> m_dataArrays;
         std::unordered_map<uint64_t, LogicObjectImpl*> m_logicObjects;
+        uint64_t m_idOffset = 0u;
     };
 
 }
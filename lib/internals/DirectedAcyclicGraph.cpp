@@ -8,9 +8,11 @@
 
 #include "internals/DirectedAcyclicGraph.h"
 
+#include "impl/LogicNodeImpl.h"
+
 #include <cassert>
 #include <algorithm>
-#include <unordered_set>
+#include <limits>
 #include <numeric>
 #include <iterator>
 
@@ -18,143 +20,121 @@ namespace rlogic::internal
 {
     void DirectedAcyclicGraph::addNode(Node& node)
     {
-        assert(m_nodeOutgoingEdges.count(&node) == 0);
-        assert(m_nodeIncomingEdges.count(&node) == 0);
-        m_nodeOutgoingEdges.insert({ &node, {} });
-        m_nodeIncomingEdges.insert({ &node, {} });
+        assert(!containsNode(node));
+        size_t index = m_nodes.size();
+        if (m_freeIndices.empty())
+        {
+            m_nodes.emplace_back();
+        }
+        else
+        {
+            index = m_freeIndices.back();
+            m_freeIndices.pop_back();
+        }
+
+        NodeEntry& entry = m_nodes[index];
+        assert(entry.node == nullptr && entry.outgoingEdges.empty() && entry.incomingEdges.empty());
+        entry.node = &node;
+        node.setGraphIndex(index);
+    }
+
+    void DirectedAcyclicGraph::reserve(size_t nodeCount)
+    {
+        m_nodes.reserve(nodeCount);
     }
 
     void DirectedAcyclicGraph::removeNode(Node& nodeToRemove)
     {
-        assert(m_nodeOutgoingEdges.count(&nodeToRemove) != 0);
-        assert(m_nodeIncomingEdges.count(&nodeToRemove) != 0);
+        const size_t index = getIndex(nodeToRemove);
+        NodeEntry& entry = m_nodes[index];
 
         // remove node from all edge lists pointing to it from source nodes
-        const auto srcNodesIt = m_nodeIncomingEdges.find(&nodeToRemove);
-        for (const auto srcNode : srcNodesIt->second)
+        for (const size_t srcNode : entry.incomingEdges)
         {
-            EdgeList& srcNodeOutgoingEdges = m_nodeOutgoingEdges.find(srcNode)->second;
+            EdgeList& srcNodeOutgoingEdges = m_nodes[srcNode].outgoingEdges;
             const auto it = std::remove_if(srcNodeOutgoingEdges.begin(), srcNodeOutgoingEdges.end(),
-                [&nodeToRemove](const auto& e) { return e.target == &nodeToRemove; });
+                [index](const auto& e) { return e.target == index; });
             srcNodeOutgoingEdges.erase(it, srcNodeOutgoingEdges.end());
         }
 
         // remove node from all edge lists pointing to it from its target nodes
-        const auto tgtNodesIt = m_nodeOutgoingEdges.find(&nodeToRemove);
-        for (const auto& tgtNode : tgtNodesIt->second)
+        for (const auto& tgtNode : entry.outgoingEdges)
         {
-            auto& tgtNodeEdges = m_nodeIncomingEdges.find(tgtNode.target)->second;
-            tgtNodeEdges.erase(std::find(tgtNodeEdges.begin(), tgtNodeEdges.end(), &nodeToRemove));
+            auto& tgtNodeEdges = m_nodes[tgtNode.target].incomingEdges;
+            tgtNodeEdges.erase(std::find(tgtNodeEdges.begin(), tgtNodeEdges.end(), index));
         }
 
-        // remove node from both maps
-        m_nodeIncomingEdges.erase(srcNodesIt);
-        m_nodeOutgoingEdges.erase(&nodeToRemove);
+        // free the slot for reuse (keeping capacity of edge lists)
+        entry.node = nullptr;
+        entry.outgoingEdges.clear();
+        entry.incomingEdges.clear();
+        m_freeIndices.push_back(index);
+        nodeToRemove.setGraphIndex(Node::InvalidGraphIndex);
     }
 
-    // This is a slightly exotic sorting algorithm for DAGs
-    // It works based on these general principles:
-    // - Traverse the DAG starting from the root nodes
-    // - Keep the nodes in a sparsely sorted queue (with more slots than actual nodes, and some empty slots)
-    // - Any time a new 'edge' is traversed, moves the 'target' node of the edge to the last position of the queue
-    // - If number of iterations exceeds N^2, there was a loop in the graph -> abort
-    // This is supposed to work fast, because the queue is never re-allocated or re-sorted, only grows incrementally, and
-    // we only need to run a second time and remove the 'empty slots' to get the final order.
     std::optional<NodeVector> DirectedAcyclicGraph::getTopologicallySortedNodes() const
     {
-        const size_t totalNodeCount = m_nodeOutgoingEdges.size();
-
-        // This remembers temporarily the position of node N in 'nodeQueue' (see below)
-        // This index can change in different loops of the code below
-        std::unordered_map<const Node*, size_t> nodeIndexIntoQueue;
-        nodeIndexIntoQueue.reserve(totalNodeCount);
-
-        // This is a queue of nodes which is:
-        // - partially sorted (at any given time during the loops, the first X entries are sorted, while the rest is not sorted yet)
-        // - sparse (some entries can be nullptr) - of nodes which were moved during the algorithm, see below
-        // - sorted at the end of the loop (by their topological rank)
-        // - starts with the root nodes (they are always at the beginning)
-        NodeVector sparseNodeQueue = collectRootNodes();
-
-        // Cycle condition - can't find root nodes among a non-empty set of nodes
-        if (sparseNodeQueue.empty() && !m_nodeOutgoingEdges.empty())
-        {
-            return std::nullopt;
-        }
+        return getTopologicallySortedNodes(getNodes());
+    }
 
-        // sparseNodeQueue grows here all the time
-        // TODO Violin rework algorithm to not grow and loop over the same container
-        for (size_t i = 0; i < sparseNodeQueue.size(); ++i)
+    std::optional<NodeVector> DirectedAcyclicGraph::getTopologicallySortedNodes(const NodeVector& nodes) const
+    {
+        // Kahn's algorithm, counts incoming edges of each node and releases node once all its sources are sorted
+        // (only edges among given nodes are counted, nodes not to be sorted are marked)
+        constexpr size_t NotSorted = std::numeric_limits<size_t>::max();
+        std::vector<size_t> remainingIncomingEdges(m_nodes.size(), NotSorted);
+        for (const Node* node : nodes)
+            remainingIncomingEdges[getIndex(*node)] = 0u;
+
+        for (const Node* node : nodes)
         {
-            if (i > totalNodeCount * totalNodeCount)
+            for (const auto& outgoingEdge : m_nodes[node->getGraphIndex()].outgoingEdges)
             {
-                // TODO Violin this is a primitive loop detection. Replace with a proper graph-based solution!
-                // The inner and the outer loop are bound by N(number of nodes), so exceeding that is a
-                // sufficient condition that there was a loop
-                return std::nullopt;
+                size_t& targetIncomingEdges = remainingIncomingEdges[outgoingEdge.target];
+                if (targetIncomingEdges != NotSorted)
+                    ++targetIncomingEdges;
             }
+        }
 
-            // Get the next node in the queue and process based on its outgoing edges
-            Node* nextNode = sparseNodeQueue[i];
-            // sparseNodeQueue has nullptr holes - skip those
-            if (nextNode != nullptr)
-            {
-                const EdgeList& nextNodeEdges = m_nodeOutgoingEdges.find(nextNode)->second;
+        NodeVector sortedNodes;
+        sortedNodes.reserve(nodes.size());
+        for (Node* node : nodes)
+        {
+            if (remainingIncomingEdges[node->getGraphIndex()] == 0u)
+                sortedNodes.push_back(node);
+        }
 
-                // For each edge, put the 'target' node to the end of the queue (this order may be temporarily wrong,
-                // because we don't know if those nodes have also edges between them which would affect this order)
-                // What happens if it's wrong? see the if() inside the loop
-                for (const auto& outgoingEdge : nextNodeEdges)
-                {
-                    // Put the node at the end of the 'sparseNodeQueue' and remember the index
-                    Node* outgoingEdgeTarget = outgoingEdge.target;
-                    sparseNodeQueue.emplace_back(outgoingEdgeTarget);
-                    const size_t targetNodeIndex = sparseNodeQueue.size() - 1;
-
-                    const auto potentiallyAlreadyProcessedNode = nodeIndexIntoQueue.find(outgoingEdgeTarget);
-                    // target node not processed yet?
-                    if (potentiallyAlreadyProcessedNode == nodeIndexIntoQueue.end())
-                    {
-                        // => insert to processed queue, with current index from 'queue'
-                        nodeIndexIntoQueue.insert({ outgoingEdgeTarget, targetNodeIndex });
-                    }
-                    // target node processed already?
-                    else
-                    {
-                        // => move the node from its last computed index to the current one
-                        // (and set to nullptr on its last position so that it does not occur twice in the queue)
-                        // Why do we do this? Because it makes sure that any time there is a 'new edge' to a node,
-                        // it is moved to the last position in the queue, unless it has no 'incoming edges' (root node)
-                        // or it has exactly one incoming edge (and never needs to be re-sorted)
-                        sparseNodeQueue[potentiallyAlreadyProcessedNode->second] = nullptr;
-                        potentiallyAlreadyProcessedNode->second = targetNodeIndex;
-                    }
-                }
+        for (size_t i = 0; i < sortedNodes.size(); ++i)
+        {
+            for (const auto& outgoingEdge : m_nodes[sortedNodes[i]->getGraphIndex()].outgoingEdges)
+            {
+                size_t& targetIncomingEdges = remainingIncomingEdges[outgoingEdge.target];
+                if (targetIncomingEdges != NotSorted && --targetIncomingEdges == 0u)
+                    sortedNodes.push_back(m_nodes[outgoingEdge.target].node);
             }
         }
 
-        // Some nodes are nullptr because of the special 'bubble sort' sorting method
-        sparseNodeQueue.erase(std::remove(sparseNodeQueue.begin(), sparseNodeQueue.end(), nullptr), sparseNodeQueue.end());
+        // Cycle condition - some nodes never lost all their incoming edges
+        if (sortedNodes.size() != nodes.size())
+            return std::nullopt;
 
-        return sparseNodeQueue;
+        return sortedNodes;
     }
 
     bool DirectedAcyclicGraph::addEdge(Node& source, Node& target)
     {
-        assert(m_nodeOutgoingEdges.count(&source) != 0);
-        assert(m_nodeOutgoingEdges.count(&target) != 0);
-        assert(m_nodeIncomingEdges.count(&source) != 0);
-        assert(m_nodeIncomingEdges.count(&target) != 0);
+        const size_t sourceIndex = getIndex(source);
+        const size_t targetIndex = getIndex(target);
 
-        auto& nodeEdges = m_nodeOutgoingEdges.find(&source)->second;
-        auto edgeBetweenNodes = FindEdgeToNode(nodeEdges, target);
+        auto& nodeEdges = m_nodes[sourceIndex].outgoingEdges;
+        auto edgeBetweenNodes = FindEdgeToNode(nodeEdges, targetIndex);
         const bool isNewConnection = (edgeBetweenNodes == nodeEdges.end());
         if (isNewConnection)
         {
-            nodeEdges.push_back({ &target, 1u });
-            auto& tgtToSourcesList = m_nodeIncomingEdges.find(&target)->second;
-            assert(std::find(tgtToSourcesList.cbegin(), tgtToSourcesList.cend(), &source) == tgtToSourcesList.cend());
-            tgtToSourcesList.push_back(&source);
+            nodeEdges.push_back({ targetIndex, 1u });
+            auto& tgtToSourcesList = m_nodes[targetIndex].incomingEdges;
+            assert(std::find(tgtToSourcesList.cbegin(), tgtToSourcesList.cend(), sourceIndex) == tgtToSourcesList.cend());
+            tgtToSourcesList.push_back(sourceIndex);
         }
         else
         {
@@ -166,36 +146,32 @@ namespace rlogic::internal
 
     void DirectedAcyclicGraph::removeEdge(Node& source, Node& target)
     {
-        assert(m_nodeOutgoingEdges.count(&source) != 0);
-        assert(m_nodeOutgoingEdges.count(&target) != 0);
-        assert(m_nodeIncomingEdges.count(&source) != 0);
-        assert(m_nodeIncomingEdges.count(&target) != 0);
+        const size_t sourceIndex = getIndex(source);
+        const size_t targetIndex = getIndex(target);
 
-        auto& srcNodeEdges = m_nodeOutgoingEdges.find(&source)->second;
-        auto outgoingEdge = FindEdgeToNode(srcNodeEdges, target);
+        auto& srcNodeEdges = m_nodes[sourceIndex].outgoingEdges;
+        auto outgoingEdge = FindEdgeToNode(srcNodeEdges, targetIndex);
         assert(outgoingEdge != srcNodeEdges.end());
         assert(outgoingEdge->multiplicity > 0u);
         --outgoingEdge->multiplicity;
         if (outgoingEdge->multiplicity == 0)
         {
             srcNodeEdges.erase(outgoingEdge);
-            auto& tgtToSourcesList = m_nodeIncomingEdges.find(&target)->second;
-            assert(std::find(tgtToSourcesList.cbegin(), tgtToSourcesList.cend(), &source) != tgtToSourcesList.cend());
-            tgtToSourcesList.erase(std::find(tgtToSourcesList.begin(), tgtToSourcesList.end(), &source));
+            auto& tgtToSourcesList = m_nodes[targetIndex].incomingEdges;
+            assert(std::find(tgtToSourcesList.cbegin(), tgtToSourcesList.cend(), sourceIndex) != tgtToSourcesList.cend());
+            tgtToSourcesList.erase(std::find(tgtToSourcesList.begin(), tgtToSourcesList.end(), sourceIndex));
         }
     }
 
     size_t DirectedAcyclicGraph::getInDegree(Node& node) const
     {
-        assert(m_nodeOutgoingEdges.count(&node) != 0);
-        assert(m_nodeIncomingEdges.count(&node) != 0);
+        const size_t index = getIndex(node);
 
         size_t edgeCount = 0u;
-        const auto srcNodesList = m_nodeIncomingEdges.find(&node)->second;
-        for (const auto srcNode : srcNodesList)
+        for (const size_t srcNode : m_nodes[index].incomingEdges)
         {
-            const EdgeList& srcNodeOutgoingEdges = m_nodeOutgoingEdges.find(srcNode)->second;
-            const auto edgeIt = FindEdgeToNode(srcNodeOutgoingEdges, node);
+            const EdgeList& srcNodeOutgoingEdges = m_nodes[srcNode].outgoingEdges;
+            const auto edgeIt = FindEdgeToNode(srcNodeOutgoingEdges, index);
             assert(edgeIt != srcNodeOutgoingEdges.cend());
             edgeCount += edgeIt->multiplicity;
         }
@@ -205,40 +181,89 @@ namespace rlogic::internal
 
     size_t DirectedAcyclicGraph::getOutDegree(Node& node) const
     {
-        assert(containsNode(node));
-        const auto it = m_nodeOutgoingEdges.find(&node);
-        return std::accumulate(it->second.cbegin(), it->second.cend(), size_t(0u), [](size_t sum, const Edge& e) {
+        const EdgeList& edges = m_nodes[getIndex(node)].outgoingEdges;
+        return std::accumulate(edges.cbegin(), edges.cend(), size_t(0u), [](size_t sum, const Edge& e) {
             return sum + e.multiplicity;
         });
     }
 
-    NodeVector DirectedAcyclicGraph::collectRootNodes() const
+    NodeVector DirectedAcyclicGraph::getNodes() const
     {
-        NodeVector rootNodes;
-        // reserve to all nodes count because it will be used to store all sorted nodes later
-        rootNodes.reserve(m_nodeIncomingEdges.size());
+        NodeVector nodes;
+        nodes.reserve(m_nodes.size() - m_freeIndices.size());
+        for (const auto& entry : m_nodes)
+        {
+            if (entry.node != nullptr)
+                nodes.push_back(entry.node);
+        }
+
+        return nodes;
+    }
+
+    NodeVector DirectedAcyclicGraph::getReachableNodes(const NodeVector& rootNodes, const NodeVector& sortedNodes) const
+    {
+        std::vector<bool> reached(m_nodes.size(), false);
+        std::vector<size_t> nodesToVisit;
+        nodesToVisit.reserve(rootNodes.size());
+        for (const Node* node : rootNodes)
+        {
+            const size_t index = getIndex(*node);
+            if (!reached[index])
+            {
+                reached[index] = true;
+                nodesToVisit.push_back(index);
+            }
+        }
 
-        for (const auto& nodeIngoingEdges : m_nodeIncomingEdges)
+        size_t reachedCount = nodesToVisit.size();
+        while (!nodesToVisit.empty())
         {
-            if (nodeIngoingEdges.second.empty())
-                rootNodes.push_back(nodeIngoingEdges.first);
+            const size_t index = nodesToVisit.back();
+            nodesToVisit.pop_back();
+            for (const auto& outgoingEdge : m_nodes[index].outgoingEdges)
+            {
+                if (!reached[outgoingEdge.target])
+                {
+                    reached[outgoingEdge.target] = true;
+                    nodesToVisit.push_back(outgoingEdge.target);
+                    ++reachedCount;
+                }
+            }
         }
 
-        return rootNodes;
+        NodeVector reachedNodes;
+        reachedNodes.reserve(reachedCount);
+        for (Node* node : sortedNodes)
+        {
+            if (reached[getIndex(*node)])
+                reachedNodes.push_back(node);
+        }
+        assert(reachedNodes.size() == reachedCount);
+
+        return reachedNodes;
     }
 
     bool DirectedAcyclicGraph::containsNode(Node& node) const
     {
-        return m_nodeOutgoingEdges.find(&node) != m_nodeOutgoingEdges.end();
+        // node of another graph can have an index which is valid in this graph
+        const size_t index = node.getGraphIndex();
+        return index < m_nodes.size() && m_nodes[index].node == &node;
+    }
+
+    size_t DirectedAcyclicGraph::getIndex(const Node& node) const
+    {
+        const size_t index = node.getGraphIndex();
+        assert(index < m_nodes.size() && m_nodes[index].node == &node);
+        return index;
     }
 
-    DirectedAcyclicGraph::EdgeList::const_iterator DirectedAcyclicGraph::FindEdgeToNode(const EdgeList& vec, const Node& node)
+    DirectedAcyclicGraph::EdgeList::const_iterator DirectedAcyclicGraph::FindEdgeToNode(const EdgeList& vec, size_t nodeIndex)
     {
-        return std::find_if(vec.begin(), vec.end(), [&node](const auto& e) { return e.target == &node; });
+        return std::find_if(vec.begin(), vec.end(), [nodeIndex](const auto& e) { return e.target == nodeIndex; });
     }
 
-    DirectedAcyclicGraph::EdgeList::iterator DirectedAcyclicGraph::FindEdgeToNode(EdgeList& vec, const Node& node)
+    DirectedAcyclicGraph::EdgeList::iterator DirectedAcyclicGraph::FindEdgeToNode(EdgeList& vec, size_t nodeIndex)
     {
-        return std::find_if(vec.begin(), vec.end(), [&node](const auto& e) { return e.target == &node; });
+        return std::find_if(vec.begin(), vec.end(), [nodeIndex](const auto& e) { return e.target == nodeIndex; });
     }
 }
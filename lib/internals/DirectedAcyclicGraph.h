@@ -10,13 +10,13 @@
 
 #include <vector>
 #include <optional>
-#include <unordered_map>
 #include <cstdint>
+#include <cstddef>
 
 namespace rlogic::internal
 {
-    // We don't depend on any functionality of LogicNodeImpl here, just using the
-    // pointer as a unique identifier of the node
+    // The only functionality of LogicNodeImpl used here is the dense graph index stored in the node,
+    // otherwise the pointer serves as unique identifier of the node
     class LogicNodeImpl;
 
     // TODO narrow down the scope of this typedef
@@ -30,6 +30,8 @@ namespace rlogic::internal
     // number of total links of node properties to other nodes' properties, i.e. if two nodes A and B have three connected
     // properties, and node A and C have two connected properties, then addEdge(A, B) will have been called 3 times,
     // addEdge(A, C) two times, and A will have outDegree=5.
+    // Each node gets a dense index when added (stored in the node itself), nodes and their edges are kept in a vector
+    // addressed by that index, so that neither edge updates nor sorting need any hash lookups.
     // Topological sort result is cached because it's sensitive for performance (and is only
     // executed once before update()
     class DirectedAcyclicGraph
@@ -41,11 +43,18 @@ namespace rlogic::internal
         void addNode(Node& node);
         void removeNode(Node& node);
         [[nodiscard]] bool containsNode(Node& node) const;
+        // Prepares node storage for given total number of nodes to avoid reallocation when adding them
+        void reserve(size_t nodeCount);
 
         bool addEdge(Node& source, Node& target);
         void removeEdge(Node& source, Node& target);
 
         [[nodiscard]] std::optional<NodeVector> getTopologicallySortedNodes() const;
+        // Sorts only given nodes, edges to or from nodes outside of them are ignored
+        [[nodiscard]] std::optional<NodeVector> getTopologicallySortedNodes(const NodeVector& nodes) const;
+        [[nodiscard]] NodeVector getNodes() const;
+        // Returns given root nodes and all nodes reachable from them, in order of given sorted nodes (which must contain all of them)
+        [[nodiscard]] NodeVector getReachableNodes(const NodeVector& rootNodes, const NodeVector& sortedNodes) const;
 
         // For testing only
         [[nodiscard]] size_t getInDegree(Node& node) const;
@@ -54,23 +63,28 @@ namespace rlogic::internal
     private:
         struct Edge
         {
-            Node* target = nullptr;
+            size_t target = 0u;
             size_t multiplicity = 0u;
         };
         using EdgeList = std::vector<Edge>;
 
-        NodeVector collectRootNodes() const;
+        struct NodeEntry
+        {
+            // nullptr if slot is free (node was removed)
+            Node* node = nullptr;
+            // Edges from this node to target nodes (edge can have more than 1 instance represented by multiplicity)
+            EdgeList outgoingEdges;
+            // Reverse relation to indices of all source nodes (here without keeping edge multiplicity count)
+            std::vector<size_t> incomingEdges;
+        };
 
-        static EdgeList::const_iterator FindEdgeToNode(const EdgeList& vec, const Node& node);
-        static EdgeList::iterator FindEdgeToNode(EdgeList& vec, const Node& node);
+        [[nodiscard]] size_t getIndex(const Node& node) const;
 
-        // Stores both nodes and their edges in one hashmap
-        // If a node has no outgoing links, the 'EdgeList' is empty
-        // Each entry in 'EdgeList' represents an edge to another node
+        static EdgeList::const_iterator FindEdgeToNode(const EdgeList& vec, size_t nodeIndex);
+        static EdgeList::iterator FindEdgeToNode(EdgeList& vec, size_t nodeIndex);
 
-        // Edges from source node to target nodes (edge can have more than 1 instance represented by multiplicity)
-        std::unordered_map<Node*, EdgeList> m_nodeOutgoingEdges;
-        // Reverse relation from target node to all its source nodes (here without keeping edge multiplicity count)
-        std::unordered_map<Node*, NodeVector> m_nodeIncomingEdges;
+        // Indexed by the dense node index, slots of removed nodes are reused by nodes added later
+        std::vector<NodeEntry> m_nodes;
+        std::vector<size_t> m_freeIndices;
     };
 }
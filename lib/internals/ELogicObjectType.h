@@ -0,0 +1,74 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace rlogic
+{
+    class LuaScript;
+    class LuaInterface;
+    class LuaModule;
+    class RamsesNodeBinding;
+    class RamsesAppearanceBinding;
+    class RamsesCameraBinding;
+    class RamsesRenderPassBinding;
+    class RamsesRenderGroupBinding;
+    class RamsesMeshNodeBinding;
+    class SkinBinding;
+    class DataArray;
+    class AnimationNode;
+    class TimerNode;
+    class AnchorPoint;
+    class AnimationBlendNode;
+}
+
+namespace rlogic::internal
+{
+    // Concrete type of logic object, assigned when object is registered in ApiObjects
+    // so that type specific handling does not need to probe the type with dynamic_cast
+    enum class ELogicObjectType : uint8_t
+    {
+        Unknown,
+        LuaScript,
+        LuaInterface,
+        LuaModule,
+        RamsesNodeBinding,
+        RamsesAppearanceBinding,
+        RamsesCameraBinding,
+        RamsesRenderPassBinding,
+        RamsesRenderGroupBinding,
+        RamsesMeshNodeBinding,
+        SkinBinding,
+        DataArray,
+        AnimationNode,
+        TimerNode,
+        AnchorPoint,
+        AnimationBlendNode,
+        Count
+    };
+
+    // Maps concrete logic object class to its type tag, Unknown for abstract classes
+    template <typename T> inline constexpr ELogicObjectType LogicObjectTypeOf = ELogicObjectType::Unknown;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<LuaScript> = ELogicObjectType::LuaScript;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<LuaInterface> = ELogicObjectType::LuaInterface;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<LuaModule> = ELogicObjectType::LuaModule;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<RamsesNodeBinding> = ELogicObjectType::RamsesNodeBinding;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<RamsesAppearanceBinding> = ELogicObjectType::RamsesAppearanceBinding;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<RamsesCameraBinding> = ELogicObjectType::RamsesCameraBinding;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<RamsesRenderPassBinding> = ELogicObjectType::RamsesRenderPassBinding;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<RamsesRenderGroupBinding> = ELogicObjectType::RamsesRenderGroupBinding;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<RamsesMeshNodeBinding> = ELogicObjectType::RamsesMeshNodeBinding;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<SkinBinding> = ELogicObjectType::SkinBinding;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<DataArray> = ELogicObjectType::DataArray;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<AnimationNode> = ELogicObjectType::AnimationNode;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<TimerNode> = ELogicObjectType::TimerNode;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<AnchorPoint> = ELogicObjectType::AnchorPoint;
+    template <> inline constexpr ELogicObjectType LogicObjectTypeOf<AnimationBlendNode> = ELogicObjectType::AnimationBlendNode;
+}
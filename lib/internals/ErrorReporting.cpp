@@ -11,6 +11,8 @@
 #include "impl/LoggerImpl.h"
 #include "impl/LogicObjectImpl.h"
 
+#include <iterator>
+
 namespace rlogic::internal
 {
     void ErrorReporting::add(std::string errorMessage, const LogicObject* logicObject, EErrorType type)
@@ -27,6 +29,12 @@ namespace rlogic::internal
         m_errors.emplace_back(ErrorData{ std::move(errorMessage), type, logicObject });
     }
 
+    void ErrorReporting::append(ErrorReporting&& other)
+    {
+        m_errors.insert(m_errors.end(), std::make_move_iterator(other.m_errors.begin()), std::make_move_iterator(other.m_errors.end()));
+        other.m_errors.clear();
+    }
+
     void ErrorReporting::clear()
     {
         m_errors.clear();
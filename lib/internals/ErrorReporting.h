@@ -20,6 +20,8 @@ namespace rlogic::internal
 
         void clear();
         void add(std::string errorMessage, const LogicObject* logicObject, EErrorType type);
+        // appends errors collected separately (e.g. on other thread), these were already logged when added
+        void append(ErrorReporting&& other);
 
         [[nodiscard]] const std::vector<rlogic::ErrorData>& getErrors() const;
 
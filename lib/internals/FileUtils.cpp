@@ -9,6 +9,15 @@
 #include "FileUtils.h"
 #include "StdFilesystemWrapper.h"
 #include <fstream>
+#include <algorithm>
+#include <limits>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#include <cerrno>
+#endif
 
 namespace rlogic::internal
 {
@@ -50,25 +59,39 @@ namespace rlogic::internal
 
     std::optional<std::vector<char>> FileUtils::LoadBinary(int fd, size_t offset, size_t size)
     {
-        std::unique_ptr<FILE, decltype(&fclose)> file(fdopen(fd, "rb"), &fclose);
-        if (!file)
+        // read using descriptor directly, it is owned by caller and must stay open
+        std::vector<char> byteBuffer(size);
+        size_t bytesRead = 0u;
+#if defined(_WIN32)
+        if (_lseeki64(fd, static_cast<__int64>(offset), SEEK_SET) < 0)
         {
             return std::nullopt;
         }
-
-        // NOLINTNEXTLINE(google-runtime-int) long cast required to match with fseek declaration
-        if (fseek(file.get(), static_cast<long>(offset), SEEK_SET) != 0)
+        while (bytesRead < size)
         {
-            return std::nullopt;
+            const auto chunkSize = static_cast<unsigned int>(std::min<size_t>(size - bytesRead, std::numeric_limits<int>::max()));
+            const int result = _read(fd, byteBuffer.data() + bytesRead, chunkSize); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) reading into buffer in chunks
+            if (result <= 0)
+            {
+                return std::nullopt;
+            }
+            bytesRead += static_cast<size_t>(result);
         }
-
-        std::vector<char> byteBuffer(size);
-
-        const auto bytesRead = fread(byteBuffer.data(), 1, size, file.get());
-        if (bytesRead != size)
+#else
+        while (bytesRead < size)
         {
-            return std::nullopt;
+            const ssize_t result = pread(fd, byteBuffer.data() + bytesRead, size - bytesRead, static_cast<off_t>(offset + bytesRead)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) reading into buffer in chunks
+            if (result < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            if (result <= 0)
+            {
+                return std::nullopt;
+            }
+            bytesRead += static_cast<size_t>(result);
         }
+#endif
         return byteBuffer;
     }
 }
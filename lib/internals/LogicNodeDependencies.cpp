@@ -34,17 +34,48 @@ namespace rlogic::internal
     {
         assert(m_logicNodeDAG.containsNode(node));
         m_logicNodeDAG.removeNode(node);
+        ++m_linksVersion;
 
         // Remove the node from the cache without reordering the rest (unless there is no cache yet)
         // Removing nodes does not require topology update (we don't guarantee specific ordering when
         // nodes are not related, we only guarantee relative ordering when nodes are linked)
         if (m_cachedTopologicallySortedNodes)
         {
+            // search from the back, nodes are usually destroyed in reverse order of their creation
+            // (node might not be in cache if it was added after last topology update)
             NodeVector& cachedNodes = *m_cachedTopologicallySortedNodes;
-            cachedNodes.erase(std::remove(cachedNodes.begin(), cachedNodes.end(), &node), cachedNodes.end());
+            const auto it = std::find(cachedNodes.rbegin(), cachedNodes.rend(), &node);
+            if (it != cachedNodes.rend())
+                cachedNodes.erase(std::next(it).base());
+            ++m_topologyCacheVersion;
         }
     }
 
+    void LogicNodeDependencies::removeNodes(const NodeSet& nodes)
+    {
+        for (auto node : nodes)
+        {
+            assert(m_logicNodeDAG.containsNode(*node));
+            m_logicNodeDAG.removeNode(*node);
+        }
+        ++m_linksVersion;
+
+        // Same as removeNode but compacts the cache only once for all removed nodes
+        if (m_cachedTopologicallySortedNodes)
+        {
+            NodeVector& cachedNodes = *m_cachedTopologicallySortedNodes;
+            cachedNodes.erase(std::remove_if(cachedNodes.begin(), cachedNodes.end(), [&nodes](LogicNodeImpl* node) { return nodes.count(node) != 0u; }), cachedNodes.end());
+            ++m_topologyCacheVersion;
+        }
+    }
+
+    void LogicNodeDependencies::reserve(size_t nodeCount)
+    {
+        m_logicNodeDAG.reserve(nodeCount);
+        if (m_cachedTopologicallySortedNodes)
+            m_cachedTopologicallySortedNodes->reserve(nodeCount);
+    }
+
     bool LogicNodeDependencies::isLinked(const LogicNodeImpl& logicNode) const
     {
         auto inputs = logicNode.getInputs();
@@ -93,11 +124,57 @@ namespace rlogic::internal
         {
             m_cachedTopologicallySortedNodes = m_logicNodeDAG.getTopologicallySortedNodes();
             m_nodeTopologyChanged = false;
+            ++m_topologyCacheVersion;
         }
 
         return m_cachedTopologicallySortedNodes;
     }
 
+    bool LogicNodeDependencies::isTopologyCacheValid() const
+    {
+        return !m_nodeTopologyChanged && m_cachedTopologicallySortedNodes;
+    }
+
+    uint64_t LogicNodeDependencies::getTopologyCacheVersion() const
+    {
+        return m_topologyCacheVersion;
+    }
+
+    NodeVector LogicNodeDependencies::getDownstreamNodes(const NodeVector& rootNodes) const
+    {
+        assert(isTopologyCacheValid());
+        return m_logicNodeDAG.getReachableNodes(rootNodes, *m_cachedTopologicallySortedNodes);
+    }
+
+    std::optional<NodeVector> LogicNodeDependencies::sortNodesIgnoring(const NodeSet& ignoredNodes) const
+    {
+        NodeVector nodes = m_logicNodeDAG.getNodes();
+        if (!ignoredNodes.empty())
+            nodes.erase(std::remove_if(nodes.begin(), nodes.end(), [&ignoredNodes](LogicNodeImpl* node) { return ignoredNodes.count(node) != 0u; }), nodes.end());
+
+        return m_logicNodeDAG.getTopologicallySortedNodes(nodes);
+    }
+
+    void LogicNodeDependencies::setTopologicallySortedNodes(NodeVector sortedNodes)
+    {
+        m_cachedTopologicallySortedNodes = std::move(sortedNodes);
+        m_nodeTopologyChanged = false;
+        ++m_topologyCacheVersion;
+    }
+
+    void LogicNodeDependencies::appendToTopologyCache(const NodeVector& nodes)
+    {
+        assert(m_cachedTopologicallySortedNodes);
+        // if the nodes can't be sorted, cache stays invalidated and whole graph is sorted on next access
+        const auto sortedNodes = m_logicNodeDAG.getTopologicallySortedNodes(nodes);
+        if (!sortedNodes)
+            return;
+
+        m_cachedTopologicallySortedNodes->insert(m_cachedTopologicallySortedNodes->end(), sortedNodes->cbegin(), sortedNodes->cend());
+        m_nodeTopologyChanged = false;
+        ++m_topologyCacheVersion;
+    }
+
     bool LogicNodeDependencies::link(PropertyImpl& output, PropertyImpl& input, bool isWeakLink, ErrorReporting& errorReporting)
     {
         if (!m_logicNodeDAG.containsNode(output.getLogicNode()))
@@ -156,6 +233,7 @@ namespace rlogic::internal
         }
 
         input.setIncomingLink(output, isWeakLink);
+        ++m_linksVersion;
 
         if (!isWeakLink)
         {
@@ -202,10 +280,16 @@ namespace rlogic::internal
         }
 
         input.resetIncomingLink();
+        ++m_linksVersion;
 
         return true;
     }
 
+    uint64_t LogicNodeDependencies::getLinksVersion() const
+    {
+        return m_linksVersion;
+    }
+
     void LogicNodeDependencies::addBindingDependency(RamsesBindingImpl& binding, LogicNodeImpl& node)
     {
         assert(m_logicNodeDAG.containsNode(node));
@@ -224,4 +308,23 @@ namespace rlogic::internal
 
         m_logicNodeDAG.removeEdge(binding, node);
     }
+
+    void LogicNodeDependencies::addNodeDependency(LogicNodeImpl& source, LogicNodeImpl& node)
+    {
+        assert(m_logicNodeDAG.containsNode(node));
+        assert(m_logicNodeDAG.containsNode(source));
+        assert(&node != &source);
+
+        if (m_logicNodeDAG.addEdge(source, node))
+            m_nodeTopologyChanged = true;
+    }
+
+    void LogicNodeDependencies::removeNodeDependency(LogicNodeImpl& source, LogicNodeImpl& node)
+    {
+        assert(m_logicNodeDAG.containsNode(node));
+        assert(m_logicNodeDAG.containsNode(source));
+        assert(&node != &source);
+
+        m_logicNodeDAG.removeEdge(source, node);
+    }
 }
@@ -10,6 +10,7 @@
 
 #include "internals/DirectedAcyclicGraph.h"
 
+#include <cstdint>
 #include <unordered_set>
 
 namespace rlogic::internal
@@ -28,20 +29,41 @@ namespace rlogic::internal
     public:
         // The primary purpose of this class
         [[nodiscard]] const std::optional<NodeVector>& getTopologicallySortedNodes();
+        [[nodiscard]] bool isTopologyCacheValid() const;
+        // Changes whenever the cached order changes, so that data derived from it can be updated
+        [[nodiscard]] uint64_t getTopologyCacheVersion() const;
+        // Sorts given nodes and appends them to valid cached order, nodes must be linked only among each other
+        void appendToTopologyCache(const NodeVector& nodes);
+        // Returns given nodes and all nodes depending on them (directly or indirectly) in cached order, cache must be valid
+        [[nodiscard]] NodeVector getDownstreamNodes(const NodeVector& rootNodes) const;
+        // Sorts all nodes except ignored ones (e.g. nodes about to be removed) without touching cached order,
+        // std::nullopt if remaining nodes contain a cycle
+        [[nodiscard]] std::optional<NodeVector> sortNodesIgnoring(const NodeSet& ignoredNodes) const;
+        // Replaces cached order with given order, which must contain all nodes sorted
+        void setTopologicallySortedNodes(NodeVector sortedNodes);
 
         // Nodes management
         void addNode(LogicNodeImpl& node);
         void removeNode(LogicNodeImpl& node);
+        void removeNodes(const NodeSet& nodes);
+        // Prepares storage (graph and topology cache) for given total number of nodes
+        void reserve(size_t nodeCount);
 
         // Link management
         bool link(PropertyImpl& output, PropertyImpl& input, bool isWeakLink, ErrorReporting& errorReporting);
         bool unlink(PropertyImpl& output, PropertyImpl& input, ErrorReporting& errorReporting);
         [[nodiscard]] bool isLinked(const LogicNodeImpl& node) const;
+        // Changes whenever a link is created or removed, including links removed together with their node
+        [[nodiscard]] uint64_t getLinksVersion() const;
 
         // Dependency between binding and node, i.e. node depends on binding
         void addBindingDependency(RamsesBindingImpl& binding, LogicNodeImpl& node);
         void removeBindingDependency(RamsesBindingImpl& binding, LogicNodeImpl& node);
 
+        // Dependency between two nodes which is not expressed by links, i.e. node reads data of source directly
+        void addNodeDependency(LogicNodeImpl& source, LogicNodeImpl& node);
+        void removeNodeDependency(LogicNodeImpl& source, LogicNodeImpl& node);
+
     private:
         DirectedAcyclicGraph m_logicNodeDAG;
 
@@ -50,5 +72,7 @@ namespace rlogic::internal
         // Initial state: no nodes and no need to re-compute node topology
         std::optional<NodeVector> m_cachedTopologicallySortedNodes = NodeVector{};
         bool m_nodeTopologyChanged = false;
+        uint64_t m_linksVersion = 0u;
+        uint64_t m_topologyCacheVersion = 0u;
     };
 }
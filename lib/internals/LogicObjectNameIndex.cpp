@@ -0,0 +1,129 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/LogicObjectNameIndex.h"
+
+#include "ramses-logic/LogicObject.h"
+#include "impl/LogicObjectImpl.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace rlogic::internal
+{
+    void LogicObjectNameIndex::add(LogicObject& object)
+    {
+        const Entry entry{ m_registrationCounter++, &object };
+        const ELogicObjectType type = object.m_impl->getObjectType();
+        Insert(m_nameMaps[static_cast<size_t>(ELogicObjectType::Unknown)], object.getName(), entry);
+        if (type != ELogicObjectType::Unknown)
+            Insert(m_nameMaps[static_cast<size_t>(type)], object.getName(), entry);
+    }
+
+    void LogicObjectNameIndex::remove(const LogicObject& object)
+    {
+        const ELogicObjectType type = object.m_impl->getObjectType();
+        Extract(m_nameMaps[static_cast<size_t>(ELogicObjectType::Unknown)], object.getName(), object);
+        if (type != ELogicObjectType::Unknown)
+            Extract(m_nameMaps[static_cast<size_t>(type)], object.getName(), object);
+    }
+
+    void LogicObjectNameIndex::remove(const std::unordered_set<const LogicObject*>& objects)
+    {
+        // buckets shared by multiple objects are compacted once after all objects were processed
+        std::unordered_map<Bucket*, std::pair<NameMap*, std::string_view>> sharedBuckets;
+        const auto removeFrom = [&sharedBuckets](NameMap& nameMap, const LogicObject& object) {
+            const auto it = nameMap.find(std::string{ object.getName() });
+            assert(it != nameMap.end());
+            if (it->second.size() == 1u)
+                nameMap.erase(it);
+            else
+                sharedBuckets.emplace(&it->second, std::make_pair(&nameMap, object.getName()));
+        };
+
+        for (const LogicObject* object : objects)
+        {
+            const ELogicObjectType type = object->m_impl->getObjectType();
+            removeFrom(m_nameMaps[static_cast<size_t>(ELogicObjectType::Unknown)], *object);
+            if (type != ELogicObjectType::Unknown)
+                removeFrom(m_nameMaps[static_cast<size_t>(type)], *object);
+        }
+
+        for (auto& [bucket, nameMapAndName] : sharedBuckets)
+        {
+            bucket->erase(std::remove_if(bucket->begin(), bucket->end(), [&objects](const Entry& e) { return objects.count(e.object) != 0u; }), bucket->end());
+            if (bucket->empty())
+                nameMapAndName.first->erase(std::string{ nameMapAndName.second });
+        }
+    }
+
+    void LogicObjectNameIndex::rename(const LogicObject& object, std::string_view oldName, std::string_view newName)
+    {
+        if (oldName == newName)
+            return;
+
+        const ELogicObjectType type = object.m_impl->getObjectType();
+        NameMap& allObjects = m_nameMaps[static_cast<size_t>(ELogicObjectType::Unknown)];
+        const Entry entry = Extract(allObjects, oldName, object);
+        Insert(allObjects, newName, entry);
+        if (type != ELogicObjectType::Unknown)
+        {
+            NameMap& typedObjects = m_nameMaps[static_cast<size_t>(type)];
+            Extract(typedObjects, oldName, object);
+            Insert(typedObjects, newName, entry);
+        }
+    }
+
+    void LogicObjectNameIndex::reserve(size_t objectCount)
+    {
+        m_nameMaps[static_cast<size_t>(ELogicObjectType::Unknown)].reserve(objectCount);
+    }
+
+    LogicObject* LogicObjectNameIndex::find(std::string_view name, ELogicObjectType type) const
+    {
+        const NameMap& nameMap = m_nameMaps[static_cast<size_t>(type)];
+        const auto it = nameMap.find(std::string{ name });
+        if (it == nameMap.cend())
+            return nullptr;
+
+        assert(!it->second.empty());
+        return it->second.front().object;
+    }
+
+    void LogicObjectNameIndex::Insert(NameMap& nameMap, std::string_view name, const Entry& entry)
+    {
+        Bucket& bucket = nameMap[std::string{ name }];
+        if (bucket.empty() || bucket.back().registrationIndex < entry.registrationIndex)
+        {
+            bucket.push_back(entry);
+            return;
+        }
+
+        // renamed object gets back to the position given by its registration
+        const auto it = std::upper_bound(bucket.begin(), bucket.end(), entry.registrationIndex,
+            [](uint64_t registrationIndex, const Entry& e) { return registrationIndex < e.registrationIndex; });
+        bucket.insert(it, entry);
+    }
+
+    LogicObjectNameIndex::Entry LogicObjectNameIndex::Extract(NameMap& nameMap, std::string_view name, const LogicObject& object)
+    {
+        const auto bucketIt = nameMap.find(std::string{ name });
+        assert(bucketIt != nameMap.end());
+        Bucket& bucket = bucketIt->second;
+
+        // objects are usually destroyed in reverse order of their registration
+        const auto it = std::find_if(bucket.rbegin(), bucket.rend(), [&object](const Entry& e) { return e.object == &object; });
+        assert(it != bucket.rend());
+        const Entry entry = *it;
+        bucket.erase(std::next(it).base());
+        if (bucket.empty())
+            nameMap.erase(bucketIt);
+
+        return entry;
+    }
+}
@@ -0,0 +1,61 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/ELogicObjectType.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace rlogic
+{
+    class LogicObject;
+}
+
+namespace rlogic::internal
+{
+    // Maps names to registered logic objects, both per object type and for all objects regardless of type.
+    // Objects sharing a name are kept in order of their registration, so that lookup returns the same object
+    // as a linear search over the object containers would.
+    class LogicObjectNameIndex
+    {
+    public:
+        void add(LogicObject& object);
+        void remove(const LogicObject& object);
+        void remove(const std::unordered_set<const LogicObject*>& objects);
+        // must be called before the object name changes
+        void rename(const LogicObject& object, std::string_view oldName, std::string_view newName);
+        // Prepares index of all objects for given total number of objects (assuming mostly unique names)
+        void reserve(size_t objectCount);
+
+        // type Unknown searches among all objects
+        [[nodiscard]] LogicObject* find(std::string_view name, ELogicObjectType type) const;
+
+    private:
+        struct Entry
+        {
+            uint64_t registrationIndex;
+            LogicObject* object;
+        };
+        using Bucket = std::vector<Entry>;
+        using NameMap = std::unordered_map<std::string, Bucket>;
+
+        static void Insert(NameMap& nameMap, std::string_view name, const Entry& entry);
+        static Entry Extract(NameMap& nameMap, std::string_view name, const LogicObject& object);
+
+        // index 0 (ELogicObjectType::Unknown) holds all objects
+        std::array<NameMap, static_cast<size_t>(ELogicObjectType::Count)> m_nameMaps;
+        uint64_t m_registrationCounter = 0u;
+    };
+}
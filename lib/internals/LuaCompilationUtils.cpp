@@ -24,16 +24,14 @@
 
 namespace rlogic::internal
 {
-    std::optional<LuaCompiledScript> LuaCompilationUtils::CompileScriptOrImportPrecompiled(
+    std::optional<LuaCompilationUtils::LoadedScript> LuaCompilationUtils::LoadScriptAndRunInit(
         SolState& solState,
         const ModuleMapping& userModules,
         const StandardModules& stdModules,
-        std::string source,
+        const std::string& source,
         std::string_view name,
         ErrorReporting& errorReporting,
-        sol::bytecode byteCodeFromPrecompiledScript,
-        std::unique_ptr<Property> inputsFromPrecompiledScript,
-        std::unique_ptr<Property> outputsFromPrecompiledScript,
+        sol::bytecode& byteCode,
         EFeatureLevel featureLevel,
         bool enableDebugLogFunctions)
     {
@@ -47,10 +45,10 @@ namespace rlogic::internal
         sol::protected_function mainFunction{};
         const std::string debuggingName = (featureLevel == EFeatureLevel_01 ? std::string(name) : "RL_lua_script");
 
-        if (!byteCodeFromPrecompiledScript.empty())
+        if (!byteCode.empty())
         {
             ScopedEnvironmentProtection p(env, EEnvProtectionFlag::LoadScript);
-            main_result = solState.loadScriptByteCode(byteCodeFromPrecompiledScript.as_string_view(), debuggingName, env);
+            main_result = solState.loadScriptByteCode(byteCode.as_string_view(), debuggingName, env);
             if (!main_result.valid())
             {
                 sol::error error = main_result;
@@ -62,11 +60,11 @@ namespace rlogic::internal
                 }
 
                 LOG_WARN("Performance warning! Error during loading of LuaScript '{}' from pre-compiled byte code, will try to recompile script from source code. Error:\n{}!", name, error.what());
-                byteCodeFromPrecompiledScript.clear();
+                byteCode.clear();
             }
         }
 
-        if (byteCodeFromPrecompiledScript.empty())
+        if (byteCode.empty())
         {
             load_result = solState.loadScript(source, debuggingName);
             if (!load_result.valid())
@@ -130,6 +128,31 @@ namespace rlogic::internal
             return std::nullopt;
         }
 
+        return LoadedScript{ std::move(env), std::move(internalEnv), std::move(mainFunction), std::move(run) };
+    }
+
+    std::optional<LuaCompiledScript> LuaCompilationUtils::CompileScriptOrImportPrecompiled(
+        SolState& solState,
+        const ModuleMapping& userModules,
+        const StandardModules& stdModules,
+        std::string source,
+        std::string_view name,
+        ErrorReporting& errorReporting,
+        sol::bytecode byteCodeFromPrecompiledScript,
+        std::unique_ptr<Property> inputsFromPrecompiledScript,
+        std::unique_ptr<Property> outputsFromPrecompiledScript,
+        EFeatureLevel featureLevel,
+        bool enableDebugLogFunctions)
+    {
+        std::optional<LoadedScript> loadedScript = LoadScriptAndRunInit(solState, userModules, stdModules, source, name, errorReporting, byteCodeFromPrecompiledScript, featureLevel, enableDebugLogFunctions);
+        if (!loadedScript)
+            return std::nullopt;
+
+        sol::environment& env = loadedScript->env;
+        sol::table& internalEnv = loadedScript->internalEnv;
+        sol::protected_function& mainFunction = loadedScript->mainFunction;
+        sol::protected_function& run = loadedScript->runFunction;
+
         std::unique_ptr<Property> resultInputs;
         std::unique_ptr<Property> resultOutputs;
 
@@ -202,11 +225,37 @@ namespace rlogic::internal
                 enableDebugLogFunctions
             },
             std::move(run),
+            internalEnv["GLOBAL"],
             std::move(resultInputs),
             std::move(resultOutputs)
         };
     }
 
+    std::optional<sol::protected_function> LuaCompilationUtils::LoadPrecompiledScriptRunFunction(
+        SolState& solState,
+        const ModuleMapping& userModules,
+        const StandardModules& stdModules,
+        const std::string& source,
+        sol::bytecode& byteCode,
+        std::string_view name,
+        ErrorReporting& errorReporting,
+        EFeatureLevel featureLevel,
+        sol::table& globals)
+    {
+        std::optional<LoadedScript> loadedScript = LoadScriptAndRunInit(solState, userModules, stdModules, source, name, errorReporting, byteCode, featureLevel, false);
+        if (!loadedScript)
+            return std::nullopt;
+
+        globals = loadedScript->internalEnv["GLOBAL"];
+
+        if (featureLevel >= EFeatureLevel_02 && byteCode.empty())
+            byteCode = loadedScript->mainFunction.dump();
+
+        EnvironmentProtection::SetEnvironmentProtectionLevel(loadedScript->env, EEnvProtectionFlag::RunFunction);
+
+        return std::move(loadedScript->runFunction);
+    }
+
     std::optional<rlogic::internal::LuaCompiledInterface> LuaCompilationUtils::CompileInterface(
         SolState& solState,
         const ModuleMapping& userModules,
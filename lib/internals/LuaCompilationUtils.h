@@ -46,6 +46,9 @@ namespace rlogic::internal
         // The run() function
         sol::protected_function runFunction;
 
+        // The GLOBAL table after init() was executed
+        sol::table globals;
+
         // Parsed interface properties
         std::unique_ptr<Property> rootInput;
         std::unique_ptr<Property> rootOutput;
@@ -78,6 +81,21 @@ namespace rlogic::internal
             EFeatureLevel featureLevel,
             bool enableDebugLogFunctions);
 
+        // Loads script of which properties are already known (deserialized) and returns its run function,
+        // interface function is not executed. Bytecode is used if possible, otherwise script is compiled from source
+        // and bytecode is updated the same way as in CompileScriptOrImportPrecompiled.
+        // The GLOBAL table is returned via globals parameter.
+        [[nodiscard]] static std::optional<sol::protected_function> LoadPrecompiledScriptRunFunction(
+            SolState& solState,
+            const ModuleMapping& userModules,
+            const StandardModules& stdModules,
+            const std::string& source,
+            sol::bytecode& byteCode,
+            std::string_view name,
+            ErrorReporting& errorReporting,
+            EFeatureLevel featureLevel,
+            sol::table& globals);
+
         [[nodiscard]] static std::optional<LuaCompiledInterface> CompileInterface(
             SolState& solState,
             const ModuleMapping& userModules,
@@ -107,6 +125,26 @@ namespace rlogic::internal
         [[nodiscard]] static sol::table MakeTableReadOnly(SolState& solState, sol::table table);
 
     private:
+        struct LoadedScript
+        {
+            sol::environment env;
+            sol::table internalEnv;
+            sol::protected_function mainFunction;
+            sol::protected_function runFunction;
+        };
+
+        // loads script from bytecode (clears bytecode if it cannot be loaded) or source, executes its main chunk and init function
+        [[nodiscard]] static std::optional<LoadedScript> LoadScriptAndRunInit(
+            SolState& solState,
+            const ModuleMapping& userModules,
+            const StandardModules& stdModules,
+            const std::string& source,
+            std::string_view name,
+            ErrorReporting& errorReporting,
+            sol::bytecode& byteCode,
+            EFeatureLevel featureLevel,
+            bool enableDebugLogFunctions);
+
         [[nodiscard]] static bool CrossCheckDeclaredAndProvidedModules(
             std::string_view source,
             const ModuleMapping& modules,
@@ -0,0 +1,170 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/LuaTableSnapshot.h"
+
+#include <algorithm>
+#include <optional>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        using SnapshotKey = std::variant<int64_t, std::string>;
+
+        bool HasMetatable(const sol::object& object)
+        {
+            lua_State* luaState = object.lua_state();
+            object.push();
+            const bool hasMetatable = (lua_getmetatable(luaState, -1) != 0);
+            lua_pop(luaState, hasMetatable ? 2 : 1);
+            return hasMetatable;
+        }
+
+        bool IsInteger(const sol::object& object)
+        {
+            lua_State* luaState = object.lua_state();
+            object.push();
+            const bool isInteger = (lua_isinteger(luaState, -1) != 0);
+            lua_pop(luaState, 1);
+            return isInteger;
+        }
+
+        std::optional<SnapshotKey> ToKey(const sol::object& key)
+        {
+            if (key.get_type() == sol::type::string)
+                return SnapshotKey{ key.as<std::string>() };
+            if (key.get_type() == sol::type::number && IsInteger(key))
+                return SnapshotKey{ static_cast<int64_t>(key.as<lua_Integer>()) };
+            return std::nullopt;
+        }
+    }
+
+    LuaTableSnapshot LuaTableSnapshot::Capture(const sol::table& table)
+    {
+        LuaTableSnapshot snapshot;
+        std::unordered_map<const void*, size_t> capturedTables;
+        snapshot.captureTable(table, capturedTables);
+        return snapshot;
+    }
+
+    size_t LuaTableSnapshot::captureTable(const sol::table& table, std::unordered_map<const void*, size_t>& capturedTables)
+    {
+        const size_t index = m_tables.size();
+        capturedTables.emplace(table.pointer(), index);
+        m_tables.emplace_back();
+
+        sol::table source = table;
+        Table entries;
+        for (const auto& keyValue : source)
+        {
+            std::optional<SnapshotKey> key = ToKey(keyValue.first);
+            if (!key)
+                continue;
+
+            const sol::object& value = keyValue.second;
+            const sol::type valueType = value.get_type();
+            Value capturedValue = Opaque{};
+            if (valueType == sol::type::boolean)
+            {
+                capturedValue.emplace<bool>(value.as<bool>());
+            }
+            else if (valueType == sol::type::number)
+            {
+                if (IsInteger(value))
+                    capturedValue.emplace<int64_t>(static_cast<int64_t>(value.as<lua_Integer>()));
+                else
+                    capturedValue.emplace<double>(value.as<double>());
+            }
+            else if (valueType == sol::type::string)
+            {
+                capturedValue.emplace<std::string>(value.as<std::string>());
+            }
+            else if (valueType == sol::type::table && !HasMetatable(value))
+            {
+                const auto it = capturedTables.find(value.pointer());
+                const size_t nestedIndex = (it != capturedTables.cend() ? it->second : captureTable(value.as<sol::table>(), capturedTables));
+                capturedValue.emplace<TableRef>(TableRef{ nestedIndex });
+            }
+
+            entries.push_back(Entry{ std::move(*key), std::move(capturedValue) });
+        }
+
+        std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.key < rhs.key; });
+        m_tables[index] = std::move(entries);
+
+        return index;
+    }
+
+    void LuaTableSnapshot::restore(const sol::table& table) const
+    {
+        if (m_tables.empty())
+            return;
+
+        std::vector<sol::table> restoredTables(m_tables.size());
+        std::unordered_set<const void*> modifiedTables;
+        restoreTable(0u, table, restoredTables, modifiedTables);
+    }
+
+    void LuaTableSnapshot::restoreTable(size_t index, const sol::table& table, std::vector<sol::table>& restoredTables, std::unordered_set<const void*>& modifiedTables) const
+    {
+        restoredTables[index] = table;
+        modifiedTables.insert(table.pointer());
+
+        sol::table target = table;
+        const Table& entries = m_tables[index];
+
+        // remove entries which were added after capturing, values under keys which cannot be captured are kept
+        std::vector<sol::object> addedKeys;
+        for (const auto& keyValue : target)
+        {
+            const std::optional<SnapshotKey> key = ToKey(keyValue.first);
+            const auto it = (key ? std::lower_bound(entries.cbegin(), entries.cend(), *key, [](const Entry& entry, const SnapshotKey& k) { return entry.key < k; }) : entries.cend());
+            if (key && (it == entries.cend() || it->key != *key))
+                addedKeys.push_back(keyValue.first);
+        }
+        for (const auto& key : addedKeys)
+            target.raw_set(key, sol::lua_nil);
+
+        for (const auto& entry : entries)
+        {
+            std::visit([&](const auto& key)
+                {
+                    const Value& value = entry.value;
+                    if (const auto* boolValue = std::get_if<bool>(&value))
+                    {
+                        target.raw_set(key, *boolValue);
+                    }
+                    else if (const auto* intValue = std::get_if<int64_t>(&value))
+                    {
+                        target.raw_set(key, static_cast<lua_Integer>(*intValue));
+                    }
+                    else if (const auto* doubleValue = std::get_if<double>(&value))
+                    {
+                        target.raw_set(key, *doubleValue);
+                    }
+                    else if (const auto* stringValue = std::get_if<std::string>(&value))
+                    {
+                        target.raw_set(key, *stringValue);
+                    }
+                    else if (const auto* tableRef = std::get_if<TableRef>(&value))
+                    {
+                        if (!restoredTables[tableRef->index].valid())
+                        {
+                            // restore nested table in place unless it was replaced by other value or is already used for other captured table
+                            const auto current = target.raw_get<sol::object>(key);
+                            const bool reuseCurrent = current.get_type() == sol::type::table && !HasMetatable(current) && modifiedTables.count(current.pointer()) == 0;
+                            const sol::table nestedTable = (reuseCurrent ? current.as<sol::table>() : sol::state_view(target.lua_state()).create_table());
+                            restoreTable(tableRef->index, nestedTable, restoredTables, modifiedTables);
+                        }
+                        target.raw_set(key, restoredTables[tableRef->index]);
+                    }
+                }, entry.key);
+        }
+    }
+}
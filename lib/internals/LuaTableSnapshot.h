@@ -0,0 +1,62 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/SolWrapper.h"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <variant>
+#include <vector>
+
+namespace rlogic::internal
+{
+    // Copy of data stored in a Lua table (and in tables nested in it) which does not reference the Lua state.
+    // Only booleans, numbers, strings and plain tables (without metatable) stored under string or integer keys are copied,
+    // any other values (functions, userdata, tables with metatable like modules) are kept as they are on restore.
+    // Tables referenced multiple times (or recursively) are captured once and restored with the same references.
+    class LuaTableSnapshot
+    {
+    public:
+        [[nodiscard]] static LuaTableSnapshot Capture(const sol::table& table);
+
+        // Writes captured data back to given table (in place, also for nested tables where possible),
+        // entries which were added after capturing are removed
+        void restore(const sol::table& table) const;
+
+    private:
+        // value which was not captured and is kept untouched on restore
+        struct Opaque
+        {
+        };
+        struct TableRef
+        {
+            size_t index;
+        };
+
+        using Key = std::variant<int64_t, std::string>;
+        using Value = std::variant<Opaque, bool, int64_t, double, std::string, TableRef>;
+
+        struct Entry
+        {
+            Key key;
+            Value value;
+        };
+
+        // entries sorted by key
+        using Table = std::vector<Entry>;
+
+        size_t captureTable(const sol::table& table, std::unordered_map<const void*, size_t>& capturedTables);
+        void restoreTable(size_t index, const sol::table& table, std::vector<sol::table>& restoredTables, std::unordered_set<const void*>& modifiedTables) const;
+
+        // first table is the captured table itself, others are nested tables
+        std::vector<Table> m_tables;
+    };
+}
@@ -9,6 +9,19 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
+
+// SIMD kernels are selected at compile time based on target architecture,
+// define RLOGIC_MATH_DISABLE_SIMD (see ramses-logic_DISABLE_SIMD CMake option) to force scalar code
+#if !defined(RLOGIC_MATH_DISABLE_SIMD)
+#   if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define RLOGIC_MATH_SSE2
+#       include <emmintrin.h>
+#   elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#       define RLOGIC_MATH_NEON
+#       include <arm_neon.h>
+#   endif
+#endif
 
 namespace rlogic::internal::math
 {
@@ -140,24 +153,125 @@ namespace rlogic::internal::math
             };
         }
 
+        // column-major access to matrix elements, layout is verified by static asserts below
+        [[nodiscard]] const float* data() const
+        {
+            return &m11;
+        }
+
+        [[nodiscard]] float* data()
+        {
+            return &m11;
+        }
+
+        // exact element-wise comparison, used to detect changes of matrices retrieved from Ramses
+        bool operator==(const Matrix44f& other) const
+        {
+            return m11 == other.m11 && m21 == other.m21 && m31 == other.m31 && m41 == other.m41
+                && m12 == other.m12 && m22 == other.m22 && m32 == other.m32 && m42 == other.m42
+                && m13 == other.m13 && m23 == other.m23 && m33 == other.m33 && m43 == other.m43
+                && m14 == other.m14 && m24 == other.m24 && m34 == other.m34 && m44 == other.m44;
+        }
+
+        bool operator!=(const Matrix44f& other) const
+        {
+            return !(*this == other);
+        }
+
         Matrix44f operator*(const Matrix44f& mat) const
         {
-            return Matrix44f(m11 * mat.m11 + m12 * mat.m21 + m13 * mat.m31 + m14 * mat.m41, m11 * mat.m12 + m12 * mat.m22 + m13 * mat.m32 + m14 * mat.m42,
-                m11 * mat.m13 + m12 * mat.m23 + m13 * mat.m33 + m14 * mat.m43, m11 * mat.m14 + m12 * mat.m24 + m13 * mat.m34 + m14 * mat.m44
-                , m21 * mat.m11 + m22 * mat.m21 + m23 * mat.m31 + m24 * mat.m41, m21 * mat.m12 + m22 * mat.m22 + m23 * mat.m32 + m24 * mat.m42,
-                m21 * mat.m13 + m22 * mat.m23 + m23 * mat.m33 + m24 * mat.m43, m21 * mat.m14 + m22 * mat.m24 + m23 * mat.m34 + m24 * mat.m44
-                , m31 * mat.m11 + m32 * mat.m21 + m33 * mat.m31 + m34 * mat.m41, m31 * mat.m12 + m32 * mat.m22 + m33 * mat.m32 + m34 * mat.m42,
-                m31 * mat.m13 + m32 * mat.m23 + m33 * mat.m33 + m34 * mat.m43, m31 * mat.m14 + m32 * mat.m24 + m33 * mat.m34 + m34 * mat.m44
-                , m41 * mat.m11 + m42 * mat.m21 + m43 * mat.m31 + m44 * mat.m41, m41 * mat.m12 + m42 * mat.m22 + m43 * mat.m32 + m44 * mat.m42,
-                m41 * mat.m13 + m42 * mat.m23 + m43 * mat.m33 + m44 * mat.m43, m41 * mat.m14 + m42 * mat.m24 + m43 * mat.m34 + m44 * mat.m44);
+            Matrix44f result;
+            Multiply(*this, mat, result);
+            return result;
         }
 
         Vector4 operator*(const Vector4& vec) const
         {
-            return Vector4(m11 * vec.x + m12 * vec.y + m13 * vec.z + m14 * vec.w
-                , m21 * vec.x + m22 * vec.y + m23 * vec.z + m24 * vec.w
-                , m31 * vec.x + m32 * vec.y + m33 * vec.z + m34 * vec.w
-                , m41 * vec.x + m42 * vec.y + m43 * vec.z + m44 * vec.w);
+            return Multiply(*this, vec);
+        }
+
+        // result must not alias any of the operands
+        static void Multiply(const Matrix44f& a, const Matrix44f& b, Matrix44f& result)
+        {
+#if defined(RLOGIC_MATH_SSE2)
+            const float* aData = a.data();
+            const __m128 aCol0 = _mm_loadu_ps(aData);
+            const __m128 aCol1 = _mm_loadu_ps(aData + 4); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            const __m128 aCol2 = _mm_loadu_ps(aData + 8); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            const __m128 aCol3 = _mm_loadu_ps(aData + 12); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            for (size_t col = 0u; col < 4u; ++col)
+            {
+                const float* bCol = b.data() + 4u * col; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+                __m128 resCol = _mm_mul_ps(aCol0, _mm_set1_ps(bCol[0]));
+                resCol = _mm_add_ps(resCol, _mm_mul_ps(aCol1, _mm_set1_ps(bCol[1])));
+                resCol = _mm_add_ps(resCol, _mm_mul_ps(aCol2, _mm_set1_ps(bCol[2])));
+                resCol = _mm_add_ps(resCol, _mm_mul_ps(aCol3, _mm_set1_ps(bCol[3])));
+                _mm_storeu_ps(result.data() + 4u * col, resCol); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            }
+#elif defined(RLOGIC_MATH_NEON)
+            const float* aData = a.data();
+            const float32x4_t aCol0 = vld1q_f32(aData);
+            const float32x4_t aCol1 = vld1q_f32(aData + 4); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            const float32x4_t aCol2 = vld1q_f32(aData + 8); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            const float32x4_t aCol3 = vld1q_f32(aData + 12); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            for (size_t col = 0u; col < 4u; ++col)
+            {
+                const float* bCol = b.data() + 4u * col; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+                float32x4_t resCol = vmulq_n_f32(aCol0, bCol[0]);
+                resCol = vaddq_f32(resCol, vmulq_n_f32(aCol1, bCol[1]));
+                resCol = vaddq_f32(resCol, vmulq_n_f32(aCol2, bCol[2]));
+                resCol = vaddq_f32(resCol, vmulq_n_f32(aCol3, bCol[3]));
+                vst1q_f32(result.data() + 4u * col, resCol); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            }
+#else
+            MultiplyScalar(a, b, result);
+#endif
+        }
+
+        static Vector4 Multiply(const Matrix44f& mat, const Vector4& vec)
+        {
+#if defined(RLOGIC_MATH_SSE2)
+            const float* matData = mat.data();
+            __m128 res = _mm_mul_ps(_mm_loadu_ps(matData), _mm_set1_ps(vec.x));
+            res = _mm_add_ps(res, _mm_mul_ps(_mm_loadu_ps(matData + 4), _mm_set1_ps(vec.y))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            res = _mm_add_ps(res, _mm_mul_ps(_mm_loadu_ps(matData + 8), _mm_set1_ps(vec.z))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            res = _mm_add_ps(res, _mm_mul_ps(_mm_loadu_ps(matData + 12), _mm_set1_ps(vec.w))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            std::array<float, 4> resData{};
+            _mm_storeu_ps(resData.data(), res);
+            return Vector4(resData[0], resData[1], resData[2], resData[3]);
+#elif defined(RLOGIC_MATH_NEON)
+            const float* matData = mat.data();
+            float32x4_t res = vmulq_n_f32(vld1q_f32(matData), vec.x);
+            res = vaddq_f32(res, vmulq_n_f32(vld1q_f32(matData + 4), vec.y)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            res = vaddq_f32(res, vmulq_n_f32(vld1q_f32(matData + 8), vec.z)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            res = vaddq_f32(res, vmulq_n_f32(vld1q_f32(matData + 12), vec.w)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) matrix data is contiguous array of 16 floats
+            std::array<float, 4> resData{};
+            vst1q_f32(resData.data(), res);
+            return Vector4(resData[0], resData[1], resData[2], resData[3]);
+#else
+            return MultiplyScalar(mat, vec);
+#endif
+        }
+
+        // reference implementation, used when no SIMD instruction set available
+        static void MultiplyScalar(const Matrix44f& a, const Matrix44f& b, Matrix44f& result)
+        {
+            result = Matrix44f(
+                a.m11 * b.m11 + a.m12 * b.m21 + a.m13 * b.m31 + a.m14 * b.m41, a.m11 * b.m12 + a.m12 * b.m22 + a.m13 * b.m32 + a.m14 * b.m42, a.m11 * b.m13 + a.m12 * b.m23 + a.m13 * b.m33 + a.m14 * b.m43, a.m11 * b.m14 + a.m12 * b.m24 + a.m13 * b.m34 + a.m14 * b.m44,
+                a.m21 * b.m11 + a.m22 * b.m21 + a.m23 * b.m31 + a.m24 * b.m41, a.m21 * b.m12 + a.m22 * b.m22 + a.m23 * b.m32 + a.m24 * b.m42, a.m21 * b.m13 + a.m22 * b.m23 + a.m23 * b.m33 + a.m24 * b.m43, a.m21 * b.m14 + a.m22 * b.m24 + a.m23 * b.m34 + a.m24 * b.m44,
+                a.m31 * b.m11 + a.m32 * b.m21 + a.m33 * b.m31 + a.m34 * b.m41, a.m31 * b.m12 + a.m32 * b.m22 + a.m33 * b.m32 + a.m34 * b.m42, a.m31 * b.m13 + a.m32 * b.m23 + a.m33 * b.m33 + a.m34 * b.m43, a.m31 * b.m14 + a.m32 * b.m24 + a.m33 * b.m34 + a.m34 * b.m44,
+                a.m41 * b.m11 + a.m42 * b.m21 + a.m43 * b.m31 + a.m44 * b.m41, a.m41 * b.m12 + a.m42 * b.m22 + a.m43 * b.m32 + a.m44 * b.m42, a.m41 * b.m13 + a.m42 * b.m23 + a.m43 * b.m33 + a.m44 * b.m43, a.m41 * b.m14 + a.m42 * b.m24 + a.m43 * b.m34 + a.m44 * b.m44);
+        }
+
+        static Vector4 MultiplyScalar(const Matrix44f& mat, const Vector4& vec)
+        {
+            return Vector4(mat.m11 * vec.x + mat.m12 * vec.y + mat.m13 * vec.z + mat.m14 * vec.w
+                , mat.m21 * vec.x + mat.m22 * vec.y + mat.m23 * vec.z + mat.m24 * vec.w
+                , mat.m31 * vec.x + mat.m32 * vec.y + mat.m33 * vec.z + mat.m34 * vec.w
+                , mat.m41 * vec.x + mat.m42 * vec.y + mat.m43 * vec.z + mat.m44 * vec.w);
         }
     };
+
+    static_assert(sizeof(Matrix44f) == 16u * sizeof(float), "Matrix44f must be tightly packed for SIMD kernels");
+    static_assert(offsetof(Matrix44f, m44) == 15u * sizeof(float), "Matrix44f must be tightly packed for SIMD kernels");
 }
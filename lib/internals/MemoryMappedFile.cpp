@@ -0,0 +1,161 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/MemoryMappedFile.h"
+#include <cstdint>
+
+#if defined(_WIN32)
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   include <windows.h>
+#   include <io.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace rlogic::internal
+{
+    MemoryMappedFile::MemoryMappedFile(void* mapping, size_t mappingSize, size_t dataOffset, size_t size)
+        : m_mapping{ mapping }
+        , m_mappingSize{ mappingSize }
+        , m_dataOffset{ dataOffset }
+        , m_size{ size }
+    {
+    }
+
+    MemoryMappedFile::~MemoryMappedFile() noexcept
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile(m_mapping);
+#else
+        munmap(m_mapping, m_mappingSize);
+#endif
+    }
+
+    const char* MemoryMappedFile::getData() const
+    {
+        return static_cast<const char*>(m_mapping) + m_dataOffset; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) offset within mapped region
+    }
+
+    size_t MemoryMappedFile::getSize() const
+    {
+        return m_size;
+    }
+
+#if defined(_WIN32)
+    std::unique_ptr<MemoryMappedFile> MemoryMappedFile::Map(const std::string& filename)
+    {
+        HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) // NOLINT(cppcoreguidelines-pro-type-cstyle-cast, performance-no-int-to-ptr) Windows API macro
+            return nullptr;
+
+        LARGE_INTEGER fileSize{};
+        if (GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        // mapping object and file handle can be closed right away, the view keeps them alive
+        HANDLE mappingObject = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mappingObject == nullptr)
+            return nullptr;
+        void* mapping = MapViewOfFile(mappingObject, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mappingObject);
+        if (mapping == nullptr)
+            return nullptr;
+
+        const auto size = static_cast<size_t>(fileSize.QuadPart);
+        return std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(mapping, size, 0u, size));
+    }
+
+    std::unique_ptr<MemoryMappedFile> MemoryMappedFile::MapRegion(int fd, size_t offset, size_t size)
+    {
+        // handle is owned by fd, must not be closed here
+        HANDLE file = reinterpret_cast<HANDLE>(_get_osfhandle(fd)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr) Windows API
+        if (file == INVALID_HANDLE_VALUE || size == 0u) // NOLINT(cppcoreguidelines-pro-type-cstyle-cast, performance-no-int-to-ptr) Windows API macro
+            return nullptr;
+
+        LARGE_INTEGER fileSize{};
+        if (GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &fileSize) || offset > static_cast<size_t>(fileSize.QuadPart) || size > static_cast<size_t>(fileSize.QuadPart) - offset)
+            return nullptr;
+
+        // view offset must be multiple of allocation granularity
+        SYSTEM_INFO systemInfo{};
+        GetSystemInfo(&systemInfo);
+        const size_t dataOffset = offset % systemInfo.dwAllocationGranularity;
+        const uint64_t alignedOffset = offset - dataOffset;
+
+        HANDLE mappingObject = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingObject == nullptr)
+            return nullptr;
+        void* mapping = MapViewOfFile(mappingObject, FILE_MAP_READ, static_cast<DWORD>(alignedOffset >> 32u), static_cast<DWORD>(alignedOffset & 0xFFFFFFFFu), dataOffset + size);
+        CloseHandle(mappingObject);
+        if (mapping == nullptr)
+            return nullptr;
+
+        return std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(mapping, dataOffset + size, dataOffset, size));
+    }
+#else
+    std::unique_ptr<MemoryMappedFile> MemoryMappedFile::Map(const std::string& filename)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) system call
+        const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return nullptr;
+
+        struct stat fileStat{};
+        if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || fileStat.st_size <= 0)
+        {
+            ::close(fd);
+            return nullptr;
+        }
+
+        // descriptor can be closed right away, the mapping keeps the file referenced
+        const auto size = static_cast<size_t>(fileStat.st_size);
+        void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) // NOLINT(cppcoreguidelines-pro-type-cstyle-cast, performance-no-int-to-ptr) system macro
+            return nullptr;
+
+        // file content is read mostly sequentially during verification and deserialization
+        madvise(mapping, size, MADV_SEQUENTIAL);
+
+        return std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(mapping, size, 0u, size));
+    }
+
+    std::unique_ptr<MemoryMappedFile> MemoryMappedFile::MapRegion(int fd, size_t offset, size_t size)
+    {
+        // accessing mapped pages beyond end of file would raise SIGBUS, region must be checked against file size
+        struct stat fileStat{};
+        if (size == 0u || fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || offset > static_cast<size_t>(fileStat.st_size) || size > static_cast<size_t>(fileStat.st_size) - offset)
+            return nullptr;
+
+        // mmap offset must be multiple of page size
+        const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t dataOffset = offset % pageSize;
+        const size_t alignedOffset = offset - dataOffset;
+
+        void* mapping = mmap(nullptr, dataOffset + size, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(alignedOffset));
+        if (mapping == MAP_FAILED) // NOLINT(cppcoreguidelines-pro-type-cstyle-cast, performance-no-int-to-ptr) system macro
+            return nullptr;
+
+        madvise(mapping, dataOffset + size, MADV_SEQUENTIAL);
+
+        return std::unique_ptr<MemoryMappedFile>(new MemoryMappedFile(mapping, dataOffset + size, dataOffset, size));
+    }
+#endif
+}
@@ -0,0 +1,45 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace rlogic::internal
+{
+    // Read-only memory mapping of a file, unmapped on destruction.
+    // Allows deserializing directly from the file contents without copying them to an intermediate buffer.
+    class MemoryMappedFile
+    {
+    public:
+        // returns nullptr if file cannot be opened, is not a regular file, is empty or cannot be mapped
+        [[nodiscard]] static std::unique_ptr<MemoryMappedFile> Map(const std::string& filename);
+        // maps region [offset, offset + size) of an open file, offset does not need to be page aligned,
+        // file descriptor is not closed. Returns nullptr if fd is not a regular file, region exceeds the file or cannot be mapped
+        [[nodiscard]] static std::unique_ptr<MemoryMappedFile> MapRegion(int fd, size_t offset, size_t size);
+
+        ~MemoryMappedFile() noexcept;
+        MemoryMappedFile(const MemoryMappedFile& other) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile& other) = delete;
+        MemoryMappedFile(MemoryMappedFile&& other) = delete;
+        MemoryMappedFile& operator=(MemoryMappedFile&& other) = delete;
+
+        [[nodiscard]] const char* getData() const;
+        [[nodiscard]] size_t getSize() const;
+
+    private:
+        MemoryMappedFile(void* mapping, size_t mappingSize, size_t dataOffset, size_t size);
+
+        // mapping starts at page boundary, requested data might start later within the first page
+        void* m_mapping;
+        size_t m_mappingSize;
+        size_t m_dataOffset;
+        size_t m_size;
+    };
+}
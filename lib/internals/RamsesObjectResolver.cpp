@@ -54,6 +54,11 @@ namespace rlogic::internal
         return findRamsesObjectInScene<ramses::SceneObject>(logicNodeName, objectId);
     }
 
+    std::unique_ptr<IRamsesObjectResolver> RamsesObjectResolver::createWithErrorReporting(ErrorReporting& errorReporting) const
+    {
+        return std::make_unique<RamsesObjectResolver>(errorReporting, m_scene);
+    }
+
     template <typename T>
     T* RamsesObjectResolver::findRamsesObjectInScene(std::string_view logicNodeName, ramses::sceneObjectId_t objectId) const
     {
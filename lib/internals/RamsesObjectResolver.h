@@ -10,6 +10,7 @@
 
 #include "ramses-framework-api/RamsesFrameworkTypes.h"
 #include <string>
+#include <memory>
 
 namespace ramses
 {
@@ -37,6 +38,10 @@ namespace rlogic::internal
         [[nodiscard]] virtual ramses::RenderPass* findRamsesRenderPassInScene(std::string_view logicNodeName, ramses::sceneObjectId_t objectId) const = 0;
         [[nodiscard]] virtual ramses::RenderGroup* findRamsesRenderGroupInScene(std::string_view logicNodeName, ramses::sceneObjectId_t objectId) const = 0;
         [[nodiscard]] virtual ramses::SceneObject* findRamsesSceneObjectInScene(std::string_view logicNodeName, ramses::sceneObjectId_t objectId) const = 0;
+
+        // Creates resolver for the same scene which reports errors to given error reporting instead,
+        // to be used on another thread than this resolver
+        [[nodiscard]] virtual std::unique_ptr<IRamsesObjectResolver> createWithErrorReporting(ErrorReporting& errorReporting) const = 0;
     };
 
     class RamsesObjectResolver final : public IRamsesObjectResolver
@@ -51,6 +56,8 @@ namespace rlogic::internal
         [[nodiscard]] ramses::RenderGroup* findRamsesRenderGroupInScene(std::string_view logicNodeName, ramses::sceneObjectId_t objectId) const override;
         [[nodiscard]] ramses::SceneObject* findRamsesSceneObjectInScene(std::string_view logicNodeName, ramses::sceneObjectId_t objectId) const override;
 
+        [[nodiscard]] std::unique_ptr<IRamsesObjectResolver> createWithErrorReporting(ErrorReporting& errorReporting) const override;
+
     private:
         template <typename T>
         [[nodiscard]] T* findRamsesObjectInScene(std::string_view logicNodeName, ramses::sceneObjectId_t objectId) const;
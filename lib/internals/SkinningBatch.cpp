@@ -0,0 +1,95 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/SkinningBatch.h"
+#include "impl/SkinBindingImpl.h"
+#include "impl/RamsesNodeBindingImpl.h"
+#include "ramses-client-api/Node.h"
+#include <unordered_map>
+#include <cassert>
+
+namespace rlogic::internal
+{
+    void SkinningBatch::invalidate()
+    {
+        m_valid = false;
+        m_skinBindings.clear();
+    }
+
+    LogicNodeImpl* SkinningBatch::fetchJointWorldMatrices(const std::vector<LogicNodeImpl*>& skinBindings)
+    {
+        // set of skin bindings to update changes only if some are suspended/resumed or only part of nodes is updated
+        if (!m_valid || skinBindings != m_skinBindings)
+            rebuild(skinBindings);
+        assert(m_skinJointWorldMatrices.size() == skinBindings.size());
+
+        // NOLINTNEXTLINE(modernize-avoid-c-arrays) Ramses uses C array in matrix getters
+        float tempData[16];
+        for (size_t i = 0u; i < m_uniqueJoints.size(); ++i)
+        {
+            if (m_uniqueJoints[i]->getRamsesNode().getModelMatrix(tempData) != ramses::StatusOK)
+                return m_uniqueJointsFirstUser[i];
+            m_jointWorldMatrices[i] = math::Matrix44f{ tempData };
+        }
+
+        return nullptr;
+    }
+
+    size_t SkinningBatch::getUniqueJointCount() const
+    {
+        return m_uniqueJoints.size();
+    }
+
+    void SkinningBatch::rebuild(const std::vector<LogicNodeImpl*>& skinBindings)
+    {
+        // skin bindings not in the new batch must not reference its storage anymore
+        for (LogicNodeImpl* skinBinding : m_skinBindings)
+            static_cast<SkinBindingImpl*>(skinBinding)->setPrefetchedJointWorldMatrices(nullptr);
+        m_skinBindings = skinBindings;
+
+        m_uniqueJoints.clear();
+        m_uniqueJointsFirstUser.clear();
+        std::unordered_map<const RamsesNodeBindingImpl*, size_t> jointIndices;
+        std::vector<std::vector<size_t>> skinJointIndices;
+        skinJointIndices.reserve(skinBindings.size());
+
+        for (LogicNodeImpl* skinBinding : skinBindings)
+        {
+            const auto& joints = static_cast<const SkinBindingImpl*>(skinBinding)->getJoints();
+            std::vector<size_t> indices;
+            indices.reserve(joints.size());
+            for (const RamsesNodeBindingImpl* joint : joints)
+            {
+                const auto it = jointIndices.emplace(joint, m_uniqueJoints.size());
+                if (it.second)
+                {
+                    m_uniqueJoints.push_back(joint);
+                    m_uniqueJointsFirstUser.push_back(skinBinding);
+                }
+                indices.push_back(it.first->second);
+            }
+            skinJointIndices.push_back(std::move(indices));
+        }
+
+        // world matrices storage must not reallocate after this point, skin bindings keep pointers to it
+        m_jointWorldMatrices.assign(m_uniqueJoints.size(), math::Matrix44f{});
+        m_skinJointWorldMatrices.clear();
+        m_skinJointWorldMatrices.reserve(skinBindings.size());
+        for (size_t skinIdx = 0u; skinIdx < skinBindings.size(); ++skinIdx)
+        {
+            std::vector<const math::Matrix44f*> worldMatrices;
+            worldMatrices.reserve(skinJointIndices[skinIdx].size());
+            for (size_t jointIdx : skinJointIndices[skinIdx])
+                worldMatrices.push_back(&m_jointWorldMatrices[jointIdx]);
+            m_skinJointWorldMatrices.push_back(std::move(worldMatrices));
+            static_cast<SkinBindingImpl*>(skinBindings[skinIdx])->setPrefetchedJointWorldMatrices(&m_skinJointWorldMatrices.back());
+        }
+
+        m_valid = true;
+    }
+}
@@ -0,0 +1,52 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/Math.h"
+#include <vector>
+
+namespace rlogic::internal
+{
+    class LogicNodeImpl;
+    class SkinBindingImpl;
+    class RamsesNodeBindingImpl;
+
+    // Prepares data for updating skin bindings in one batch.
+    // Joints are often shared between skins (e.g. multiple meshes of same character or crowds of characters
+    // using same skeleton), world matrix of each unique joint is retrieved from Ramses only once per update
+    // and then referenced by all skin bindings using it.
+    // Matrices are retrieved on the calling thread, Ramses scene cannot be accessed from multiple threads concurrently.
+    class SkinningBatch
+    {
+    public:
+        // must be called whenever set of skin bindings changes (skin bindings used by batch could be destroyed)
+        void invalidate();
+
+        // Retrieves world matrices of all joints used by given skin bindings and provides them to the skin bindings
+        // to be used in their next update. Batch is rebuilt if skin bindings differ from those given in previous call.
+        // Returns skin binding which failed to retrieve joint matrix or nullptr on success.
+        [[nodiscard]] LogicNodeImpl* fetchJointWorldMatrices(const std::vector<LogicNodeImpl*>& skinBindings);
+
+        [[nodiscard]] size_t getUniqueJointCount() const;
+
+    private:
+        void rebuild(const std::vector<LogicNodeImpl*>& skinBindings);
+
+        bool m_valid = false;
+        // skin bindings the batch was built for
+        std::vector<LogicNodeImpl*> m_skinBindings;
+
+        std::vector<const RamsesNodeBindingImpl*> m_uniqueJoints;
+        // first skin binding using the joint, for error reporting
+        std::vector<LogicNodeImpl*> m_uniqueJointsFirstUser;
+        std::vector<math::Matrix44f> m_jointWorldMatrices;
+        // for each skin binding, pointers to world matrices of its joints (in same order as its joints)
+        std::vector<std::vector<const math::Matrix44f*>> m_skinJointWorldMatrices;
+    };
+}
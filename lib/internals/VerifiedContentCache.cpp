@@ -0,0 +1,194 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/VerifiedContentCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string_view>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        uint64_t RotL(uint64_t value, unsigned bits)
+        {
+            return (value << bits) | (value >> (64u - bits));
+        }
+
+        struct SipState
+        {
+            uint64_t v0;
+            uint64_t v1;
+            uint64_t v2;
+            uint64_t v3;
+
+            void round()
+            {
+                v0 += v1; v1 = RotL(v1, 13u); v1 ^= v0; v0 = RotL(v0, 32u);
+                v2 += v3; v3 = RotL(v3, 16u); v3 ^= v2;
+                v0 += v3; v3 = RotL(v3, 21u); v3 ^= v0;
+                v2 += v1; v1 = RotL(v1, 17u); v1 ^= v2; v2 = RotL(v2, 32u);
+            }
+
+            void compress(uint64_t message)
+            {
+                v3 ^= message;
+                round();
+                round();
+                v0 ^= message;
+            }
+
+            uint64_t finalize()
+            {
+                round();
+                round();
+                round();
+                round();
+                return v0 ^ v1 ^ v2 ^ v3;
+            }
+        };
+
+        uint64_t ReadLE64(const uint8_t* data, size_t byteCount)
+        {
+            uint64_t value = 0u;
+            for (size_t i = 0u; i < byteCount; ++i)
+                value |= static_cast<uint64_t>(data[i]) << (8u * i); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) callers check bounds
+            return value;
+        }
+
+        void AppendLE64(std::vector<uint8_t>& data, uint64_t value)
+        {
+            for (size_t i = 0u; i < 8u; ++i)
+                data.push_back(static_cast<uint8_t>(value >> (8u * i)));
+        }
+
+        // exported data layout: magic, key check value (2x uint64), entries (2x uint64 hash, uint64 size), all little endian
+        constexpr std::array<uint8_t, 4> ExportMagic{ 'r', 'l', 'v', 'c' };
+        constexpr size_t ExportHeaderSize = ExportMagic.size() + 16u;
+        constexpr size_t ExportEntrySize = 24u;
+
+        // hash of a constant string is used as key check value, it is longer than 8 bytes so that it also differs
+        // for exports from platform with other byte order (content is hashed in host byte order)
+        std::array<uint64_t, 2> ComputeKeyCheck(const VerifiedContentCache::Key& key)
+        {
+            constexpr std::string_view keyCheckInput{ "ramses-logic verification cache" };
+            return VerifiedContentCache::SipHash128(key, keyCheckInput.data(), keyCheckInput.size());
+        }
+    }
+
+    VerifiedContentCache::VerifiedContentCache()
+        : VerifiedContentCache([]() {
+                std::random_device randomDevice;
+                const auto random64 = [&randomDevice]() { return (static_cast<uint64_t>(randomDevice()) << 32u) ^ randomDevice(); };
+                return Key{ random64(), random64() };
+            }())
+    {
+    }
+
+    VerifiedContentCache::VerifiedContentCache(const Key& key)
+        : m_key{ key }
+    {
+        m_entries.reserve(MaxEntries);
+    }
+
+    VerifiedContentCache::ContentId VerifiedContentCache::computeContentId(const void* data, size_t size) const
+    {
+        return ContentId{ SipHash128(m_key, data, size), size };
+    }
+
+    bool VerifiedContentCache::contains(const ContentId& contentId) const
+    {
+        return std::find(m_entries.cbegin(), m_entries.cend(), contentId) != m_entries.cend();
+    }
+
+    void VerifiedContentCache::insert(const ContentId& contentId)
+    {
+        if (contains(contentId))
+            return;
+
+        // oldest entry is dropped
+        if (m_entries.size() == MaxEntries)
+            m_entries.erase(m_entries.begin());
+        m_entries.push_back(contentId);
+    }
+
+    bool VerifiedContentCache::hasKey(const Key& key) const
+    {
+        return m_key == key;
+    }
+
+    std::vector<uint8_t> VerifiedContentCache::exportEntries() const
+    {
+        std::vector<uint8_t> data;
+        data.reserve(ExportHeaderSize + m_entries.size() * ExportEntrySize);
+        data.insert(data.end(), ExportMagic.cbegin(), ExportMagic.cend());
+        const auto keyCheck = ComputeKeyCheck(m_key);
+        AppendLE64(data, keyCheck[0]);
+        AppendLE64(data, keyCheck[1]);
+        // oldest entry first so that import keeps the order of eviction
+        for (const auto& entry : m_entries)
+        {
+            AppendLE64(data, entry.hash[0]);
+            AppendLE64(data, entry.hash[1]);
+            AppendLE64(data, static_cast<uint64_t>(entry.size));
+        }
+        return data;
+    }
+
+    bool VerifiedContentCache::importEntries(const std::vector<uint8_t>& data)
+    {
+        if (data.size() < ExportHeaderSize || (data.size() - ExportHeaderSize) % ExportEntrySize != 0u ||
+            !std::equal(ExportMagic.cbegin(), ExportMagic.cend(), data.cbegin()))
+        {
+            return false;
+        }
+
+        const uint8_t* bytes = data.data();
+        const auto keyCheck = ComputeKeyCheck(m_key);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) size checked above
+        if (ReadLE64(bytes + ExportMagic.size(), 8u) != keyCheck[0] || ReadLE64(bytes + ExportMagic.size() + 8u, 8u) != keyCheck[1])
+            return false;
+
+        for (size_t offset = ExportHeaderSize; offset < data.size(); offset += ExportEntrySize)
+        {
+            const uint8_t* entry = bytes + offset; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) size checked above
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) size checked above
+            insert(ContentId{ { ReadLE64(entry, 8u), ReadLE64(entry + 8u, 8u) }, static_cast<size_t>(ReadLE64(entry + 16u, 8u)) });
+        }
+
+        return true;
+    }
+
+    std::array<uint64_t, 2> VerifiedContentCache::SipHash128(const Key& key, const void* data, size_t size)
+    {
+        SipState state{
+            key[0] ^ 0x736f6d6570736575u,
+            key[1] ^ 0x646f72616e646f6du ^ 0xeeu,
+            key[0] ^ 0x6c7967656e657261u,
+            key[1] ^ 0x7465646279746573u };
+
+        const auto* bytes = static_cast<const uint8_t*>(data);
+        const size_t fullWordsEnd = size - size % 8u;
+        for (size_t i = 0u; i < fullWordsEnd; i += 8u)
+        {
+            uint64_t word = 0u;
+            // data is read in host byte order, hashes are only compared on the same platform
+            std::memcpy(&word, bytes + i, sizeof(word)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) within data
+            state.compress(word);
+        }
+        state.compress((static_cast<uint64_t>(size) << 56u) | ReadLE64(bytes + fullWordsEnd, size % 8u)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) within data
+
+        state.v2 ^= 0xeeu;
+        const uint64_t first = state.finalize();
+        state.v1 ^= 0xddu;
+        const uint64_t second = state.finalize();
+        return { first, second };
+    }
+}
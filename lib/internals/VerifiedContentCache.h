@@ -0,0 +1,58 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rlogic::internal
+{
+    // Remembers content which passed flatbuffers verification, identified by its keyed SipHash-2-4 (128 bit) and size.
+    // Without knowing the key it is not possible to prepare data colliding with verified content. The key is random
+    // per cache instance unless provided by the user, in which case exported entries can be imported by a cache
+    // in a later process. Only the most recent entries are kept.
+    class VerifiedContentCache
+    {
+    public:
+        using Key = std::array<uint64_t, 2>;
+
+        struct ContentId
+        {
+            std::array<uint64_t, 2> hash{};
+            size_t size = 0u;
+
+            bool operator==(const ContentId& other) const
+            {
+                return hash == other.hash && size == other.size;
+            }
+        };
+
+        static constexpr size_t MaxEntries = 64u;
+
+        VerifiedContentCache();
+        explicit VerifiedContentCache(const Key& key);
+
+        [[nodiscard]] ContentId computeContentId(const void* data, size_t size) const;
+        [[nodiscard]] bool contains(const ContentId& contentId) const;
+        void insert(const ContentId& contentId);
+        [[nodiscard]] bool hasKey(const Key& key) const;
+
+        // entries are serialized together with a check value of the key, import fails for data exported with other key
+        [[nodiscard]] std::vector<uint8_t> exportEntries() const;
+        [[nodiscard]] bool importEntries(const std::vector<uint8_t>& data);
+
+        [[nodiscard]] static std::array<uint64_t, 2> SipHash128(const Key& key, const void* data, size_t size);
+
+    private:
+        Key m_key;
+        std::vector<ContentId> m_entries;
+    };
+}
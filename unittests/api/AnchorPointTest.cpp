@@ -272,6 +272,48 @@ namespace rlogic::internal
         EXPECT_FLOAT_EQ(0.019886762f, *anchorPoint.getOutputs()->getChild(1u)->get<float>());
     }
 
+    TEST_F(AnAnchorPoint_Math, SharesViewProjectionOfCameraWithOtherAnchorPoints)
+    {
+        const auto& anchorPoint1 = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor1");
+        const auto& anchorPoint2 = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor2");
+        const auto& anchorPoint3 = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_orthoCameraBinding, "anchor3");
+        EXPECT_TRUE(m_logicEngine.update());
+        // no bindings executed during this update, cache is kept till end of update
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2u, m_logicEngine.m_impl->getApiObjects().getCameraViewProjectionCache().getCachedCameraCount());
+
+        for (const auto* anchorPoint : { &anchorPoint1, &anchorPoint2 })
+        {
+            const auto coords = *anchorPoint->getOutputs()->getChild(0u)->get<vec2f>();
+            EXPECT_FLOAT_EQ(17.560308f, coords[0]);
+            EXPECT_FLOAT_EQ(19.317562f, coords[1]);
+            EXPECT_FLOAT_EQ(0.99509573f, *anchorPoint->getOutputs()->getChild(1u)->get<float>());
+        }
+        const auto coords = *anchorPoint3.getOutputs()->getChild(0u)->get<vec2f>();
+        EXPECT_FLOAT_EQ(21.281908f, coords[0]);
+        EXPECT_FLOAT_EQ(12.63566f, coords[1]);
+        EXPECT_FLOAT_EQ(0.019886762f, *anchorPoint3.getOutputs()->getChild(1u)->get<float>());
+    }
+
+    TEST_F(AnAnchorPoint_Math, RecalculatesSharedViewProjectionWhenCameraChanges)
+    {
+        const auto& anchorPoint1 = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor1");
+        const auto& anchorPoint2 = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor2");
+        EXPECT_TRUE(m_logicEngine.update());
+        const auto initialCoords = *anchorPoint1.getOutputs()->getChild(0u)->get<vec2f>();
+
+        // modify camera viewport via camera binding
+        m_perspCameraBinding.getInputs()->getChild("viewport")->getChild("width")->set(60);
+        EXPECT_TRUE(m_logicEngine.update());
+
+        for (const auto* anchorPoint : { &anchorPoint1, &anchorPoint2 })
+        {
+            const auto coords = *anchorPoint->getOutputs()->getChild(0u)->get<vec2f>();
+            EXPECT_NE(initialCoords[0], coords[0]);
+            EXPECT_FLOAT_EQ(initialCoords[1], coords[1]);
+        }
+    }
+
     class AnAnchorPoint_Dirtiness : public AnAnchorPoint_Math
     {
     protected:
@@ -395,6 +437,28 @@ namespace rlogic::internal
         expectNodeSkipped(*script);
     }
 
+    TEST_F(AnAnchorPoint_Dirtiness, KeepsOutputsIfNothingChangedAndRecalculatesAfterChange)
+    {
+        const auto& anchorPoint = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor");
+        EXPECT_TRUE(m_logicEngine.update());
+        const auto coords = *anchorPoint.getOutputs()->getChild(0u)->get<vec2f>();
+        const auto depth = *anchorPoint.getOutputs()->getChild(1u)->get<float>();
+
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(coords, *anchorPoint.getOutputs()->getChild(0u)->get<vec2f>());
+        EXPECT_EQ(depth, *anchorPoint.getOutputs()->getChild(1u)->get<float>());
+
+        m_node->setTranslation(123.f, 231.f, 321.f);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_NE(coords, *anchorPoint.getOutputs()->getChild(0u)->get<vec2f>());
+
+        // back to original state
+        m_node->setTranslation(1.f, 2.f, 3.f);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(coords, *anchorPoint.getOutputs()->getChild(0u)->get<vec2f>());
+        EXPECT_EQ(depth, *anchorPoint.getOutputs()->getChild(1u)->get<float>());
+    }
+
     // This test is to cover update order of anchor point with unknown dependencies.
     // Anchor point is special in sense it depends on ramses node (via binding), however those depend on other ramses nodes
     // (transformation topology), e.g. node ancestor, which can be affected by another node binding via script for example.
@@ -0,0 +1,297 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/LogicEngine.h"
+#include "ramses-logic/DataArray.h"
+#include "ramses-logic/AnimationNode.h"
+#include "ramses-logic/AnimationNodeConfig.h"
+#include "ramses-logic/AnimationBlendNode.h"
+#include "ramses-logic/Property.h"
+#include <cmath>
+
+namespace rlogic
+{
+    class AnAnimationBlendNode : public ::testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            m_timestamps = m_logicEngine.createDataArray(std::vector<float>{ 0.f, 1.f });
+            m_saveFileConfigNoValidation.setValidationEnabled(false);
+        }
+
+    protected:
+        AnimationNode* createAnimation(const std::vector<AnimationChannel>& channels, std::string_view name = "")
+        {
+            AnimationNodeConfig config;
+            for (const auto& ch : channels)
+            {
+                EXPECT_TRUE(config.addChannel(ch));
+            }
+            return m_logicEngine.createAnimationNode(config, name);
+        }
+
+        template <typename T>
+        AnimationNode* createConstantAnimation(std::string_view channelName, const T& value, std::string_view name = "", EInterpolationType interpolation = EInterpolationType::Linear)
+        {
+            const auto keyframes = m_logicEngine.createDataArray(std::vector<T>{ value, value });
+            return createAnimation({ { std::string{ channelName }, m_timestamps, keyframes, interpolation } }, name);
+        }
+
+        static void setWeights(AnimationBlendNode& blendNode, const std::vector<float>& weights)
+        {
+            const auto weightsProp = blendNode.getInputs()->getChild("weights");
+            ASSERT_EQ(weights.size(), weightsProp->getChildCount());
+            for (size_t i = 0u; i < weights.size(); ++i)
+                EXPECT_TRUE(weightsProp->getChild(i)->set(weights[i]));
+        }
+
+        LogicEngine m_logicEngine{ EFeatureLevel_06 };
+        DataArray* m_timestamps = nullptr;
+        SaveFileConfig m_saveFileConfigNoValidation;
+    };
+
+    TEST_F(AnAnimationBlendNode, IsCreated)
+    {
+        const auto anim1 = createConstantAnimation("channel", 1.f);
+        const auto anim2 = createConstantAnimation("channel", 3.f);
+        const auto blendNode = m_logicEngine.createAnimationBlendNode({ anim1, anim2 }, "blendNode");
+        ASSERT_NE(nullptr, blendNode);
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_EQ(blendNode, m_logicEngine.findByName<AnimationBlendNode>("blendNode"));
+        EXPECT_EQ(1u, m_logicEngine.getCollection<AnimationBlendNode>().size());
+    }
+
+    TEST_F(AnAnimationBlendNode, HasWeightsInputAndChannelOutputsOfFirstSource)
+    {
+        const auto keyframesVec2 = m_logicEngine.createDataArray(std::vector<vec2f>{ { 1.f, 2.f }, { 3.f, 4.f } });
+        const auto keyframesArray = m_logicEngine.createDataArray(std::vector<std::vector<float>>{ { 1.f, 2.f, 3.f }, { 4.f, 5.f, 6.f } });
+        const auto anim1 = createAnimation({ { "vec", m_timestamps, keyframesVec2 }, { "arr", m_timestamps, keyframesArray } });
+        const auto anim2 = createConstantAnimation("other", 3.f);
+        const auto blendNode = m_logicEngine.createAnimationBlendNode({ anim1, anim2 });
+        ASSERT_NE(nullptr, blendNode);
+
+        const auto inputs = blendNode->getInputs();
+        ASSERT_EQ(1u, inputs->getChildCount());
+        const auto weights = inputs->getChild("weights");
+        ASSERT_NE(nullptr, weights);
+        EXPECT_EQ(EPropertyType::Array, weights->getType());
+        ASSERT_EQ(2u, weights->getChildCount());
+        EXPECT_FLOAT_EQ(1.f, *weights->getChild(0u)->get<float>());
+        EXPECT_FLOAT_EQ(0.f, *weights->getChild(1u)->get<float>());
+
+        const auto outputs = blendNode->getOutputs();
+        ASSERT_EQ(2u, outputs->getChildCount());
+        EXPECT_EQ("vec", outputs->getChild(0u)->getName());
+        EXPECT_EQ(EPropertyType::Vec2f, outputs->getChild(0u)->getType());
+        EXPECT_EQ("arr", outputs->getChild(1u)->getName());
+        EXPECT_EQ(EPropertyType::Array, outputs->getChild(1u)->getType());
+        EXPECT_EQ(3u, outputs->getChild(1u)->getChildCount());
+    }
+
+    TEST_F(AnAnimationBlendNode, FailsToBeCreatedWithFeatureLevelLowerThan06)
+    {
+        LogicEngine otherEngine{ EFeatureLevel_05 };
+        EXPECT_EQ(nullptr, otherEngine.createAnimationBlendNode({}));
+        ASSERT_EQ(1u, otherEngine.getErrors().size());
+        EXPECT_EQ("Cannot create AnimationBlendNode, feature level 06 or higher is required, feature level in this runtime set to 05.", otherEngine.getErrors().front().message);
+    }
+
+    TEST_F(AnAnimationBlendNode, FailsToBeCreatedWithoutSources)
+    {
+        EXPECT_EQ(nullptr, m_logicEngine.createAnimationBlendNode({}, "blendNode"));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to create AnimationBlendNode 'blendNode': must provide at least one source animation node.", m_logicEngine.getErrors().front().message);
+    }
+
+    TEST_F(AnAnimationBlendNode, FailsToBeCreatedWithSourceFromOtherLogicInstance)
+    {
+        LogicEngine otherEngine{ EFeatureLevel_06 };
+        const auto otherTimestamps = otherEngine.createDataArray(std::vector<float>{ 0.f, 1.f });
+        AnimationNodeConfig config;
+        EXPECT_TRUE(config.addChannel({ "channel", otherTimestamps, otherTimestamps }));
+        const auto otherAnim = otherEngine.createAnimationNode(config);
+
+        const auto anim = createConstantAnimation("channel", 1.f);
+        EXPECT_EQ(nullptr, m_logicEngine.createAnimationBlendNode({ anim, otherAnim }, "blendNode"));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to create AnimationBlendNode 'blendNode': source animation node was not found in this logic instance.", m_logicEngine.getErrors().front().message);
+    }
+
+    TEST_F(AnAnimationBlendNode, FailsToBeCreatedWithDuplicateSource)
+    {
+        const auto anim = createConstantAnimation("channel", 1.f, "anim");
+        EXPECT_EQ(nullptr, m_logicEngine.createAnimationBlendNode({ anim, anim }, "blendNode"));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to create AnimationBlendNode 'blendNode': source animation node 'anim' provided more than once.", m_logicEngine.getErrors().front().message);
+    }
+
+    TEST_F(AnAnimationBlendNode, BlendsFloatAndIntegerChannelsByNormalizedWeights)
+    {
+        const auto keyframesFloat1 = m_logicEngine.createDataArray(std::vector<float>{ 1.f, 1.f });
+        const auto keyframesFloat2 = m_logicEngine.createDataArray(std::vector<float>{ 4.f, 4.f });
+        const auto keyframesInt1 = m_logicEngine.createDataArray(std::vector<vec2i>{ { 0, 10 }, { 0, 10 } });
+        const auto keyframesInt2 = m_logicEngine.createDataArray(std::vector<vec2i>{ { 3, 20 }, { 3, 20 } });
+        const auto anim1 = createAnimation({ { "f", m_timestamps, keyframesFloat1 }, { "i", m_timestamps, keyframesInt1 } });
+        const auto anim2 = createAnimation({ { "f", m_timestamps, keyframesFloat2 }, { "i", m_timestamps, keyframesInt2 } });
+        const auto blendNode = m_logicEngine.createAnimationBlendNode({ anim1, anim2 });
+        ASSERT_NE(nullptr, blendNode);
+
+        // weights do not need to sum up to 1
+        setWeights(*blendNode, { 2.f, 1.f });
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(2.f, *blendNode->getOutputs()->getChild("f")->get<float>());
+        EXPECT_EQ(vec2i(1, 13), *blendNode->getOutputs()->getChild("i")->get<vec2i>());
+
+        setWeights(*blendNode, { 0.f, 1.f });
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(4.f, *blendNode->getOutputs()->getChild("f")->get<float>());
+        EXPECT_EQ(vec2i(3, 20), *blendNode->getOutputs()->getChild("i")->get<vec2i>());
+    }
+
+    TEST_F(AnAnimationBlendNode, TreatsNegativeWeightsAsZeroAndFallsBackToFirstSourceIfAllWeightsZero)
+    {
+        const auto anim1 = createConstantAnimation("channel", 1.f);
+        const auto anim2 = createConstantAnimation("channel", 3.f);
+        const auto blendNode = m_logicEngine.createAnimationBlendNode({ anim1, anim2 });
+        ASSERT_NE(nullptr, blendNode);
+
+        setWeights(*blendNode, { -1.f, 1.f });
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(3.f, *blendNode->getOutputs()->getChild("channel")->get<float>());
+
+        setWeights(*blendNode, { 0.f, -1.f });
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(1.f, *blendNode->getOutputs()->getChild("channel")->get<float>());
+    }
+
+    TEST_F(AnAnimationBlendNode, IgnoresSourcesWithoutMatchingChannel)
+    {
+        const auto anim1 = createConstantAnimation("channel", 1.f);
+        const auto anim2 = createConstantAnimation("otherName", 3.f);
+        const auto anim3 = createConstantAnimation("channel", vec2f{ 5.f, 5.f });
+        const auto blendNode = m_logicEngine.createAnimationBlendNode({ anim1, anim2, anim3 });
+        ASSERT_NE(nullptr, blendNode);
+
+        setWeights(*blendNode, { 1.f, 1.f, 1.f });
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(1.f, *blendNode->getOutputs()->getChild("channel")->get<float>());
+    }
+
+    TEST_F(AnAnimationBlendNode, BlendsArrayChannels)
+    {
+        const auto keyframes1 = m_logicEngine.createDataArray(std::vector<std::vector<float>>{ { 0.f, 2.f }, { 0.f, 2.f } });
+        const auto keyframes2 = m_logicEngine.createDataArray(std::vector<std::vector<float>>{ { 4.f, 4.f }, { 4.f, 4.f } });
+        const auto anim1 = createAnimation({ { "arr", m_timestamps, keyframes1 } });
+        const auto anim2 = createAnimation({ { "arr", m_timestamps, keyframes2 } });
+        const auto blendNode = m_logicEngine.createAnimationBlendNode({ anim1, anim2 });
+        ASSERT_NE(nullptr, blendNode);
+
+        setWeights(*blendNode, { 0.5f, 0.5f });
+        EXPECT_TRUE(m_logicEngine.update());
+        const auto arr = blendNode->getOutputs()->getChild("arr");
+        EXPECT_FLOAT_EQ(2.f, *arr->getChild(0u)->get<float>());
+        EXPECT_FLOAT_EQ(3.f, *arr->getChild(1u)->get<float>());
+    }
+
+    TEST_F(AnAnimationBlendNode, BlendsQuaternionsInSameHemisphereAndNormalizesResult)
+    {
+        // second quaternion represents same rotation as first one but with flipped sign
+        const auto anim1 = createConstantAnimation("rot", vec4f{ 0.f, 0.f, 0.f, 1.f }, "", EInterpolationType::Linear_Quaternions);
+        const auto anim2 = createConstantAnimation("rot", vec4f{ 0.f, 0.f, 0.f, -1.f }, "", EInterpolationType::Linear_Quaternions);
+        const auto anim3 = createConstantAnimation("rot", vec4f{ 0.f, 0.f, -1.f, 0.f }, "", EInterpolationType::Linear_Quaternions);
+        const auto blendNode = m_logicEngine.createAnimationBlendNode({ anim1, anim2, anim3 });
+        ASSERT_NE(nullptr, blendNode);
+
+        setWeights(*blendNode, { 0.5f, 0.5f, 0.f });
+        EXPECT_TRUE(m_logicEngine.update());
+        auto rot = *blendNode->getOutputs()->getChild("rot")->get<vec4f>();
+        EXPECT_FLOAT_EQ(0.f, rot[2]);
+        EXPECT_FLOAT_EQ(1.f, rot[3]);
+
+        setWeights(*blendNode, { 1.f, 0.f, 1.f });
+        EXPECT_TRUE(m_logicEngine.update());
+        rot = *blendNode->getOutputs()->getChild("rot")->get<vec4f>();
+        EXPECT_FLOAT_EQ(-1.f / std::sqrt(2.f), rot[2]);
+        EXPECT_FLOAT_EQ(1.f / std::sqrt(2.f), rot[3]);
+    }
+
+    TEST_F(AnAnimationBlendNode, IsUpdatedAfterSourceAnimationWithoutLinks)
+    {
+        const auto keyframes1 = m_logicEngine.createDataArray(std::vector<float>{ 0.f, 10.f });
+        const auto keyframes2 = m_logicEngine.createDataArray(std::vector<float>{ 0.f, 20.f });
+        const auto anim1 = createAnimation({ { "channel", m_timestamps, keyframes1 } });
+        const auto anim2 = createAnimation({ { "channel", m_timestamps, keyframes2 } });
+        const auto blendNode = m_logicEngine.createAnimationBlendNode({ anim1, anim2 });
+        ASSERT_NE(nullptr, blendNode);
+        setWeights(*blendNode, { 1.f, 1.f });
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(0.f, *blendNode->getOutputs()->getChild("channel")->get<float>());
+
+        EXPECT_TRUE(anim1->getInputs()->getChild("progress")->set(0.5f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(2.5f, *blendNode->getOutputs()->getChild("channel")->get<float>());
+
+        EXPECT_TRUE(anim2->getInputs()->getChild("progress")->set(1.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(12.5f, *blendNode->getOutputs()->getChild("channel")->get<float>());
+    }
+
+    TEST_F(AnAnimationBlendNode, PreventsDestructionOfSourceAnimation)
+    {
+        const auto anim1 = createConstantAnimation("channel", 1.f, "anim1");
+        const auto anim2 = createConstantAnimation("channel", 3.f, "anim2");
+        const auto blendNode = m_logicEngine.createAnimationBlendNode({ anim1, anim2 }, "blendNode");
+        ASSERT_NE(nullptr, blendNode);
+
+        EXPECT_FALSE(m_logicEngine.destroy(*anim2));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to destroy animation node 'anim2', it is used in animation blend node 'blendNode'", m_logicEngine.getErrors().front().message);
+
+        EXPECT_TRUE(m_logicEngine.destroy(*blendNode));
+        EXPECT_TRUE(m_logicEngine.destroy(*anim2));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+    }
+
+    TEST_F(AnAnimationBlendNode, CanBeSerializedAndDeserialized)
+    {
+        WithTempDirectory tempDir;
+        {
+            LogicEngine otherEngine{ EFeatureLevel_06 };
+            const auto timestamps = otherEngine.createDataArray(std::vector<float>{ 0.f, 1.f });
+            const auto keyframes1 = otherEngine.createDataArray(std::vector<float>{ 2.f, 2.f });
+            const auto keyframes2 = otherEngine.createDataArray(std::vector<float>{ 6.f, 6.f });
+            AnimationNodeConfig config1;
+            EXPECT_TRUE(config1.addChannel({ "channel", timestamps, keyframes1 }));
+            AnimationNodeConfig config2;
+            EXPECT_TRUE(config2.addChannel({ "channel", timestamps, keyframes2 }));
+            const auto anim1 = otherEngine.createAnimationNode(config1, "anim1");
+            const auto anim2 = otherEngine.createAnimationNode(config2, "anim2");
+            const auto blendNode = otherEngine.createAnimationBlendNode({ anim1, anim2 }, "blendNode");
+            ASSERT_NE(nullptr, blendNode);
+            setWeights(*blendNode, { 1.f, 3.f });
+            ASSERT_TRUE(otherEngine.saveToFile("logic_blendNode.bin", m_saveFileConfigNoValidation));
+        }
+
+        ASSERT_TRUE(m_logicEngine.loadFromFile("logic_blendNode.bin"));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        const auto blendNode = m_logicEngine.findByName<AnimationBlendNode>("blendNode");
+        ASSERT_NE(nullptr, blendNode);
+        EXPECT_FLOAT_EQ(3.f, *blendNode->getInputs()->getChild("weights")->getChild(1u)->get<float>());
+
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(5.f, *blendNode->getOutputs()->getChild("channel")->get<float>());
+
+        // sources are still protected after loading
+        EXPECT_FALSE(m_logicEngine.destroy(*m_logicEngine.findByName<AnimationNode>("anim1")));
+    }
+}
@@ -724,6 +724,212 @@ namespace rlogic::internal
         EXPECT_NE(nullptr, m_logicEngine.createAnimationNode(config, "animNode"));
     }
 
+    class AnAnimationNode_PlaybackControl : public AnAnimationNode
+    {
+    protected:
+        void SetUp() override
+        {
+            AnAnimationNode::SetUp();
+
+            // keyframes equal timestamps so that channel output equals local animation time
+            const auto timestamps = m_logicEngine.createDataArray(std::vector<float>{ 0.f, 4.f });
+            AnimationNodeConfig config;
+            EXPECT_TRUE(config.addChannel({ "channel", timestamps, timestamps }));
+            EXPECT_TRUE(config.setExposingOfChannelDataAsProperties(GetParam()));
+            config.setPlaybackControlEnabled(true);
+            m_animNode = m_logicEngine.createAnimationNode(config, "animNode");
+            ASSERT_NE(nullptr, m_animNode);
+        }
+
+        void tickAndExpectTime(int64_t ticker_us, float expectedTime)
+        {
+            EXPECT_TRUE(m_animNode->getInputs()->getChild("ticker_us")->set(ticker_us));
+            EXPECT_TRUE(m_logicEngine.update());
+            EXPECT_FLOAT_EQ(expectedTime, *m_animNode->getOutputs()->getChild("channel")->get<float>());
+        }
+
+        void setLoopMode(EAnimationLoopMode loopMode)
+        {
+            EXPECT_TRUE(m_animNode->getInputs()->getChild("loopMode")->set(static_cast<int32_t>(loopMode)));
+        }
+
+        AnimationNode* m_animNode = nullptr;
+    };
+
+    INSTANTIATE_TEST_SUITE_P(
+        AnAnimationNode_PlaybackControl_TestInstances,
+        AnAnimationNode_PlaybackControl,
+        ::testing::Values(
+            false, // without animation data exposed as properties
+            true)  // with animation data exposed as properties
+    );
+
+    TEST_P(AnAnimationNode_PlaybackControl, HasPlaybackInputsWithDefaultValues)
+    {
+        const auto inputs = m_animNode->getInputs();
+        ASSERT_EQ(GetParam() ? 8u : 7u, inputs->getChildCount());
+        EXPECT_EQ("progress", inputs->getChild(0u)->getName());
+        EXPECT_EQ("ticker_us", inputs->getChild(1u)->getName());
+        EXPECT_EQ(EPropertyType::Int64, inputs->getChild(1u)->getType());
+        EXPECT_EQ("play", inputs->getChild(2u)->getName());
+        EXPECT_EQ(EPropertyType::Bool, inputs->getChild(2u)->getType());
+        EXPECT_EQ("speed", inputs->getChild(3u)->getName());
+        EXPECT_EQ(EPropertyType::Float, inputs->getChild(3u)->getType());
+        EXPECT_EQ("loopMode", inputs->getChild(4u)->getName());
+        EXPECT_EQ(EPropertyType::Int32, inputs->getChild(4u)->getType());
+        EXPECT_EQ("startTime", inputs->getChild(5u)->getName());
+        EXPECT_EQ(EPropertyType::Float, inputs->getChild(5u)->getType());
+        EXPECT_EQ("endTime", inputs->getChild(6u)->getName());
+        EXPECT_EQ(EPropertyType::Float, inputs->getChild(6u)->getType());
+        if (GetParam())
+        {
+            EXPECT_EQ("channelsData", inputs->getChild(7u)->getName());
+        }
+
+        EXPECT_FALSE(*inputs->getChild("play")->get<bool>());
+        EXPECT_FLOAT_EQ(1.f, *inputs->getChild("speed")->get<float>());
+        EXPECT_EQ(static_cast<int32_t>(EAnimationLoopMode::Once), *inputs->getChild("loopMode")->get<int32_t>());
+        EXPECT_FLOAT_EQ(0.f, *inputs->getChild("startTime")->get<float>());
+        EXPECT_FLOAT_EQ(4.f, *inputs->getChild("endTime")->get<float>());
+    }
+
+    TEST_P(AnAnimationNode_PlaybackControl, FailsToBeCreatedWithFeatureLevelLowerThan06)
+    {
+        LogicEngine otherEngine{ EFeatureLevel_05 };
+        const auto timestamps = otherEngine.createDataArray(std::vector<float>{ 0.f, 4.f });
+        AnimationNodeConfig config;
+        EXPECT_TRUE(config.addChannel({ "channel", timestamps, timestamps }));
+        config.setPlaybackControlEnabled(true);
+        EXPECT_EQ(nullptr, otherEngine.createAnimationNode(config, "animNode"));
+        ASSERT_EQ(1u, otherEngine.getErrors().size());
+        EXPECT_EQ("Cannot create AnimationNode 'animNode' with playback control, feature level 06 or higher is required, feature level in this runtime set to 05.",
+            otherEngine.getErrors().front().message);
+    }
+
+    TEST_P(AnAnimationNode_PlaybackControl, AdvancesByTickerDifferenceWhilePlaying)
+    {
+        tickAndExpectTime(1000000, 0.f);
+
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("play")->set(true));
+        // first tick after starting playback is only used as reference
+        tickAndExpectTime(2000000, 0.f);
+        tickAndExpectTime(3000000, 1.f);
+        tickAndExpectTime(3500000, 1.5f);
+
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("speed")->set(2.f));
+        tickAndExpectTime(4000000, 2.5f);
+
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("speed")->set(-1.f));
+        tickAndExpectTime(5000000, 1.5f);
+    }
+
+    TEST_P(AnAnimationNode_PlaybackControl, PausesAndResumesWithoutJump)
+    {
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("play")->set(true));
+        tickAndExpectTime(1000000, 0.f);
+        tickAndExpectTime(2000000, 1.f);
+
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("play")->set(false));
+        tickAndExpectTime(3000000, 1.f);
+        tickAndExpectTime(4000000, 1.f);
+
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("play")->set(true));
+        tickAndExpectTime(5000000, 1.f);
+        tickAndExpectTime(5500000, 1.5f);
+    }
+
+    TEST_P(AnAnimationNode_PlaybackControl, StopsAtEndWhenPlayingOnce)
+    {
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("play")->set(true));
+        tickAndExpectTime(1000000, 0.f);
+        tickAndExpectTime(4000000, 3.f);
+        tickAndExpectTime(9000000, 4.f);
+        tickAndExpectTime(10000000, 4.f);
+    }
+
+    TEST_P(AnAnimationNode_PlaybackControl, WrapsAroundWhenLooping)
+    {
+        setLoopMode(EAnimationLoopMode::Loop);
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("play")->set(true));
+        tickAndExpectTime(1000000, 0.f);
+        tickAndExpectTime(4000000, 3.f);
+        tickAndExpectTime(6000000, 1.f);
+        tickAndExpectTime(16500000, 3.5f);
+    }
+
+    TEST_P(AnAnimationNode_PlaybackControl, ReversesDirectionWhenPlayingPingPong)
+    {
+        setLoopMode(EAnimationLoopMode::PingPong);
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("play")->set(true));
+        tickAndExpectTime(1000000, 0.f);
+        tickAndExpectTime(4000000, 3.f);
+        tickAndExpectTime(6000000, 3.f);
+        tickAndExpectTime(8000000, 1.f);
+        tickAndExpectTime(10000000, 1.f);
+    }
+
+    TEST_P(AnAnimationNode_PlaybackControl, PlaysWithinClipRange)
+    {
+        setLoopMode(EAnimationLoopMode::Loop);
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("startTime")->set(1.f));
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("endTime")->set(3.f));
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("play")->set(true));
+        tickAndExpectTime(1000000, 1.f);
+        tickAndExpectTime(2500000, 2.5f);
+        tickAndExpectTime(3500000, 1.5f);
+
+        // clip range is clamped to animation duration
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("endTime")->set(10.f));
+        tickAndExpectTime(5000000, 3.f);
+        tickAndExpectTime(6000000, 1.f);
+    }
+
+    TEST_P(AnAnimationNode_PlaybackControl, SeeksWhenProgressIsSet)
+    {
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("play")->set(true));
+        tickAndExpectTime(1000000, 0.f);
+        tickAndExpectTime(2000000, 1.f);
+
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("progress")->set(0.5f));
+        tickAndExpectTime(2000000, 2.f);
+        tickAndExpectTime(3000000, 3.f);
+    }
+
+    TEST_P(AnAnimationNode_PlaybackControl, FailsUpdateWithInvalidLoopMode)
+    {
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("loopMode")->set(3));
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Invalid loop mode 3 set in AnimationNode playback control!", m_logicEngine.getErrors().front().message);
+        EXPECT_EQ(m_animNode, m_logicEngine.getErrors().front().object);
+    }
+
+    TEST_P(AnAnimationNode_PlaybackControl, KeepsPlaybackInputsAfterSerialization)
+    {
+        setLoopMode(EAnimationLoopMode::PingPong);
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("speed")->set(0.5f));
+        EXPECT_TRUE(m_animNode->getInputs()->getChild("endTime")->set(2.f));
+
+        WithTempDirectory tempDir;
+        ASSERT_TRUE(m_logicEngine.saveToFile("logic_playback.bin", m_saveFileConfigNoValidation));
+
+        LogicEngine otherEngine{ EFeatureLevel_Latest };
+        ASSERT_TRUE(otherEngine.loadFromFile("logic_playback.bin"));
+        const auto animNode = otherEngine.findByName<AnimationNode>("animNode");
+        ASSERT_NE(nullptr, animNode);
+        const auto inputs = animNode->getInputs();
+        EXPECT_EQ(static_cast<int32_t>(EAnimationLoopMode::PingPong), *inputs->getChild("loopMode")->get<int32_t>());
+        EXPECT_FLOAT_EQ(0.5f, *inputs->getChild("speed")->get<float>());
+        EXPECT_FLOAT_EQ(2.f, *inputs->getChild("endTime")->get<float>());
+
+        EXPECT_TRUE(inputs->getChild("play")->set(true));
+        EXPECT_TRUE(inputs->getChild("ticker_us")->set(int64_t{ 1000000 }));
+        EXPECT_TRUE(otherEngine.update());
+        EXPECT_TRUE(inputs->getChild("ticker_us")->set(int64_t{ 6000000 }));
+        EXPECT_TRUE(otherEngine.update());
+        EXPECT_FLOAT_EQ(1.5f, *animNode->getOutputs()->getChild("channel")->get<float>());
+    }
+
     class AnAnimationNode_SerializationLifecycle : public AnAnimationNode
     {
     protected:
@@ -745,7 +951,8 @@ namespace rlogic::internal
             PropertyOutMissing,
             PropertyInWrongName,
             PropertyOutWrongName,
-            PropertyChannelsDataInvalid
+            PropertyChannelsDataInvalid,
+            PlaybackControlBelowFeatureLevel06
         };
 
         std::unique_ptr<AnimationNodeImpl> deserializeSerializedDataWithIssue(ESerializationIssue issue)
@@ -811,14 +1018,16 @@ namespace rlogic::internal
                     issue == ESerializationIssue::ChannelsMissing ? 0 : flatBufferBuilder.CreateVector(channelsFB),
                     issue == ESerializationIssue::PropertyChannelsDataInvalid,
                     issue == ESerializationIssue::RootInMissing ? 0 : PropertyImpl::Serialize(*inputsImpl, flatBufferBuilder, serializationMap),
-                    issue == ESerializationIssue::RootOutMissing ? 0 : PropertyImpl::Serialize(*outputsImpl, flatBufferBuilder, serializationMap)
+                    issue == ESerializationIssue::RootOutMissing ? 0 : PropertyImpl::Serialize(*outputsImpl, flatBufferBuilder, serializationMap),
+                    issue == ESerializationIssue::PlaybackControlBelowFeatureLevel06
                 );
 
                 flatBufferBuilder.Finish(animNodeFB);
             }
 
             const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::AnimationNode>(flatBufferBuilder.GetBufferPointer());
-            return AnimationNodeImpl::Deserialize(serialized, m_errorReporting, deserializationMap);
+            const EFeatureLevel featureLevel = (issue == ESerializationIssue::PlaybackControlBelowFeatureLevel06 ? EFeatureLevel_05 : m_logicEngine.getFeatureLevel());
+            return AnimationNodeImpl::Deserialize(serialized, m_errorReporting, deserializationMap, featureLevel);
         }
 
         ErrorReporting m_errorReporting;
@@ -890,4 +1099,11 @@ namespace rlogic::internal
         ASSERT_FALSE(m_errorReporting.getErrors().empty());
         EXPECT_EQ("Fatal error during loading of AnimationNode 'animNode': missing or invalid channels data property!", m_errorReporting.getErrors().front().message);
     }
+
+    TEST_P(AnAnimationNode_SerializationLifecycle, FailsDeserializationIfPlaybackControlNotSupportedByFeatureLevel)
+    {
+        EXPECT_FALSE(deserializeSerializedDataWithIssue(ESerializationIssue::PlaybackControlBelowFeatureLevel06));
+        ASSERT_FALSE(m_errorReporting.getErrors().empty());
+        EXPECT_EQ("Fatal error during loading of AnimationNode 'animNode': playback control requires feature level 06 or higher!", m_errorReporting.getErrors().front().message);
+    }
 }
@@ -0,0 +1,277 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+#include "ramses-logic/RamsesNodeBinding.h"
+#include "ramses-logic/LogicEngineReport.h"
+
+#include "ramses-client-api/Node.h"
+
+namespace rlogic
+{
+    class ALogicEngine_BudgetedUpdate : public ALogicEngine
+    {
+    protected:
+        ALogicEngine_BudgetedUpdate()
+        {
+            m_logicEngine.enableUpdateReport(true);
+        }
+
+        LuaScript* createPassThroughScript(std::string_view name)
+        {
+            return m_logicEngine.createLuaScript(R"(
+                function interface(IN,OUT)
+                    IN.value = Type:Int32()
+                    OUT.value = Type:Int32()
+                end
+                function run(IN,OUT)
+                    OUT.value = IN.value
+                end
+            )", {}, name);
+        }
+
+        static Property& Input(LuaScript& script)
+        {
+            return *script.getInputs()->getChild("value");
+        }
+
+        static const Property& Output(const LuaScript& script)
+        {
+            return *script.getOutputs()->getChild("value");
+        }
+
+        std::vector<LogicNode*> getExecutedNodes()
+        {
+            std::vector<LogicNode*> executedNodes;
+            for (const auto& nodeTimed : m_logicEngine.getLastUpdateReport().getNodesExecuted())
+                executedNodes.push_back(nodeTimed.first);
+            return executedNodes;
+        }
+
+        // script1 -> script2 -> script3
+        void createLinkedScripts()
+        {
+            m_script1 = createPassThroughScript("script1");
+            m_script2 = createPassThroughScript("script2");
+            m_script3 = createPassThroughScript("script3");
+            ASSERT_TRUE(m_logicEngine.link(Output(*m_script1), Input(*m_script2)));
+            ASSERT_TRUE(m_logicEngine.link(Output(*m_script2), Input(*m_script3)));
+        }
+
+        // with zero budget exactly one node is processed per call
+        static constexpr std::chrono::microseconds NoBudget{ 0 };
+        static constexpr std::chrono::microseconds LargeBudget{ std::chrono::seconds{ 100 } };
+
+        LuaScript* m_script1 = nullptr;
+        LuaScript* m_script2 = nullptr;
+        LuaScript* m_script3 = nullptr;
+    };
+
+    TEST_F(ALogicEngine_BudgetedUpdate, IsSettledInitially)
+    {
+        EXPECT_TRUE(m_logicEngine.isUpdateSettled());
+    }
+
+    TEST_F(ALogicEngine_BudgetedUpdate, UpdatesAllNodesAtOnceIfBudgetIsSufficient)
+    {
+        createLinkedScripts();
+        Input(*m_script1).set(5);
+
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(LargeBudget));
+        EXPECT_TRUE(m_logicEngine.isUpdateSettled());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_script1, m_script2, m_script3));
+        EXPECT_EQ(5, *Output(*m_script3).get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_BudgetedUpdate, ContinuesUpdateWithNextCallOnceBudgetIsExhausted)
+    {
+        createLinkedScripts();
+        Input(*m_script1).set(5);
+
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget));
+        EXPECT_FALSE(m_logicEngine.isUpdateSettled());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_script1));
+
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget));
+        EXPECT_FALSE(m_logicEngine.isUpdateSettled());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_script2));
+        EXPECT_EQ(0, *Output(*m_script3).get<int32_t>());
+
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget));
+        EXPECT_TRUE(m_logicEngine.isUpdateSettled());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_script3));
+        EXPECT_EQ(5, *Output(*m_script3).get<int32_t>());
+
+        // next update processes one node per call again
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget));
+        EXPECT_FALSE(m_logicEngine.isUpdateSettled());
+        EXPECT_TRUE(getExecutedNodes().empty());
+    }
+
+    TEST_F(ALogicEngine_BudgetedUpdate, StartsOverIfAlreadyUpdatedNodeGetsDirtyAgain)
+    {
+        createLinkedScripts();
+
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget));
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget));
+        Input(*m_script1).set(7);
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget));
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_script3));
+        EXPECT_FALSE(m_logicEngine.isUpdateSettled());
+        EXPECT_EQ(0, *Output(*m_script3).get<int32_t>());
+
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(LargeBudget));
+        EXPECT_TRUE(m_logicEngine.isUpdateSettled());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_script1, m_script2, m_script3));
+        EXPECT_EQ(7, *Output(*m_script3).get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_BudgetedUpdate, SettlesAndAppliesBindingsEvenIfInputIsSetBeforeEveryCall)
+    {
+        createLinkedScripts();
+        RamsesNodeBinding* nodeBinding = m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "nodeBinding");
+        LuaScript* vecScript = m_logicEngine.createLuaScript(R"(
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+                OUT.translation = Type:Vec3f()
+            end
+            function run(IN,OUT)
+                OUT.translation = { IN.value, 0, 0 }
+            end
+        )", {}, "vecScript");
+        ASSERT_TRUE(m_logicEngine.link(Output(*m_script3), *vecScript->getInputs()->getChild("value")));
+        ASSERT_TRUE(m_logicEngine.link(*vecScript->getOutputs()->getChild("translation"), *nodeBinding->getInputs()->getChild("translation")));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        // 4 nodes are updated one per call, update restarts at most twice
+        int32_t value = 0;
+        size_t callCount = 0u;
+        do
+        {
+            Input(*m_script1).set(++value);
+            ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget, true));
+            ++callCount;
+        } while (!m_logicEngine.isUpdateSettled() && callCount < 100u);
+        EXPECT_EQ(12u, callCount);
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(vecScript, nodeBinding));
+
+        // binding gets value which was propagated through all nodes, last value set is left to next update
+        vec3f translation{ 0.f, 0.f, 0.f };
+        m_node->getTranslation(translation[0], translation[1], translation[2]);
+        EXPECT_EQ((vec3f{ 9.f, 0.f, 0.f }), translation);
+        EXPECT_EQ(12, *Input(*m_script1).get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_BudgetedUpdate, StartsOverIfNodesChangeBetweenCalls)
+    {
+        createLinkedScripts();
+
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget));
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget));
+
+        LuaScript* script4 = createPassThroughScript("script4");
+        ASSERT_TRUE(m_logicEngine.link(Output(*m_script3), Input(*script4)));
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(LargeBudget));
+        EXPECT_TRUE(m_logicEngine.isUpdateSettled());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_script3, script4));
+
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget));
+        ASSERT_TRUE(m_logicEngine.destroy(*script4));
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(LargeBudget));
+        EXPECT_TRUE(m_logicEngine.isUpdateSettled());
+    }
+
+    TEST_F(ALogicEngine_BudgetedUpdate, FullUpdateFinishesUnsettledUpdate)
+    {
+        createLinkedScripts();
+        Input(*m_script1).set(5);
+
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget));
+        EXPECT_FALSE(m_logicEngine.isUpdateSettled());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.isUpdateSettled());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_script2, m_script3));
+        EXPECT_EQ(5, *Output(*m_script3).get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_BudgetedUpdate, AppliesBindingsOnlyOnceAllOtherNodesAreUpdated)
+    {
+        createLinkedScripts();
+        RamsesNodeBinding* nodeBinding = m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "nodeBinding");
+        LuaScript* vecScript = m_logicEngine.createLuaScript(R"(
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+                OUT.translation = Type:Vec3f()
+            end
+            function run(IN,OUT)
+                OUT.translation = { IN.value, 0, 0 }
+            end
+        )", {}, "vecScript");
+        ASSERT_TRUE(m_logicEngine.link(Output(*m_script3), *vecScript->getInputs()->getChild("value")));
+        ASSERT_TRUE(m_logicEngine.link(*vecScript->getOutputs()->getChild("translation"), *nodeBinding->getInputs()->getChild("translation")));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        Input(*m_script1).set(3);
+        for (size_t i = 0u; i < 3u; ++i)
+        {
+            ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget, true));
+            EXPECT_FALSE(m_logicEngine.isUpdateSettled());
+        }
+
+        // binding is executed together with last of the other nodes
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget, true));
+        EXPECT_TRUE(m_logicEngine.isUpdateSettled());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(vecScript, nodeBinding));
+
+        vec3f translation{ 0.f, 0.f, 0.f };
+        m_node->getTranslation(translation[0], translation[1], translation[2]);
+        EXPECT_EQ((vec3f{ 3.f, 0.f, 0.f }), translation);
+    }
+
+    TEST_F(ALogicEngine_BudgetedUpdate, DoesNotApplyBindingsIfAlreadyUpdatedNodeGetsDirtyAgain)
+    {
+        createLinkedScripts();
+        RamsesNodeBinding* nodeBinding = m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "nodeBinding");
+        LuaScript* vecScript = m_logicEngine.createLuaScript(R"(
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+                OUT.translation = Type:Vec3f()
+            end
+            function run(IN,OUT)
+                OUT.translation = { IN.value, 0, 0 }
+            end
+        )", {}, "vecScript");
+        ASSERT_TRUE(m_logicEngine.link(Output(*m_script3), *vecScript->getInputs()->getChild("value")));
+        ASSERT_TRUE(m_logicEngine.link(*vecScript->getOutputs()->getChild("translation"), *nodeBinding->getInputs()->getChild("translation")));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        Input(*m_script1).set(3);
+        for (size_t i = 0u; i < 3u; ++i)
+            ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget, true));
+
+        // last of the other nodes is updated but pass starts over, binding is not applied with outdated values
+        Input(*m_script1).set(4);
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(NoBudget, true));
+        EXPECT_FALSE(m_logicEngine.isUpdateSettled());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(vecScript));
+
+        vec3f translation{ 0.f, 0.f, 0.f };
+        m_node->getTranslation(translation[0], translation[1], translation[2]);
+        EXPECT_EQ((vec3f{ 0.f, 0.f, 0.f }), translation);
+
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(LargeBudget, true));
+        EXPECT_TRUE(m_logicEngine.isUpdateSettled());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_script1, m_script2, m_script3, vecScript, nodeBinding));
+        m_node->getTranslation(translation[0], translation[1], translation[2]);
+        EXPECT_EQ((vec3f{ 4.f, 0.f, 0.f }), translation);
+    }
+}
@@ -15,6 +15,7 @@
 
 #include "ramses-logic/RamsesLogicVersion.h"
 #include "ramses-logic/Property.h"
+#include "ramses-logic/AnimationBlendNode.h"
 
 #include "ramses-client-api/EffectDescription.h"
 #include "ramses-client-api/Effect.h"
@@ -178,10 +179,12 @@ namespace rlogic::internal
             { EFeatureLevel_01, EFeatureLevel_03 },
             { EFeatureLevel_01, EFeatureLevel_04 },
             { EFeatureLevel_01, EFeatureLevel_05 },
+            { EFeatureLevel_01, EFeatureLevel_06 },
             { EFeatureLevel_02, EFeatureLevel_01 },
             { EFeatureLevel_03, EFeatureLevel_01 },
             { EFeatureLevel_04, EFeatureLevel_01 },
-            { EFeatureLevel_05, EFeatureLevel_01 }
+            { EFeatureLevel_05, EFeatureLevel_01 },
+            { EFeatureLevel_06, EFeatureLevel_01 }
         };
 
         for (const auto& comb : combinations)
@@ -464,12 +467,55 @@ namespace rlogic::internal
             EXPECT_FALSE(logicEngine.findByName<LogicObject>("meshnodebinding"));
         }
 
+        static void expectFeatureLevel06Content(LogicEngine& logicEngine)
+        {
+            const auto animNode = logicEngine.findByName<AnimationNode>("animNode");
+            const auto animNodeWithPlaybackControl = logicEngine.findByName<AnimationNode>("animNodeWithPlaybackControl");
+            ASSERT_TRUE(animNode && animNodeWithPlaybackControl);
+            const auto playbackInputs = animNodeWithPlaybackControl->getInputs();
+            EXPECT_EQ(7u, playbackInputs->getChildCount());
+            EXPECT_NE(nullptr, playbackInputs->getChild("ticker_us"));
+            EXPECT_NE(nullptr, playbackInputs->getChild("play"));
+            EXPECT_NE(nullptr, playbackInputs->getChild("loopMode"));
+            EXPECT_NE(nullptr, playbackInputs->getChild("startTime"));
+            ASSERT_NE(nullptr, playbackInputs->getChild("speed"));
+            ASSERT_NE(nullptr, playbackInputs->getChild("endTime"));
+            EXPECT_FLOAT_EQ(1.f, *playbackInputs->getChild("speed")->get<float>());
+            EXPECT_FLOAT_EQ(2.f, *playbackInputs->getChild("endTime")->get<float>());
+
+            const auto blendNode = logicEngine.findByName<AnimationBlendNode>("animBlendNode");
+            ASSERT_TRUE(blendNode);
+            const auto weights = blendNode->getInputs()->getChild("weights");
+            ASSERT_NE(nullptr, weights);
+            ASSERT_EQ(2u, weights->getChildCount());
+            ASSERT_NE(nullptr, blendNode->getOutputs()->getChild("channel"));
+
+            // blend start of first source with end of second source
+            animNode->getInputs()->getChild("progress")->set(0.f);
+            playbackInputs->getChild("progress")->set(1.f);
+            weights->getChild(0u)->set(1.f);
+            weights->getChild(1u)->set(1.f);
+            EXPECT_TRUE(logicEngine.update());
+            EXPECT_FLOAT_EQ(1.f, *animNode->getOutputs()->getChild("channel")->get<float>());
+            EXPECT_FLOAT_EQ(2.f, *animNodeWithPlaybackControl->getOutputs()->getChild("channel")->get<float>());
+            EXPECT_FLOAT_EQ(1.5f, *blendNode->getOutputs()->getChild("channel")->get<float>());
+        }
+
+        static void expectFeatureLevel06ContentNotPresent(const LogicEngine& logicEngine)
+        {
+            EXPECT_FALSE(logicEngine.findByName<LogicObject>("animNodeWithPlaybackControl"));
+            EXPECT_FALSE(logicEngine.findByName<LogicObject>("animBlendNode"));
+        }
+
         static void checkContents(LogicEngine& logicEngine, ramses::Scene& scene)
         {
             // check for content expected to exist
             // higher feature level always contains content supported by lower level
             switch (logicEngine.getFeatureLevel())
             {
+            case EFeatureLevel_06:
+                expectFeatureLevel06Content(logicEngine);
+                [[fallthrough]];
             case EFeatureLevel_05:
                 expectFeatureLevel05Content(logicEngine);
                 [[fallthrough]];
@@ -504,6 +550,9 @@ namespace rlogic::internal
                 expectFeatureLevel05ContentNotPresent(logicEngine);
                 [[fallthrough]];
             case EFeatureLevel_05:
+                expectFeatureLevel06ContentNotPresent(logicEngine);
+                [[fallthrough]];
+            case EFeatureLevel_06:
                 break;
             }
         }
@@ -536,6 +585,8 @@ namespace rlogic::internal
                 return &m_ramses.loadSceneFromFile("res/unittests/testScene_04.ramses");
             case EFeatureLevel_05:
                 return &m_ramses.loadSceneFromFile("res/unittests/testScene_05.ramses");
+            case EFeatureLevel_06:
+                return &m_ramses.loadSceneFromFile("res/unittests/testScene_06.ramses");
             }
             return nullptr;
         }
@@ -622,4 +673,20 @@ namespace rlogic::internal
         checkContents(logicEngine, *scene);
         saveAndReloadAndCheckContents(logicEngine, *scene);
     }
+
+    TEST_F(ALogicEngine_Binary_Compatibility, CanLoadAndUpdateABinaryFileExportedWithLastCompatibleVersionOfEngine_FeatureLevel06)
+    {
+        EFeatureLevel featureLevel = EFeatureLevel_01;
+        EXPECT_TRUE(LogicEngine::GetFeatureLevelFromFile("res/unittests/testLogic_06.rlogic", featureLevel));
+        EXPECT_EQ(EFeatureLevel_06, featureLevel);
+
+        ramses::Scene* scene = loadRamsesScene(EFeatureLevel_06);
+        ASSERT_TRUE(scene);
+        LogicEngine logicEngine{ EFeatureLevel_06 };
+        ASSERT_TRUE(logicEngine.loadFromFile("res/unittests/testLogic_06.rlogic", scene));
+        EXPECT_TRUE(logicEngine.update());
+
+        checkContents(logicEngine, *scene);
+        saveAndReloadAndCheckContents(logicEngine, *scene);
+    }
 }
@@ -13,6 +13,7 @@
 #include "ramses-logic/RamsesCameraBinding.h"
 #include "ramses-logic/RamsesRenderPassBinding.h"
 #include "ramses-logic/LuaModule.h"
+#include "ramses-logic/TimerNode.h"
 #include "ramses-logic/AnimationNodeConfig.h"
 
 #include "ramses-client-api/DataFloat.h"
@@ -170,6 +171,128 @@ namespace rlogic
         EXPECT_TRUE(m_logicEngine.destroy(*module));
     }
 
+    TEST_P(ALogicEngine_Factory, DestroysMultipleObjectsAtOnce)
+    {
+        constexpr std::string_view scriptSrc = R"(
+            function interface(IN,OUT)
+                IN.value = Type:Float()
+                OUT.value = Type:Float()
+            end
+            function run(IN,OUT)
+                OUT.value = IN.value
+            end
+        )";
+        LuaScript* script1 = m_logicEngine.createLuaScript(scriptSrc, {}, "script1");
+        LuaScript* script2 = m_logicEngine.createLuaScript(scriptSrc, {}, "script2");
+        LuaScript* script3 = m_logicEngine.createLuaScript(scriptSrc, {}, "script3");
+        RamsesNodeBinding* nodeBinding = m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "nodeBinding");
+        ASSERT_TRUE(script1 && script2 && script3 && nodeBinding);
+        ASSERT_TRUE(m_logicEngine.link(*script1->getOutputs()->getChild("value"), *script2->getInputs()->getChild("value")));
+        ASSERT_TRUE(m_logicEngine.link(*script2->getOutputs()->getChild("value"), *script3->getInputs()->getChild("value")));
+        EXPECT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(m_logicEngine.destroy({ script1, script2, nodeBinding }));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_FALSE(m_logicEngine.findByName<LuaScript>("script1"));
+        EXPECT_FALSE(m_logicEngine.findByName<LuaScript>("script2"));
+        EXPECT_FALSE(m_logicEngine.findByName<RamsesNodeBinding>("nodeBinding"));
+        EXPECT_EQ(script3, m_logicEngine.findByName<LuaScript>("script3"));
+        EXPECT_FALSE(m_logicEngine.isLinked(*script3));
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_P(ALogicEngine_Factory, DestroysLuaModuleTogetherWithScriptUsingIt)
+    {
+        LuaModule* module = m_logicEngine.createLuaModule(m_moduleSourceCode, {}, "mymodule");
+        ASSERT_NE(nullptr, module);
+
+        constexpr std::string_view valid_empty_script = R"(
+            modules("mymodule")
+            function interface(IN,OUT)
+            end
+            function run(IN,OUT)
+            end
+        )";
+        LuaScript* script = m_logicEngine.createLuaScript(valid_empty_script, CreateDeps({ { "mymodule", module } }), "script");
+        ASSERT_NE(nullptr, script);
+
+        EXPECT_TRUE(m_logicEngine.destroy({ module, script }));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_FALSE(m_logicEngine.findByName<LuaModule>("mymodule"));
+        EXPECT_FALSE(m_logicEngine.findByName<LuaScript>("script"));
+    }
+
+    TEST_P(ALogicEngine_Factory, DestroysNothingIfAnyOfMultipleObjectsCannotBeDestroyed)
+    {
+        LuaModule* module = m_logicEngine.createLuaModule(m_moduleSourceCode, {}, "mymodule");
+        ASSERT_NE(nullptr, module);
+
+        constexpr std::string_view valid_empty_script = R"(
+            modules("mymodule")
+            function interface(IN,OUT)
+            end
+            function run(IN,OUT)
+            end
+        )";
+        LuaScript* script1 = m_logicEngine.createLuaScript(valid_empty_script, CreateDeps({ { "mymodule", module } }), "script1");
+        LuaScript* script2 = m_logicEngine.createLuaScript(valid_empty_script, CreateDeps({ { "mymodule", module } }), "script2");
+        ASSERT_TRUE(script1 && script2);
+
+        EXPECT_FALSE(m_logicEngine.destroy({ script1, module }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(m_logicEngine.getErrors().front().message, "Failed to destroy LuaModule 'mymodule', it is used in LuaScript 'script2'");
+        EXPECT_EQ(module, m_logicEngine.findByName<LuaModule>("mymodule"));
+        EXPECT_EQ(script1, m_logicEngine.findByName<LuaScript>("script1"));
+
+        LogicEngine otherLogic;
+        LuaScript* otherScript = otherLogic.createLuaScript(m_valid_empty_script);
+        ASSERT_NE(nullptr, otherScript);
+        EXPECT_FALSE(m_logicEngine.destroy({ script1, otherScript }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(m_logicEngine.getErrors().front().message, "Can't find script in logic engine!");
+        EXPECT_EQ(script1, m_logicEngine.findByName<LuaScript>("script1"));
+
+        EXPECT_FALSE(m_logicEngine.destroy({ script1, nullptr }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(m_logicEngine.getErrors().front().message, "Tried to destroy null object");
+        EXPECT_EQ(script1, m_logicEngine.findByName<LuaScript>("script1"));
+    }
+
+    TEST_P(ALogicEngine_Factory, CreatesObjectsAfterReservingStorage)
+    {
+        LuaScript* script = m_logicEngine.createLuaScript(m_valid_empty_script, {}, "script");
+        ASSERT_NE(nullptr, script);
+
+        m_logicEngine.reserve(10u);
+        std::vector<TimerNode*> timers;
+        for (size_t i = 0u; i < 20u; ++i)
+        {
+            timers.push_back(m_logicEngine.createTimerNode(fmt::format("timer{}", i)));
+            ASSERT_NE(nullptr, timers.back());
+        }
+        // reserving less than existing objects has no effect
+        m_logicEngine.reserve(5u);
+
+        EXPECT_EQ(script, m_logicEngine.findByName<LuaScript>("script"));
+        for (size_t i = 0u; i < timers.size(); ++i)
+            EXPECT_EQ(timers[i], m_logicEngine.findByName<TimerNode>(fmt::format("timer{}", i)));
+        EXPECT_EQ(21u, m_logicEngine.getCollection<LogicObject>().size());
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_P(ALogicEngine_Factory, DestroysObjectListedMultipleTimesOnlyOnce)
+    {
+        LuaScript* script = m_logicEngine.createLuaScript(m_valid_empty_script, {}, "script");
+        TimerNode* timer = m_logicEngine.createTimerNode("timer");
+        ASSERT_TRUE(script && timer);
+
+        EXPECT_TRUE(m_logicEngine.destroy({ script, timer, script }));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_FALSE(m_logicEngine.findByName<LuaScript>("script"));
+        EXPECT_FALSE(m_logicEngine.findByName<TimerNode>("timer"));
+        EXPECT_TRUE(m_logicEngine.destroy(std::vector<LogicObject*>{}));
+    }
+
     TEST_P(ALogicEngine_Factory, ProducesErrorWhenCreatingLuaScriptUsingModuleFromAnotherLogicInstance)
     {
         LogicEngine other;
@@ -186,6 +186,31 @@ namespace rlogic
         EXPECT_TRUE(m_logicEngine.link(m_sourceProperty, m_targetProperty));
     }
 
+    TEST_P(ALogicEngine_Linking, ProvidesPropertyLinksUpToDateAfterLinking_UnlinkingAndDestroyingNodes)
+    {
+        EXPECT_TRUE(m_logicEngine.getPropertyLinks().empty());
+
+        ASSERT_TRUE(m_logicEngine.link(m_sourceProperty, m_targetProperty));
+        ASSERT_EQ(1u, m_logicEngine.getPropertyLinks().size());
+        EXPECT_EQ(&m_sourceProperty, m_logicEngine.getPropertyLinks()[0].source);
+        EXPECT_EQ(&m_targetProperty, m_logicEngine.getPropertyLinks()[0].target);
+
+        // unchanged links are provided in the same container
+        const std::vector<PropertyLink>* links = &m_logicEngine.getPropertyLinks();
+        EXPECT_EQ(links, &m_logicEngine.getPropertyLinks());
+        EXPECT_EQ(1u, links->size());
+
+        ASSERT_TRUE(m_logicEngine.unlink(m_sourceProperty, m_targetProperty));
+        EXPECT_TRUE(m_logicEngine.getPropertyLinks().empty());
+
+        ASSERT_TRUE(m_logicEngine.linkWeak(m_sourceProperty, m_targetProperty));
+        ASSERT_EQ(1u, m_logicEngine.getPropertyLinks().size());
+        EXPECT_TRUE(m_logicEngine.getPropertyLinks()[0].isWeakLink);
+
+        ASSERT_TRUE(m_logicEngine.destroy(m_sourceScript));
+        EXPECT_TRUE(m_logicEngine.getPropertyLinks().empty());
+    }
+
     TEST_P(ALogicEngine_Linking, ProducesErrorIfPropertyIsLinkedTwiceToSameProperty_LuaScript)
     {
         EXPECT_TRUE(m_logicEngine.link(m_sourceProperty, m_targetProperty));
@@ -466,6 +466,58 @@ namespace rlogic
         EXPECT_EQ(nullptr, m_logicEngine.findByName<RamsesNodeBinding>("nodebindinY"));
     }
 
+    TEST_F(ALogicEngine_Lookup, FindsFirstCreatedObjectIfMultipleObjectsHaveSameName)
+    {
+        TimerNode* timer1 = m_logicEngine.createTimerNode("name");
+        LuaScript* script1 = m_logicEngine.createLuaScript(m_valid_empty_script, {}, "name");
+        TimerNode* timer2 = m_logicEngine.createTimerNode("name");
+        LuaScript* script2 = m_logicEngine.createLuaScript(m_valid_empty_script, {}, "other");
+
+        EXPECT_EQ(timer1, m_logicEngine.findByName<TimerNode>("name"));
+        EXPECT_EQ(script1, m_logicEngine.findByName<LuaScript>("name"));
+        EXPECT_EQ(timer1, m_logicEngine.findByName<LogicObject>("name"));
+
+        // renamed object does not lose its precedence given by creation order
+        EXPECT_TRUE(timer1->setName("renamed"));
+        EXPECT_TRUE(script2->setName("name"));
+        EXPECT_EQ(timer2, m_logicEngine.findByName<TimerNode>("name"));
+        EXPECT_EQ(script1, m_logicEngine.findByName<LuaScript>("name"));
+        EXPECT_EQ(script1, m_logicEngine.findByName<LogicObject>("name"));
+        EXPECT_TRUE(timer1->setName("name"));
+        EXPECT_EQ(timer1, m_logicEngine.findByName<TimerNode>("name"));
+        EXPECT_EQ(timer1, m_logicEngine.findByName<LogicObject>("name"));
+        EXPECT_EQ(nullptr, m_logicEngine.findByName<LogicObject>("renamed"));
+        EXPECT_EQ(nullptr, m_logicEngine.findByName<LuaScript>("other"));
+
+        ASSERT_TRUE(m_logicEngine.destroy(*timer1));
+        EXPECT_EQ(timer2, m_logicEngine.findByName<TimerNode>("name"));
+        EXPECT_EQ(script1, m_logicEngine.findByName<LogicObject>("name"));
+
+        ASSERT_TRUE(m_logicEngine.destroy({ script1, timer2 }));
+        EXPECT_EQ(nullptr, m_logicEngine.findByName<TimerNode>("name"));
+        EXPECT_EQ(script2, m_logicEngine.findByName<LuaScript>("name"));
+        EXPECT_EQ(script2, m_logicEngine.findByName<LogicObject>("name"));
+    }
+
+    TEST_F(ALogicEngine_Lookup, FindsObjectsByNameAfterLoading)
+    {
+        m_logicEngine.createTimerNode("timer");
+        m_logicEngine.createLuaScript(m_valid_empty_script, {}, "script");
+        std::vector<uint8_t> buffer;
+        ASSERT_TRUE(m_logicEngine.saveToBuffer(buffer, m_saveFileConfigNoValidation));
+
+        LogicEngine loadedEngine{ m_logicEngine.getFeatureLevel() };
+        ASSERT_TRUE(loadedEngine.loadFromBuffer(buffer.data(), buffer.size(), m_scene));
+        TimerNode* timer = loadedEngine.findByName<TimerNode>("timer");
+        ASSERT_NE(nullptr, timer);
+        EXPECT_EQ(timer, loadedEngine.findByName<LogicObject>("timer"));
+        EXPECT_NE(nullptr, loadedEngine.findByName<LuaScript>("script"));
+
+        EXPECT_TRUE(timer->setName("renamed"));
+        EXPECT_EQ(timer, loadedEngine.findByName<TimerNode>("renamed"));
+        EXPECT_EQ(nullptr, loadedEngine.findByName<TimerNode>("timer"));
+    }
+
     TEST_F(ALogicEngine_Lookup, GetHLObjectFromImpl)
     {
         const auto module = m_logicEngine.createLuaModule(m_moduleSourceCode, {}, "luaModule");
@@ -0,0 +1,274 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "ramses-logic/Property.h"
+
+#include "fmt/format.h"
+
+#include <unordered_set>
+
+namespace rlogic
+{
+    class ALogicEngine_Packages : public ALogicEngineBase, public ::testing::Test
+    {
+    public:
+        ALogicEngine_Packages()
+            : ALogicEngineBase{ EFeatureLevel_Latest }
+        {
+        }
+
+    protected:
+        // package with module, script using it and another script linked to it
+        std::vector<uint8_t> createPackageData()
+        {
+            LogicEngine logicEngine{ EFeatureLevel_Latest };
+            const auto* module = logicEngine.createLuaModule(R"(
+                local mymath = {}
+                function mymath.double(a)
+                    return a * 2
+                end
+                return mymath
+            )", {}, "mymath");
+            const auto* source = logicEngine.createLuaScript(R"(
+                modules("mymath")
+                function interface(IN,OUT)
+                    IN.value = Type:Int32()
+                    OUT.value = Type:Int32()
+                end
+                function run(IN,OUT)
+                    OUT.value = mymath.double(IN.value)
+                end
+            )", CreateDeps({ { "mymath", module } }), "source");
+            const auto* target = logicEngine.createLuaScript(R"(
+                function interface(IN,OUT)
+                    IN.value = Type:Int32()
+                    OUT.value = Type:Int32()
+                end
+                function run(IN,OUT)
+                    OUT.value = IN.value + 1
+                end
+            )", {}, "target");
+            EXPECT_TRUE(logicEngine.link(*source->getOutputs()->getChild("value"), *target->getInputs()->getChild("value")));
+
+            std::vector<uint8_t> buffer;
+            EXPECT_TRUE(logicEngine.saveToBuffer(buffer, m_saveFileConfigNoValidation));
+            return buffer;
+        }
+
+        std::vector<LuaScript*> getScriptsNamed(std::string_view name)
+        {
+            std::vector<LuaScript*> scripts;
+            for (auto* script : m_logicEngine.getCollection<LuaScript>())
+            {
+                if (script->getName() == name)
+                    scripts.push_back(script);
+            }
+            return scripts;
+        }
+    };
+
+    TEST_F(ALogicEngine_Packages, LoadsPackageInAdditionToExistingObjects)
+    {
+        auto* existingScript = m_logicEngine.createLuaScript(m_valid_empty_script, {}, "existing");
+        const uint64_t existingId = existingScript->getId();
+
+        const std::vector<uint8_t> data = createPackageData();
+        const auto packageId = m_logicEngine.loadPackageFromBuffer(data.data(), data.size());
+        ASSERT_TRUE(packageId);
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        EXPECT_EQ(existingScript, m_logicEngine.findLogicObjectById(existingId));
+        EXPECT_EQ(3u, m_logicEngine.getCollection<LuaScript>().size());
+        EXPECT_EQ(1u, m_logicEngine.getCollection<LuaModule>().size());
+
+        // loaded objects get IDs following the existing ones
+        for (const auto* obj : m_logicEngine.getCollection<LogicObject>())
+        {
+            if (obj != existingScript)
+                EXPECT_GT(obj->getId(), existingId);
+        }
+    }
+
+    TEST_F(ALogicEngine_Packages, LoadsSamePackageMultipleTimesWithUniqueIdsAndWorkingLinks)
+    {
+        const std::vector<uint8_t> data = createPackageData();
+        const auto package1 = m_logicEngine.loadPackageFromBuffer(data.data(), data.size());
+        const auto package2 = m_logicEngine.loadPackageFromBuffer(data.data(), data.size());
+        ASSERT_TRUE(package1);
+        ASSERT_TRUE(package2);
+        EXPECT_NE(*package1, *package2);
+
+        std::unordered_set<uint64_t> ids;
+        for (const auto* obj : m_logicEngine.getCollection<LogicObject>())
+        {
+            EXPECT_TRUE(ids.insert(obj->getId()).second);
+            EXPECT_EQ(obj, m_logicEngine.findLogicObjectById(obj->getId()));
+        }
+
+        const auto sources = getScriptsNamed("source");
+        const auto targets = getScriptsNamed("target");
+        ASSERT_EQ(2u, sources.size());
+        ASSERT_EQ(2u, targets.size());
+        EXPECT_TRUE(sources[0]->getInputs()->getChild("value")->set(1));
+        EXPECT_TRUE(sources[1]->getInputs()->getChild("value")->set(10));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(3, *targets[0]->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(21, *targets[1]->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_Packages, KeepsExecutionOrderOfExistingObjectsWhenLoadingPackage)
+    {
+        const std::vector<uint8_t> data = createPackageData();
+        ASSERT_TRUE(m_logicEngine.loadPackageFromBuffer(data.data(), data.size()));
+        EXPECT_TRUE(m_logicEngine.update());
+
+        ASSERT_TRUE(m_logicEngine.loadPackageFromBuffer(data.data(), data.size()));
+        m_logicEngine.enableUpdateReport(true);
+        EXPECT_TRUE(m_logicEngine.update());
+
+        // nodes of second package are executed after nodes of first package, linked nodes in their order
+        const auto& executed = m_logicEngine.getLastUpdateReport().getNodesExecuted();
+        const auto sources = getScriptsNamed("source");
+        const auto targets = getScriptsNamed("target");
+        ASSERT_EQ(2u, sources.size());
+        ASSERT_EQ(2u, targets.size());
+        ASSERT_EQ(2u, executed.size());
+        EXPECT_EQ(sources[1], executed[0].first);
+        EXPECT_EQ(targets[1], executed[1].first);
+    }
+
+    TEST_F(ALogicEngine_Packages, SharesIdenticalLuaModulesAmongPackages)
+    {
+        const std::vector<uint8_t> data = createPackageData();
+        const auto package1 = m_logicEngine.loadPackageFromBuffer(data.data(), data.size());
+        const auto package2 = m_logicEngine.loadPackageFromBuffer(data.data(), data.size());
+        ASSERT_TRUE(package1);
+        ASSERT_TRUE(package2);
+
+        ASSERT_EQ(1u, m_logicEngine.getCollection<LuaModule>().size());
+        const LuaModule* module = *m_logicEngine.getCollection<LuaModule>().begin();
+
+        // module stays as long as any package using it is loaded
+        EXPECT_TRUE(m_logicEngine.unloadPackage(*package1));
+        ASSERT_EQ(1u, m_logicEngine.getCollection<LuaModule>().size());
+        EXPECT_EQ(module, *m_logicEngine.getCollection<LuaModule>().begin());
+
+        const auto sources = getScriptsNamed("source");
+        ASSERT_EQ(1u, sources.size());
+        EXPECT_TRUE(sources[0]->getInputs()->getChild("value")->set(4));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(8, *sources[0]->getOutputs()->getChild("value")->get<int32_t>());
+
+        EXPECT_TRUE(m_logicEngine.unloadPackage(*package2));
+        EXPECT_EQ(0u, m_logicEngine.getCollection<LogicObject>().size());
+    }
+
+    TEST_F(ALogicEngine_Packages, DoesNotShareLuaModuleWithDifferentCode)
+    {
+        m_logicEngine.createLuaModule(m_moduleSourceCode, {}, "mymath");
+
+        const std::vector<uint8_t> data = createPackageData();
+        ASSERT_TRUE(m_logicEngine.loadPackageFromBuffer(data.data(), data.size()));
+        EXPECT_EQ(2u, m_logicEngine.getCollection<LuaModule>().size());
+    }
+
+    TEST_F(ALogicEngine_Packages, UnloadsOnlyObjectsOfGivenPackage)
+    {
+        auto* existingScript = m_logicEngine.createLuaScript(m_valid_empty_script, {}, "existing");
+        const std::vector<uint8_t> data = createPackageData();
+        const auto package1 = m_logicEngine.loadPackageFromBuffer(data.data(), data.size());
+        const auto package2 = m_logicEngine.loadPackageFromBuffer(data.data(), data.size());
+        ASSERT_TRUE(package1);
+        ASSERT_TRUE(package2);
+        const auto sourcesBefore = getScriptsNamed("source");
+        ASSERT_EQ(2u, sourcesBefore.size());
+
+        EXPECT_TRUE(m_logicEngine.unloadPackage(*package2));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        EXPECT_EQ(3u, m_logicEngine.getCollection<LuaScript>().size());
+        EXPECT_EQ(existingScript, m_logicEngine.findByName<LuaScript>("existing"));
+        EXPECT_EQ(std::vector<LuaScript*>{ sourcesBefore[0] }, getScriptsNamed("source"));
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ALogicEngine_Packages, SkipsObjectsDestroyedBeforeUnloadingPackage)
+    {
+        const std::vector<uint8_t> data = createPackageData();
+        const auto packageId = m_logicEngine.loadPackageFromBuffer(data.data(), data.size());
+        ASSERT_TRUE(packageId);
+
+        ASSERT_TRUE(m_logicEngine.destroy(*m_logicEngine.findByName<LuaScript>("target")));
+        EXPECT_TRUE(m_logicEngine.unloadPackage(*packageId));
+        EXPECT_EQ(0u, m_logicEngine.getCollection<LogicObject>().size());
+    }
+
+    TEST_F(ALogicEngine_Packages, FailsToUnloadUnknownPackage)
+    {
+        const std::vector<uint8_t> data = createPackageData();
+        const auto packageId = m_logicEngine.loadPackageFromBuffer(data.data(), data.size());
+        ASSERT_TRUE(packageId);
+        EXPECT_TRUE(m_logicEngine.unloadPackage(*packageId));
+
+        EXPECT_FALSE(m_logicEngine.unloadPackage(*packageId));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(fmt::format("Cannot unload package with id={}, no such package was loaded!", *packageId), m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_Packages, LeavesExistingObjectsUntouchedIfPackageFailsToLoad)
+    {
+        auto* existingScript = m_logicEngine.createLuaScript(m_valid_empty_script, {}, "existing");
+
+        // Lua objects are loaded before bindings which fail because their Ramses objects are not in provided scene
+        std::vector<uint8_t> data;
+        {
+            LogicEngine logicEngine{ EFeatureLevel_Latest };
+            logicEngine.createLuaModule(m_moduleSourceCode, {}, "module");
+            logicEngine.createLuaScript(m_valid_empty_script, {}, "script");
+            logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "binding");
+            ASSERT_TRUE(logicEngine.saveToBuffer(data, m_saveFileConfigNoValidation));
+        }
+
+        ramses::Scene* otherScene = m_ramses.createScene(ramses::sceneId_t{ 2u });
+        EXPECT_FALSE(m_logicEngine.loadPackageFromBuffer(data.data(), data.size(), otherScene));
+        EXPECT_FALSE(m_logicEngine.getErrors().empty());
+
+        ASSERT_EQ(1u, m_logicEngine.getCollection<LogicObject>().size());
+        EXPECT_EQ(existingScript, *m_logicEngine.getCollection<LogicObject>().begin());
+        EXPECT_TRUE(m_logicEngine.update());
+
+        // IDs reserved for the failed package are released
+        const auto* createdScript = m_logicEngine.createLuaScript(m_valid_empty_script, {}, "created");
+        ASSERT_NE(nullptr, createdScript);
+        EXPECT_EQ(existingScript->getId() + 1u, createdScript->getId());
+
+        // succeeds with scene
+        EXPECT_TRUE(m_logicEngine.loadPackageFromBuffer(data.data(), data.size(), m_scene));
+        EXPECT_EQ(5u, m_logicEngine.getCollection<LogicObject>().size());
+    }
+
+    TEST_F(ALogicEngine_Packages, LoadsPackageFromFile)
+    {
+        const std::vector<uint8_t> data = createPackageData();
+        {
+            LogicEngine logicEngine{ EFeatureLevel_Latest };
+            ASSERT_TRUE(logicEngine.loadFromBuffer(data.data(), data.size()));
+            ASSERT_TRUE(SaveToFileWithoutValidation(logicEngine, "package.rlogic"));
+        }
+
+        const auto packageId = m_logicEngine.loadPackageFromFile("package.rlogic");
+        ASSERT_TRUE(packageId);
+        EXPECT_EQ(2u, m_logicEngine.getCollection<LuaScript>().size());
+
+        EXPECT_FALSE(m_logicEngine.loadPackageFromFile("doesNotExist.rlogic"));
+        EXPECT_FALSE(m_logicEngine.getErrors().empty());
+        EXPECT_EQ(2u, m_logicEngine.getCollection<LuaScript>().size());
+    }
+}
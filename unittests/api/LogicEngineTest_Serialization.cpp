@@ -25,6 +25,7 @@
 #include "ramses-logic/LuaInterface.h"
 #include "ramses-logic/Logger.h"
 #include "ramses-logic/RamsesLogicVersion.h"
+#include "ramses-logic/EFileCompression.h"
 
 #include "ramses-client-api/EffectDescription.h"
 #include "ramses-client-api/Effect.h"
@@ -36,6 +37,7 @@
 
 #include "impl/LogicNodeImpl.h"
 #include "impl/LogicEngineImpl.h"
+#include "impl/LuaScriptImpl.h"
 #include "impl/DataArrayImpl.h"
 #include "impl/PropertyImpl.h"
 #include "internals/ApiObjects.h"
@@ -47,6 +49,7 @@
 #include "ramses-logic-build-config.h"
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <fstream>
 #include <deque>
 
@@ -237,6 +240,7 @@ namespace rlogic::internal
         const int fd = FileDescriptorHelper::OpenFileDescriptorBinary("LogicEngine.bin");
         EXPECT_LT(0, fd);
         EXPECT_TRUE(m_logicEngine.loadFromFileDescriptor(fd, 0, bufferData.size()));
+        EXPECT_EQ(0, ::close(fd));
     }
 
     TEST_P(ALogicEngine_Serialization, LoadFromFileDescriptorWithOffset)
@@ -248,6 +252,33 @@ namespace rlogic::internal
         const int fd = FileDescriptorHelper::OpenFileDescriptorBinary("LogicEngine.bin");
         EXPECT_LT(0, fd);
         EXPECT_TRUE(m_logicEngine.loadFromFileDescriptor(fd, offset, bufferData.size()- offset));
+        EXPECT_EQ(0, ::close(fd));
+    }
+
+    TEST_P(ALogicEngine_Serialization, LoadFromFileDescriptorWithOffsetNotAlignedToPageSizeWithinLargerFile)
+    {
+        const size_t offset = 5003;
+        std::vector<char> bufferData = CreateTestBuffer();
+        const size_t dataSize = bufferData.size();
+        bufferData.insert(bufferData.begin(), offset, 'x');
+        bufferData.insert(bufferData.end(), offset, 'y');
+        SaveBufferToFile(bufferData, "LogicEngine.bin");
+        const int fd = FileDescriptorHelper::OpenFileDescriptorBinary("LogicEngine.bin");
+        EXPECT_LT(0, fd);
+        EXPECT_TRUE(m_logicEngine.loadFromFileDescriptor(fd, offset, dataSize));
+        EXPECT_EQ(0, ::close(fd));
+    }
+
+    TEST_P(ALogicEngine_Serialization, LoadFromFileDescriptorLeavesDescriptorOpen)
+    {
+        std::vector<char> bufferData = CreateTestBuffer();
+        SaveBufferToFile(bufferData, "LogicEngine.bin");
+        const int fd = FileDescriptorHelper::OpenFileDescriptorBinary("LogicEngine.bin");
+        EXPECT_LT(0, fd);
+        EXPECT_TRUE(m_logicEngine.loadFromFileDescriptor(fd, 0, bufferData.size()));
+        // descriptor can be used again and closed by caller
+        EXPECT_TRUE(m_logicEngine.loadFromFileDescriptor(fd, 0, bufferData.size()));
+        EXPECT_EQ(0, ::close(fd));
     }
 
     TEST_P(ALogicEngine_Serialization, LoadFromFileDescriptor_InvalidFileDescriptor)
@@ -270,6 +301,7 @@ namespace rlogic::internal
         EXPECT_FALSE(m_logicEngine.loadFromFileDescriptor(fd, bufferData.size(), bufferData.size()));
         EXPECT_EQ(fmt::format("Failed to load from file descriptor: fd: {} offset: {} size: {}", fd, bufferData.size(), bufferData.size()),
             m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(0, ::close(fd));
     }
 
     TEST_P(ALogicEngine_Serialization, LoadFromFileDescriptor_InvalidSize)
@@ -280,6 +312,7 @@ namespace rlogic::internal
         EXPECT_FALSE(m_logicEngine.loadFromFileDescriptor(fd, 0, bufferData.size() + 1));
         EXPECT_EQ(fmt::format("Failed to load from file descriptor: fd: {} offset: {} size: {}", fd, 0, bufferData.size() + 1),
             m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(0, ::close(fd));
     }
 
     TEST_P(ALogicEngine_Serialization, DeserializesFromMemoryBuffer)
@@ -324,6 +357,223 @@ namespace rlogic::internal
         }
     }
 
+    TEST_P(ALogicEngine_Serialization, DeserializesSameDataRepeatedlyWithVerificationCache)
+    {
+        const std::vector<char> bufferData = CreateTestBuffer();
+        m_logicEngine.enableVerificationCache(true);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            ASSERT_TRUE(m_logicEngine.loadFromBuffer(bufferData.data(), bufferData.size()));
+            EXPECT_TRUE(m_logicEngine.getErrors().empty());
+            EXPECT_NE(nullptr, m_logicEngine.findByName<LuaScript>("luascript"));
+        }
+    }
+
+    TEST_P(ALogicEngine_Serialization, ProducesErrorIfDeserializedFromCorruptedDataWithVerificationCache)
+    {
+        const std::vector<char> bufferData = CreateTestBuffer();
+        std::vector<char> corruptedData = bufferData;
+        // same corruption as in ProducesErrorIfDeserializedFromCorruptedData
+        ASSERT_GT(corruptedData.size(), 62u);
+        corruptedData[62] = 42;
+
+        m_logicEngine.enableVerificationCache(true);
+        ASSERT_TRUE(m_logicEngine.loadFromBuffer(bufferData.data(), bufferData.size()));
+
+        // data with same size but different content is verified
+        EXPECT_FALSE(m_logicEngine.loadFromBuffer(corruptedData.data(), corruptedData.size()));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, ::testing::HasSubstr("contains corrupted data!"));
+
+        // corrupted data is not cached
+        EXPECT_FALSE(m_logicEngine.loadFromBuffer(corruptedData.data(), corruptedData.size()));
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, ::testing::HasSubstr("contains corrupted data!"));
+
+        EXPECT_TRUE(m_logicEngine.loadFromBuffer(bufferData.data(), bufferData.size()));
+    }
+
+    TEST_P(ALogicEngine_Serialization, ImportsVerificationCacheExportedWithSameKey)
+    {
+        const std::vector<char> bufferData = CreateTestBuffer();
+        const std::array<uint8_t, 16> key{ 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 12u, 13u, 14u, 15u, 16u };
+
+        std::vector<uint8_t> exportedCache;
+        m_logicEngine.enableVerificationCache(true, key);
+        ASSERT_TRUE(m_logicEngine.loadFromBuffer(bufferData.data(), bufferData.size()));
+        ASSERT_TRUE(m_logicEngine.exportVerificationCache(exportedCache));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        // simulates next process which uses the same key
+        LogicEngine otherLogicEngine{ GetParam() };
+        otherLogicEngine.enableVerificationCache(true, key);
+        EXPECT_TRUE(otherLogicEngine.importVerificationCache(exportedCache));
+        EXPECT_TRUE(otherLogicEngine.getErrors().empty());
+        ASSERT_TRUE(otherLogicEngine.loadFromBuffer(bufferData.data(), bufferData.size()));
+        EXPECT_NE(nullptr, otherLogicEngine.findByName<LuaScript>("luascript"));
+
+        // cache exported again contains the imported result
+        std::vector<uint8_t> reexportedCache;
+        ASSERT_TRUE(otherLogicEngine.exportVerificationCache(reexportedCache));
+        EXPECT_EQ(exportedCache, reexportedCache);
+    }
+
+    TEST_P(ALogicEngine_Serialization, FailsToImportVerificationCacheExportedWithDifferentKeyOrCorrupted)
+    {
+        const std::vector<char> bufferData = CreateTestBuffer();
+        std::array<uint8_t, 16> key{ 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 12u, 13u, 14u, 15u, 16u };
+
+        std::vector<uint8_t> exportedCache;
+        m_logicEngine.enableVerificationCache(true, key);
+        ASSERT_TRUE(m_logicEngine.loadFromBuffer(bufferData.data(), bufferData.size()));
+        ASSERT_TRUE(m_logicEngine.exportVerificationCache(exportedCache));
+
+        key[15] = 0u;
+        LogicEngine otherLogicEngine{ GetParam() };
+        otherLogicEngine.enableVerificationCache(true, key);
+        EXPECT_FALSE(otherLogicEngine.importVerificationCache(exportedCache));
+        ASSERT_EQ(1u, otherLogicEngine.getErrors().size());
+        EXPECT_EQ("Cannot import verification cache, data is corrupted or was exported using a different key!", otherLogicEngine.getErrors()[0].message);
+
+        // cache with random key cannot be imported anywhere else either
+        otherLogicEngine.enableVerificationCache(false);
+        otherLogicEngine.enableVerificationCache(true);
+        EXPECT_FALSE(otherLogicEngine.importVerificationCache(exportedCache));
+
+        std::vector<uint8_t> truncatedCache = exportedCache;
+        truncatedCache.pop_back();
+        EXPECT_FALSE(m_logicEngine.importVerificationCache(truncatedCache));
+        EXPECT_FALSE(m_logicEngine.importVerificationCache({}));
+        EXPECT_TRUE(m_logicEngine.importVerificationCache(exportedCache));
+    }
+
+    TEST_P(ALogicEngine_Serialization, FailsToExportOrImportVerificationCacheIfNotEnabled)
+    {
+        std::vector<uint8_t> exportedCache;
+        EXPECT_FALSE(m_logicEngine.exportVerificationCache(exportedCache));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Cannot export verification cache, verification cache is not enabled!", m_logicEngine.getErrors()[0].message);
+
+        m_logicEngine.enableVerificationCache(true);
+        ASSERT_TRUE(m_logicEngine.exportVerificationCache(exportedCache));
+        m_logicEngine.enableVerificationCache(false);
+
+        EXPECT_FALSE(m_logicEngine.importVerificationCache(exportedCache));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Cannot import verification cache, verification cache is not enabled!", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_P(ALogicEngine_Serialization, DeserializesFromCompressedData)
+    {
+        SaveFileConfig config;
+        config.setCompression(EFileCompression::LZ4);
+        const std::vector<char> compressedData = CreateTestBuffer(config);
+        const std::vector<char> uncompressedData = CreateTestBuffer();
+        EXPECT_LT(compressedData.size(), uncompressedData.size());
+
+        // file identifier bytes stay recognizable in compressed data
+        ASSERT_GT(compressedData.size(), 8u);
+        EXPECT_TRUE(std::equal(compressedData.cbegin() + 4, compressedData.cbegin() + 8, uncompressedData.cbegin() + 4));
+
+        // Test with file API
+        SaveBufferToFile(compressedData, "LogicEngine.bin");
+        ASSERT_TRUE(m_logicEngine.loadFromFile("LogicEngine.bin"));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_NE(nullptr, m_logicEngine.findByName<LuaScript>("luascript"));
+        EXPECT_NE(nullptr, m_logicEngine.findByName<LuaScript>("luascript2"));
+
+        // Test with buffer API
+        ASSERT_TRUE(m_logicEngine.loadFromBuffer(compressedData.data(), compressedData.size()));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_NE(nullptr, m_logicEngine.findByName<LuaScript>("luascript"));
+
+        EFeatureLevel detectedFeatureLevel = EFeatureLevel_01;
+        EXPECT_TRUE(LogicEngine::GetFeatureLevelFromFile("LogicEngine.bin", detectedFeatureLevel));
+        EXPECT_EQ(GetParam(), detectedFeatureLevel);
+    }
+
+    TEST_P(ALogicEngine_Serialization, ProducesErrorIfDeserializedFromCorruptedCompressedData)
+    {
+        SaveFileConfig config;
+        config.setCompression(EFileCompression::LZ4);
+        std::vector<char> compressedData = CreateTestBuffer(config);
+        compressedData.pop_back();
+
+        EXPECT_FALSE(m_logicEngine.loadFromBuffer(compressedData.data(), compressedData.size()));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, ::testing::HasSubstr("contains corrupted compressed data!"));
+    }
+
+    TEST_P(ALogicEngine_Serialization, SavesToBufferSameDataAsToFile)
+    {
+        m_logicEngine.createLuaScript(m_valid_empty_script, {}, "script");
+        m_logicEngine.createTimerNode("timer");
+
+        SaveFileConfig config;
+        config.setValidationEnabled(false);
+        for (const auto compression : { EFileCompression::None, EFileCompression::LZ4 })
+        {
+            config.setCompression(compression);
+            ASSERT_TRUE(m_logicEngine.saveToFile("LogicEngine.bin", config));
+            std::vector<uint8_t> buffer;
+            ASSERT_TRUE(m_logicEngine.saveToBuffer(buffer, config));
+            EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+            const std::vector<char> fileData = *FileUtils::LoadBinary("LogicEngine.bin");
+            ASSERT_EQ(fileData.size(), buffer.size());
+            EXPECT_TRUE(std::equal(fileData.cbegin(), fileData.cend(), buffer.cbegin(), [](char a, uint8_t b) { return static_cast<uint8_t>(a) == b; }));
+        }
+    }
+
+    TEST_P(ALogicEngine_Serialization, DeserializesFromDataSavedToBuffer)
+    {
+        std::vector<uint8_t> buffer;
+        {
+            LogicEngine logicEngineForSaving{ GetParam() };
+            logicEngineForSaving.createLuaScript(m_valid_empty_script, {}, "script");
+            SaveFileConfig config;
+            config.setValidationEnabled(false);
+            ASSERT_TRUE(logicEngineForSaving.saveToBuffer(buffer, config));
+        }
+
+        ASSERT_TRUE(m_logicEngine.loadFromBuffer(buffer.data(), buffer.size()));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_NE(nullptr, m_logicEngine.findByName<LuaScript>("script"));
+    }
+
+    TEST_P(ALogicEngine_Serialization, ReplacesContentOfBufferAndReusesItsMemoryWhenSavingToBuffer)
+    {
+        m_logicEngine.createLuaScript(m_valid_empty_script, {}, "script");
+        SaveFileConfig config;
+        config.setValidationEnabled(false);
+
+        std::vector<uint8_t> buffer(100000u, 0xFF);
+        const uint8_t* bufferMemory = buffer.data();
+        ASSERT_TRUE(m_logicEngine.saveToBuffer(buffer, config));
+        EXPECT_LT(buffer.size(), 100000u);
+        EXPECT_EQ(bufferMemory, buffer.data());
+
+        const std::vector<uint8_t> firstSave = buffer;
+        ASSERT_TRUE(m_logicEngine.saveToBuffer(buffer, config));
+        EXPECT_EQ(firstSave, buffer);
+        EXPECT_EQ(bufferMemory, buffer.data());
+    }
+
+    TEST_P(ALogicEngine_Serialization, ProducesErrorAndKeepsBufferUnmodifiedIfSavingToBufferFails)
+    {
+        RamsesTestSetup testSetup;
+        ramses::Scene* scene1 = testSetup.createScene(ramses::sceneId_t(1));
+        ramses::Scene* scene2 = testSetup.createScene(ramses::sceneId_t(2));
+        m_logicEngine.createRamsesNodeBinding(*scene1->createNode("node1"), ERotationType::Euler_XYZ, "binding1");
+        m_logicEngine.createRamsesNodeBinding(*scene2->createNode("node2"), ERotationType::Euler_XYZ, "binding2");
+
+        std::vector<uint8_t> buffer{ 1u, 2u, 3u };
+        EXPECT_FALSE(m_logicEngine.saveToBuffer(buffer));
+        ASSERT_EQ(2u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Can't save a logic engine to file while it has references to more than one Ramses scene!", m_logicEngine.getErrors()[1].message);
+        EXPECT_EQ((std::vector<uint8_t>{ 1u, 2u, 3u }), buffer);
+    }
+
     TEST_P(ALogicEngine_Serialization, PrintsMetadataInfoOnLoad)
     {
         SaveFileConfig config;
@@ -940,6 +1190,176 @@ namespace rlogic::internal
         }
     }
 
+    TEST_P(ALogicEngine_Serialization, LoadsScriptsLazilyAndCompilesThemOnFirstUpdate)
+    {
+        {
+            std::string_view scriptSource = R"(
+                function interface(IN,OUT)
+                    IN.input = Type:Int32()
+                    OUT.output = Type:Int32()
+                end
+                function run(IN,OUT)
+                    OUT.output = IN.input + 1
+                end
+            )";
+
+            LogicEngine logicEngine{ GetParam() };
+            auto sourceScript = logicEngine.createLuaScript(scriptSource, {}, "SourceScript");
+            auto targetScript = logicEngine.createLuaScript(scriptSource, {}, "TargetScript");
+            EXPECT_TRUE(logicEngine.link(*sourceScript->getOutputs()->getChild("output"), *targetScript->getInputs()->getChild("input")));
+
+            ASSERT_TRUE(SaveToFileWithoutValidation(logicEngine, "LogicEngine.bin"));
+        }
+
+        m_logicEngine.enableLazyLuaScriptLoading(true);
+        EXPECT_TRUE(m_logicEngine.loadFromFile("LogicEngine.bin"));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        auto sourceScript = m_logicEngine.findByName<LuaScript>("SourceScript");
+        auto targetScript = m_logicEngine.findByName<LuaScript>("TargetScript");
+        ASSERT_TRUE(sourceScript && targetScript);
+        EXPECT_FALSE(sourceScript->m_script.isCompiled());
+        EXPECT_FALSE(targetScript->m_script.isCompiled());
+        EXPECT_TRUE(m_logicEngine.isLinked(*sourceScript));
+        EXPECT_TRUE(m_logicEngine.isLinked(*targetScript));
+
+        EXPECT_TRUE(sourceScript->getInputs()->getChild("input")->set<int32_t>(41));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(sourceScript->m_script.isCompiled());
+        EXPECT_TRUE(targetScript->m_script.isCompiled());
+        EXPECT_EQ(43, *targetScript->getOutputs()->getChild("output")->get<int32_t>());
+
+        // lazily loaded scripts can be saved and loaded eagerly again
+        ASSERT_TRUE(SaveToFileWithoutValidation(m_logicEngine, "LogicEngine.bin"));
+        m_logicEngine.enableLazyLuaScriptLoading(false);
+        EXPECT_TRUE(m_logicEngine.loadFromFile("LogicEngine.bin"));
+        EXPECT_TRUE(m_logicEngine.findByName<LuaScript>("SourceScript")->m_script.isCompiled());
+    }
+
+    TEST_P(ALogicEngine_Serialization, ParallelLoadingProducesSameObjectsInSameOrderAsSequentialLoading)
+    {
+        saveAndLoadAllTypesOfObjects();
+
+        std::vector<std::pair<std::string, uint64_t>> sequentiallyLoadedObjects;
+        for (const auto* obj : m_logicEngine.getCollection<LogicObject>())
+            sequentiallyLoadedObjects.emplace_back(obj->getName(), obj->getId());
+
+        m_logicEngine.enableParallelLoading(true);
+        EXPECT_TRUE(m_logicEngine.loadFromFile("LogicEngine.bin", m_scene));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        std::vector<std::pair<std::string, uint64_t>> parallelLoadedObjects;
+        for (const auto* obj : m_logicEngine.getCollection<LogicObject>())
+        {
+            parallelLoadedObjects.emplace_back(obj->getName(), obj->getId());
+            EXPECT_EQ(obj, &obj->m_impl->getLogicObject());
+        }
+
+        EXPECT_EQ(sequentiallyLoadedObjects, parallelLoadedObjects);
+    }
+
+    TEST_P(ALogicEngine_Serialization, ParallelLoadingResolvesLinksBetweenScriptsAndObjectsLoadedOnWorkerThread)
+    {
+        {
+            LogicEngine logicEngine{ GetParam() };
+            const auto* dataArray = logicEngine.createDataArray(std::vector<float>{ 0.f, 1.f }, "dataArray");
+            AnimationNodeConfig config;
+            config.addChannel({ "channel", dataArray, dataArray, EInterpolationType::Linear });
+            auto* animNode = logicEngine.createAnimationNode(config, "animNode");
+            auto* script = logicEngine.createLuaScript(R"(
+                function interface(IN,OUT)
+                    IN.value = Type:Float()
+                    OUT.translation = Type:Vec3f()
+                end
+                function run(IN,OUT)
+                    OUT.translation = { IN.value, 2, 3 }
+                end
+            )", {}, "script");
+            auto* nodeBinding = logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "nodeBinding");
+
+            EXPECT_TRUE(logicEngine.link(*animNode->getOutputs()->getChild("channel"), *script->getInputs()->getChild("value")));
+            EXPECT_TRUE(logicEngine.link(*script->getOutputs()->getChild("translation"), *nodeBinding->getInputs()->getChild("translation")));
+            ASSERT_TRUE(SaveToFileWithoutValidation(logicEngine, "LogicEngine.bin"));
+        }
+
+        m_logicEngine.enableParallelLoading(true);
+        EXPECT_TRUE(m_logicEngine.loadFromFile("LogicEngine.bin", m_scene));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        auto* animNode = m_logicEngine.findByName<AnimationNode>("animNode");
+        auto* script = m_logicEngine.findByName<LuaScript>("script");
+        auto* nodeBinding = m_logicEngine.findByName<RamsesNodeBinding>("nodeBinding");
+        ASSERT_TRUE(animNode && script && nodeBinding);
+        PropertyLinkTestUtils::ExpectLinks(m_logicEngine, {
+            { animNode->getOutputs()->getChild("channel"), script->getInputs()->getChild("value"), false },
+            { script->getOutputs()->getChild("translation"), nodeBinding->getInputs()->getChild("translation"), false }
+            });
+
+        EXPECT_TRUE(animNode->getInputs()->getChild("progress")->set(1.f));
+        EXPECT_TRUE(m_logicEngine.update());
+        vec3f translation{ 0.f, 0.f, 0.f };
+        m_node->getTranslation(translation[0], translation[1], translation[2]);
+        const vec3f expectedTranslation{ 1.f, 2.f, 3.f };
+        EXPECT_EQ(expectedTranslation, translation);
+    }
+
+    TEST_P(ALogicEngine_Serialization, ParallelLoadingReportsErrorWhenRamsesSceneMissing)
+    {
+        saveAndLoadAllTypesOfObjects();
+
+        m_logicEngine.enableParallelLoading(true);
+        EXPECT_FALSE(m_logicEngine.loadFromFile("LogicEngine.bin"));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(m_logicEngine.getErrors()[0].message, "Fatal error during loading from file! File contains references to Ramses objects but no Ramses scene was provided!");
+    }
+
+    TEST_P(ALogicEngine_Serialization, ParallelLoadingReportsErrorsOfScriptsAndBindingsInDeterministicOrder)
+    {
+        ramses::Node* nodeToDestroy = m_scene->createNode();
+        const ramses::sceneObjectId_t nodeToDestroyId = nodeToDestroy->getSceneObjectId();
+        {
+            LogicEngine logicEngine{ GetParam() };
+            logicEngine.createLuaScript(R"(
+                function interface(IN,OUT)
+                    IN.value = Type:Int32()
+                end
+                function run(IN,OUT)
+                    -- BREAK
+                end
+            )", {}, "brokenScript");
+            logicEngine.createRamsesNodeBinding(*nodeToDestroy, ERotationType::Euler_XYZ, "nodeBinding");
+
+            SaveFileConfig config;
+            config.setValidationEnabled(false);
+            config.setLuaSavingMode(ELuaSavingMode::SourceCodeOnly);
+            ASSERT_TRUE(logicEngine.saveToFile("LogicEngine.bin", config));
+        }
+        m_scene->destroy(*nodeToDestroy);
+
+        // break the script source in the file so that it fails to compile when loading
+        std::optional<std::vector<char>> fileContents = FileUtils::LoadBinary("LogicEngine.bin");
+        ASSERT_TRUE(fileContents);
+        const std::string_view marker = "-- BREAK";
+        auto markerIt = std::search(fileContents->begin(), fileContents->end(), marker.cbegin(), marker.cend());
+        ASSERT_NE(markerIt, fileContents->end());
+        *markerIt = '+';
+        *(markerIt + 1) = '+';
+        ASSERT_TRUE(FileUtils::SaveBinary("LogicEngine.bin", fileContents->data(), fileContents->size()));
+
+        m_logicEngine.enableLazyLuaScriptLoading(false);
+        m_logicEngine.enableParallelLoading(true);
+        for (size_t i = 0u; i < 10u; ++i)
+        {
+            EXPECT_FALSE(m_logicEngine.loadFromFile("LogicEngine.bin", m_scene));
+            ASSERT_EQ(3u, m_logicEngine.getErrors().size());
+            EXPECT_THAT(m_logicEngine.getErrors()[0].message, ::testing::HasSubstr("[brokenScript] Error while loading script"));
+            EXPECT_EQ(m_logicEngine.getErrors()[1].message, "Fatal error during loading of LuaScript 'brokenScript' from serialized data!");
+            EXPECT_EQ(m_logicEngine.getErrors()[2].message,
+                fmt::format("Fatal error during loading from file! Serialized Ramses Logic object 'nodeBinding' points to a Ramses object (id: {}) which couldn't be found in the provided scene!",
+                    nodeToDestroyId.getValue()));
+        }
+    }
+
     TEST_P(ALogicEngine_Serialization, InternalLinkDataIsDeletedAfterDeserialization)
     {
         std::string_view scriptSource = R"(
@@ -0,0 +1,236 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "ramses-logic/LogicEngineState.h"
+#include "ramses-logic/AnimationNodeConfig.h"
+#include "ramses-logic/Property.h"
+#include "ramses-logic/AnchorPoint.h"
+#include "ramses-logic/RamsesNodeBinding.h"
+#include "ramses-logic/RamsesCameraBinding.h"
+
+#include "ramses-client-api/Node.h"
+#include "ramses-client-api/PerspectiveCamera.h"
+
+#include <array>
+
+namespace rlogic
+{
+    class ALogicEngine_State : public ALogicEngineBase, public ::testing::Test
+    {
+    public:
+        ALogicEngine_State()
+            : ALogicEngineBase{ EFeatureLevel_Latest }
+        {
+        }
+
+    protected:
+        LuaScript* createCounterScript()
+        {
+            return m_logicEngine.createLuaScript(R"(
+                function init()
+                    GLOBAL.counter = 0
+                    GLOBAL.history = { last = 0 }
+                end
+                function interface(IN,OUT)
+                    IN.step = Type:Int32()
+                    OUT.counter = Type:Int32()
+                    OUT.historySize = Type:Int32()
+                end
+                function run(IN,OUT)
+                    GLOBAL.counter = GLOBAL.counter + IN.step
+                    GLOBAL.history.last = IN.step
+                    GLOBAL.history[GLOBAL.counter] = true
+                    OUT.counter = GLOBAL.counter
+                    local size = 0
+                    for _ in pairs(GLOBAL.history) do
+                        size = size + 1
+                    end
+                    OUT.historySize = size
+                end
+            )", {}, "counter");
+        }
+
+        void stepAndUpdate(LuaScript& script, int32_t step)
+        {
+            EXPECT_TRUE(script.getInputs()->getChild("step")->set(step));
+            EXPECT_TRUE(m_logicEngine.update());
+        }
+    };
+
+    TEST_F(ALogicEngine_State, RestoresPropertyValuesAndScriptGlobals)
+    {
+        auto* script = createCounterScript();
+        ASSERT_NE(nullptr, script);
+        stepAndUpdate(*script, 1);
+        EXPECT_EQ(1, *script->getOutputs()->getChild("counter")->get<int32_t>());
+
+        const LogicEngineState state = m_logicEngine.captureState();
+
+        stepAndUpdate(*script, 2);
+        stepAndUpdate(*script, 5);
+        EXPECT_EQ(8, *script->getOutputs()->getChild("counter")->get<int32_t>());
+        EXPECT_EQ(4, *script->getOutputs()->getChild("historySize")->get<int32_t>());
+
+        EXPECT_TRUE(m_logicEngine.restoreState(state));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_EQ(1, *script->getInputs()->getChild("step")->get<int32_t>());
+        EXPECT_EQ(1, *script->getOutputs()->getChild("counter")->get<int32_t>());
+        EXPECT_EQ(2, *script->getOutputs()->getChild("historySize")->get<int32_t>());
+
+        // continues from restored globals, entries added to nested table after capture are removed
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2, *script->getOutputs()->getChild("counter")->get<int32_t>());
+        EXPECT_EQ(3, *script->getOutputs()->getChild("historySize")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_State, CanRestoreSameStateMultipleTimes)
+    {
+        auto* script = createCounterScript();
+        ASSERT_NE(nullptr, script);
+        stepAndUpdate(*script, 3);
+        const LogicEngineState state = m_logicEngine.captureState();
+
+        for (int i = 0; i < 3; ++i)
+        {
+            stepAndUpdate(*script, 10);
+            EXPECT_TRUE(m_logicEngine.restoreState(state));
+            EXPECT_EQ(3, *script->getOutputs()->getChild("counter")->get<int32_t>());
+        }
+    }
+
+    TEST_F(ALogicEngine_State, RestoresDirtyFlags)
+    {
+        auto* script = createCounterScript();
+        ASSERT_NE(nullptr, script);
+        stepAndUpdate(*script, 1);
+
+        m_logicEngine.enableUpdateReport(true);
+        const LogicEngineState cleanState = m_logicEngine.captureState();
+        EXPECT_TRUE(m_logicEngine.restoreState(cleanState));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.getLastUpdateReport().getNodesExecuted().empty());
+
+        EXPECT_TRUE(script->getInputs()->getChild("step")->set(2));
+        const LogicEngineState dirtyState = m_logicEngine.captureState();
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.restoreState(dirtyState));
+        EXPECT_TRUE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getLastUpdateReport().getNodesExecuted().size());
+        EXPECT_EQ(script, m_logicEngine.getLastUpdateReport().getNodesExecuted()[0].first);
+    }
+
+    TEST_F(ALogicEngine_State, RestoresValuesOfBindingsAndAppliesThemToRamsesInNextUpdate)
+    {
+        auto* nodeBinding = m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "nodeBinding");
+        EXPECT_TRUE(nodeBinding->getInputs()->getChild("translation")->set(vec3f{ 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+
+        const LogicEngineState state = m_logicEngine.captureState();
+
+        EXPECT_TRUE(nodeBinding->getInputs()->getChild("translation")->set(vec3f{ 4.f, 5.f, 6.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(m_logicEngine.restoreState(state));
+        EXPECT_TRUE(m_logicEngine.update());
+
+        std::array<float, 3> translation{};
+        m_node->getTranslation(translation[0], translation[1], translation[2]);
+        EXPECT_EQ((std::array<float, 3>{ 1.f, 2.f, 3.f }), translation);
+    }
+
+    TEST_F(ALogicEngine_State, RestoresAnimationPlayback)
+    {
+        const auto timestamps = m_logicEngine.createDataArray(std::vector<float>{ 0.f, 4.f });
+        AnimationNodeConfig config;
+        EXPECT_TRUE(config.addChannel({ "channel", timestamps, timestamps }));
+        config.setPlaybackControlEnabled(true);
+        auto* animNode = m_logicEngine.createAnimationNode(config, "animNode");
+        ASSERT_NE(nullptr, animNode);
+
+        EXPECT_TRUE(animNode->getInputs()->getChild("play")->set(true));
+        EXPECT_TRUE(animNode->getInputs()->getChild("ticker_us")->set(int64_t{ 1000000 }));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(animNode->getInputs()->getChild("ticker_us")->set(int64_t{ 2000000 }));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(1.f, *animNode->getOutputs()->getChild("channel")->get<float>());
+
+        const LogicEngineState state = m_logicEngine.captureState();
+
+        EXPECT_TRUE(animNode->getInputs()->getChild("ticker_us")->set(int64_t{ 3500000 }));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(2.5f, *animNode->getOutputs()->getChild("channel")->get<float>());
+
+        EXPECT_TRUE(m_logicEngine.restoreState(state));
+        EXPECT_FLOAT_EQ(1.f, *animNode->getOutputs()->getChild("channel")->get<float>());
+
+        // playback continues from captured time and ticker
+        EXPECT_TRUE(animNode->getInputs()->getChild("ticker_us")->set(int64_t{ 2500000 }));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(1.5f, *animNode->getOutputs()->getChild("channel")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_State, RecalculatesAnchorPointAfterRestoreEvenIfRamsesStatesMatchLastUpdate)
+    {
+        ramses::PerspectiveCamera* camera = m_scene->createPerspectiveCamera();
+        camera->setFrustum(90.f, 1.f, 0.1f, 100.f);
+        camera->setViewport(0, 0, 100u, 100u);
+        m_node->setTranslation(0.f, 0.f, -10.f);
+        auto* nodeBinding = m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "nodeBinding");
+        auto* cameraBinding = m_logicEngine.createRamsesCameraBinding(*camera, "cameraBinding");
+        auto* anchorPoint = m_logicEngine.createAnchorPoint(*nodeBinding, *cameraBinding, "anchorPoint");
+        ASSERT_NE(nullptr, anchorPoint);
+        const Property* viewportCoords = anchorPoint->getOutputs()->getChild("viewportCoords");
+
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ((vec2f{ 50.f, 50.f }), *viewportCoords->get<vec2f>());
+
+        const LogicEngineState state = m_logicEngine.captureState();
+
+        camera->setViewport(0, 0, 200u, 200u);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ((vec2f{ 100.f, 100.f }), *viewportCoords->get<vec2f>());
+
+        EXPECT_TRUE(m_logicEngine.restoreState(state));
+        EXPECT_EQ((vec2f{ 50.f, 50.f }), *viewportCoords->get<vec2f>());
+
+        // Ramses camera is same as in last update but restored outputs do not correspond to it
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ((vec2f{ 100.f, 100.f }), *viewportCoords->get<vec2f>());
+    }
+
+    TEST_F(ALogicEngine_State, FailsToRestoreIfObjectWasCreatedAfterCapture)
+    {
+        auto* script = createCounterScript();
+        ASSERT_NE(nullptr, script);
+        stepAndUpdate(*script, 1);
+        const LogicEngineState state = m_logicEngine.captureState();
+
+        stepAndUpdate(*script, 2);
+        m_logicEngine.createTimerNode("timer");
+
+        EXPECT_FALSE(m_logicEngine.restoreState(state));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Cannot restore state, logic objects were created or destroyed since the state was captured!", m_logicEngine.getErrors()[0].message);
+        // nothing restored
+        EXPECT_EQ(3, *script->getOutputs()->getChild("counter")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_State, FailsToRestoreIfObjectWasDestroyedAfterCapture)
+    {
+        ASSERT_NE(nullptr, createCounterScript());
+        auto* timer = m_logicEngine.createTimerNode("timer");
+        const LogicEngineState state = m_logicEngine.captureState();
+
+        ASSERT_TRUE(m_logicEngine.destroy(*timer));
+        EXPECT_FALSE(m_logicEngine.restoreState(state));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Cannot restore state, logic objects were created or destroyed since the state was captured!", m_logicEngine.getErrors()[0].message);
+    }
+}
@@ -0,0 +1,161 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/Property.h"
+#include "ramses-logic/TimerNode.h"
+#include "ramses-logic/LogicEngineReport.h"
+
+namespace rlogic
+{
+    class ALogicEngine_Suspension : public ALogicEngine
+    {
+    protected:
+        ALogicEngine_Suspension()
+        {
+            m_logicEngine.enableUpdateReport(true);
+        }
+
+        LuaScript* createPassThroughScript(std::string_view name)
+        {
+            return m_logicEngine.createLuaScript(R"(
+                function interface(IN,OUT)
+                    IN.value = Type:Int32()
+                    OUT.value = Type:Int32()
+                end
+                function run(IN,OUT)
+                    OUT.value = IN.value
+                end
+            )", {}, name);
+        }
+
+        static Property& Input(LuaScript& script)
+        {
+            return *script.getInputs()->getChild("value");
+        }
+
+        static const Property& Output(const LuaScript& script)
+        {
+            return *script.getOutputs()->getChild("value");
+        }
+
+        std::vector<LogicNode*> getExecutedNodes()
+        {
+            std::vector<LogicNode*> executedNodes;
+            for (const auto& nodeTimed : m_logicEngine.getLastUpdateReport().getNodesExecuted())
+                executedNodes.push_back(nodeTimed.first);
+            return executedNodes;
+        }
+    };
+
+    TEST_F(ALogicEngine_Suspension, DoesNotExecuteSuspendedNodesButRemembersTheyAreDirty)
+    {
+        LuaScript* script1 = createPassThroughScript("script1");
+        LuaScript* script2 = createPassThroughScript("script2");
+        TimerNode* timer = m_logicEngine.createTimerNode("timer");
+
+        EXPECT_FALSE(m_logicEngine.isSuspended(*script1));
+        ASSERT_TRUE(m_logicEngine.suspendNodes({ script1, timer }));
+        EXPECT_TRUE(m_logicEngine.isSuspended(*script1));
+        EXPECT_TRUE(m_logicEngine.isSuspended(*timer));
+        EXPECT_FALSE(m_logicEngine.isSuspended(*script2));
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(script2));
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesSkippedExecution(), ::testing::UnorderedElementsAre(script1, timer));
+
+        Input(*script1).set(42);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(getExecutedNodes().empty());
+        EXPECT_EQ(0, *Output(*script1).get<int32_t>());
+
+        ASSERT_TRUE(m_logicEngine.resumeNodes({ script1, timer }));
+        EXPECT_FALSE(m_logicEngine.isSuspended(*script1));
+        EXPECT_FALSE(m_logicEngine.isSuspended(*timer));
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::UnorderedElementsAre(script1, timer));
+        EXPECT_EQ(42, *Output(*script1).get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_Suspension, DefersValuesPropagatedOverLinksIntoSuspendedNodeUntilResumed)
+    {
+        LuaScript* source = createPassThroughScript("source");
+        LuaScript* target = createPassThroughScript("target");
+        ASSERT_TRUE(m_logicEngine.link(Output(*source), Input(*target)));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        ASSERT_TRUE(m_logicEngine.suspendNodes({ target }));
+        Input(*source).set(5);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(source));
+        EXPECT_EQ(0, *Input(*target).get<int32_t>());
+
+        Input(*source).set(7);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(0, *Input(*target).get<int32_t>());
+
+        // latest value is taken over on resume
+        ASSERT_TRUE(m_logicEngine.resumeNodes({ target }));
+        EXPECT_EQ(7, *Input(*target).get<int32_t>());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(target));
+        EXPECT_EQ(7, *Output(*target).get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_Suspension, DoesNotExecuteResumedNodeIfLinkedValuesDidNotChangeWhileSuspended)
+    {
+        LuaScript* source = createPassThroughScript("source");
+        LuaScript* target = createPassThroughScript("target");
+        ASSERT_TRUE(m_logicEngine.link(Output(*source), Input(*target)));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        ASSERT_TRUE(m_logicEngine.suspendNodes({ target }));
+        Input(*source).set(5);
+        ASSERT_TRUE(m_logicEngine.update());
+        Input(*source).set(0);
+        ASSERT_TRUE(m_logicEngine.update());
+
+        ASSERT_TRUE(m_logicEngine.resumeNodes({ target }));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(getExecutedNodes().empty());
+    }
+
+    TEST_F(ALogicEngine_Suspension, IgnoresResumingNodeWhichIsNotSuspended)
+    {
+        LuaScript* script = createPassThroughScript("script");
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(m_logicEngine.resumeNodes({ script }));
+        EXPECT_FALSE(m_logicEngine.isSuspended(*script));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(getExecutedNodes().empty());
+    }
+
+    TEST_F(ALogicEngine_Suspension, FailsToSuspendOrResumeNodesNotBelongingToLogicEngine)
+    {
+        LuaScript* script = createPassThroughScript("script");
+
+        LogicEngine otherLogicEngine{ m_logicEngine.getFeatureLevel() };
+        TimerNode* otherTimer = otherLogicEngine.createTimerNode("timer");
+
+        EXPECT_FALSE(m_logicEngine.suspendNodes({ script, otherTimer }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to suspend nodes: one or more of the provided nodes was not found in this logic instance.", m_logicEngine.getErrors()[0].message);
+        EXPECT_FALSE(m_logicEngine.isSuspended(*script));
+
+        ASSERT_TRUE(m_logicEngine.suspendNodes({ script }));
+        EXPECT_FALSE(m_logicEngine.resumeNodes({ script, nullptr }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to resume nodes: one or more of the provided nodes was not found in this logic instance.", m_logicEngine.getErrors()[0].message);
+        EXPECT_TRUE(m_logicEngine.isSuspended(*script));
+    }
+}
@@ -0,0 +1,314 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/LuaModule.h"
+#include "ramses-logic/Property.h"
+#include "ramses-logic/TimerNode.h"
+#include "ramses-logic/LogicEngineState.h"
+
+namespace rlogic
+{
+    class ALogicEngine_Transactions : public ALogicEngine
+    {
+    protected:
+        LuaScript* createPassThroughScript(std::string_view name)
+        {
+            return m_logicEngine.createLuaScript(R"(
+                function interface(IN,OUT)
+                    IN.value = Type:Int32()
+                    OUT.value = Type:Int32()
+                end
+                function run(IN,OUT)
+                    OUT.value = IN.value
+                end
+            )", {}, name);
+        }
+
+        static const Property& Input(const LuaScript& script)
+        {
+            return *script.getInputs()->getChild("value");
+        }
+
+        static const Property& Output(const LuaScript& script)
+        {
+            return *script.getOutputs()->getChild("value");
+        }
+
+        void expectError(std::string_view message)
+        {
+            ASSERT_FALSE(m_logicEngine.getErrors().empty());
+            EXPECT_EQ(message, m_logicEngine.getErrors().back().message);
+        }
+    };
+
+    TEST_F(ALogicEngine_Transactions, CommitsLinksAndExecutesNodesInLinkOrder)
+    {
+        // created in reverse order of execution
+        LuaScript* script3 = createPassThroughScript("script3");
+        LuaScript* script2 = createPassThroughScript("script2");
+        LuaScript* script1 = createPassThroughScript("script1");
+
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        EXPECT_TRUE(m_logicEngine.link(Output(*script1), Input(*script2)));
+        EXPECT_TRUE(m_logicEngine.link(Output(*script2), Input(*script3)));
+        ASSERT_TRUE(m_logicEngine.commitTransaction());
+
+        EXPECT_TRUE(m_logicEngine.isLinked(*script2));
+        script1->getInputs()->getChild("value")->set<int32_t>(42);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(42, *Output(*script3).get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_Transactions, AllowsLoopWithinTransactionIfResolvedBeforeCommit)
+    {
+        LuaScript* script1 = createPassThroughScript("script1");
+        LuaScript* script2 = createPassThroughScript("script2");
+        ASSERT_TRUE(m_logicEngine.link(Output(*script1), Input(*script2)));
+
+        // reverse direction of link, graph contains loop in between
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        EXPECT_TRUE(m_logicEngine.link(Output(*script2), Input(*script1)));
+        EXPECT_TRUE(m_logicEngine.unlink(Output(*script1), Input(*script2)));
+        ASSERT_TRUE(m_logicEngine.commitTransaction());
+
+        script2->getInputs()->getChild("value")->set<int32_t>(7);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(7, *Output(*script1).get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_Transactions, RollsBackTransactionIfCommitWouldResultInLoop)
+    {
+        LuaScript* script1 = createPassThroughScript("script1");
+        LuaScript* script2 = createPassThroughScript("script2");
+        ASSERT_TRUE(m_logicEngine.link(Output(*script1), Input(*script2)));
+
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        LuaScript* script3 = createPassThroughScript("script3");
+        ASSERT_NE(nullptr, script3);
+        EXPECT_TRUE(m_logicEngine.link(Output(*script2), Input(*script3)));
+        EXPECT_TRUE(m_logicEngine.link(Output(*script2), Input(*script1)));
+        EXPECT_FALSE(m_logicEngine.commitTransaction());
+        expectError("Transaction was rolled back because it would result in a link graph with a loop!");
+
+        // links are restored and object created within transaction is gone
+        EXPECT_TRUE(Input(*script2).isLinked());
+        EXPECT_FALSE(Input(*script1).isLinked());
+        EXPECT_FALSE(Output(*script2).isLinked());
+        EXPECT_EQ(nullptr, m_logicEngine.findByName<LuaScript>("script3"));
+        EXPECT_EQ(2u, m_logicEngine.getCollection<LuaScript>().size());
+
+        script1->getInputs()->getChild("value")->set<int32_t>(3);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(3, *Output(*script2).get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_Transactions, RollsBackTransactionIfAnyLinkOperationFailed)
+    {
+        LuaScript* script1 = createPassThroughScript("script1");
+        LuaScript* script2 = createPassThroughScript("script2");
+
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        EXPECT_TRUE(m_logicEngine.link(Output(*script1), Input(*script2)));
+        // unlinking properties which are not linked fails
+        EXPECT_FALSE(m_logicEngine.unlink(Output(*script2), Input(*script1)));
+        EXPECT_FALSE(m_logicEngine.commitTransaction());
+        expectError("Transaction was rolled back because some of its operations failed!");
+
+        EXPECT_FALSE(m_logicEngine.isLinked(*script1));
+        EXPECT_FALSE(m_logicEngine.isLinked(*script2));
+    }
+
+    TEST_F(ALogicEngine_Transactions, RestoresWeakLinkRemovedWithinRolledBackTransaction)
+    {
+        LuaScript* script1 = createPassThroughScript("script1");
+        LuaScript* script2 = createPassThroughScript("script2");
+        ASSERT_TRUE(m_logicEngine.link(Output(*script1), Input(*script2)));
+        ASSERT_TRUE(m_logicEngine.linkWeak(Output(*script2), Input(*script1)));
+
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        EXPECT_TRUE(m_logicEngine.unlink(Output(*script2), Input(*script1)));
+        EXPECT_TRUE(m_logicEngine.unlink(Output(*script1), Input(*script2)));
+        EXPECT_TRUE(m_logicEngine.rollbackTransaction());
+
+        ASSERT_TRUE(Input(*script1).isLinked());
+        ASSERT_TRUE(Input(*script2).isLinked());
+        const auto& links = m_logicEngine.getPropertyLinks();
+        ASSERT_EQ(2u, links.size());
+        const auto weakLinkIt = std::find_if(links.cbegin(), links.cend(), [&](const PropertyLink& link) { return link.target == &Input(*script1); });
+        ASSERT_NE(links.cend(), weakLinkIt);
+        EXPECT_TRUE(weakLinkIt->isWeakLink);
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ALogicEngine_Transactions, DestroysObjectsOnlyOnCommit)
+    {
+        LuaScript* script1 = createPassThroughScript("script1");
+        LuaScript* script2 = createPassThroughScript("script2");
+        ASSERT_TRUE(m_logicEngine.link(Output(*script1), Input(*script2)));
+
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        EXPECT_TRUE(m_logicEngine.destroy(*script1));
+        EXPECT_EQ(script1, m_logicEngine.findByName<LuaScript>("script1"));
+        EXPECT_TRUE(m_logicEngine.isLinked(*script2));
+        ASSERT_TRUE(m_logicEngine.commitTransaction());
+
+        EXPECT_EQ(nullptr, m_logicEngine.findByName<LuaScript>("script1"));
+        EXPECT_FALSE(m_logicEngine.isLinked(*script2));
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ALogicEngine_Transactions, DestroyingNodesResolvesLoopBeforeCommit)
+    {
+        LuaScript* script1 = createPassThroughScript("script1");
+        LuaScript* script2 = createPassThroughScript("script2");
+        LuaScript* script3 = createPassThroughScript("script3");
+        ASSERT_TRUE(m_logicEngine.link(Output(*script1), Input(*script2)));
+
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        EXPECT_TRUE(m_logicEngine.link(Output(*script2), Input(*script1)));
+        EXPECT_TRUE(m_logicEngine.link(Output(*script2), Input(*script3)));
+        EXPECT_TRUE(m_logicEngine.destroy(*script1));
+        ASSERT_TRUE(m_logicEngine.commitTransaction());
+
+        EXPECT_EQ(2u, m_logicEngine.getCollection<LuaScript>().size());
+        script2->getInputs()->getChild("value")->set<int32_t>(5);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(5, *Output(*script3).get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_Transactions, RollsBackTransactionIfObjectCannotBeDestroyed)
+    {
+        LuaModule* module = m_logicEngine.createLuaModule(m_moduleSourceCode, {}, "mymodule");
+        ASSERT_NE(nullptr, module);
+        ASSERT_NE(nullptr, m_logicEngine.createLuaScript(R"(
+            modules("mymodule")
+            function interface(IN,OUT)
+            end
+            function run(IN,OUT)
+            end
+        )", CreateDeps({ { "mymodule", module } }), "scriptUsingModule"));
+        LuaScript* script1 = createPassThroughScript("script1");
+
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        LuaScript* script2 = createPassThroughScript("script2");
+        EXPECT_TRUE(m_logicEngine.link(Output(*script1), Input(*script2)));
+        EXPECT_TRUE(m_logicEngine.destroy(*script1));
+        // module is still used by script, this is checked on commit only
+        EXPECT_TRUE(m_logicEngine.destroy(*module));
+        EXPECT_FALSE(m_logicEngine.commitTransaction());
+        expectError("Transaction was rolled back because some of its objects could not be destroyed!");
+
+        EXPECT_EQ(script1, m_logicEngine.findByName<LuaScript>("script1"));
+        EXPECT_EQ(nullptr, m_logicEngine.findByName<LuaScript>("script2"));
+        EXPECT_EQ(module, m_logicEngine.findByName<LuaModule>("mymodule"));
+        EXPECT_FALSE(m_logicEngine.isLinked(*script1));
+    }
+
+    TEST_F(ALogicEngine_Transactions, FailsToDestroyNullObjectWithinTransaction)
+    {
+        LuaScript* script1 = createPassThroughScript("script1");
+
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        EXPECT_FALSE(m_logicEngine.destroy({ script1, nullptr }));
+        expectError("Tried to destroy null object");
+
+        EXPECT_FALSE(m_logicEngine.commitTransaction());
+        expectError("Transaction was rolled back because some of its operations failed!");
+        EXPECT_EQ(script1, m_logicEngine.findByName<LuaScript>("script1"));
+    }
+
+    TEST_F(ALogicEngine_Transactions, FailsToDestroyObjectOfOtherLogicEngineWithinTransaction)
+    {
+        LogicEngine otherEngine{ m_logicEngine.getFeatureLevel() };
+        TimerNode* foreignTimer = otherEngine.createTimerNode("foreign");
+        LuaScript* script1 = createPassThroughScript("script1");
+
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        EXPECT_TRUE(m_logicEngine.destroy(*script1));
+        EXPECT_FALSE(m_logicEngine.destroy(*foreignTimer));
+        expectError("Can't find TimerNode in logic engine!");
+
+        EXPECT_FALSE(m_logicEngine.commitTransaction());
+        expectError("Transaction was rolled back because some of its operations failed!");
+        EXPECT_EQ(script1, m_logicEngine.findByName<LuaScript>("script1"));
+        EXPECT_EQ(foreignTimer, otherEngine.findByName<TimerNode>("foreign"));
+    }
+
+    TEST_F(ALogicEngine_Transactions, FailsToDestroyObjectAlreadyDestroyedWithinTransaction)
+    {
+        LuaScript* script1 = createPassThroughScript("script1");
+
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        EXPECT_TRUE(m_logicEngine.destroy(*script1));
+        EXPECT_FALSE(m_logicEngine.destroy(*script1));
+        expectError("Tried to destroy object 'script1' which is already destroyed within the transaction");
+
+        EXPECT_FALSE(m_logicEngine.commitTransaction());
+        EXPECT_EQ(script1, m_logicEngine.findByName<LuaScript>("script1"));
+    }
+
+    TEST_F(ALogicEngine_Transactions, RollbackKeepsObjectsDestroyedWithinTransaction)
+    {
+        LuaScript* script1 = createPassThroughScript("script1");
+
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        EXPECT_TRUE(m_logicEngine.destroy(*script1));
+        EXPECT_TRUE(m_logicEngine.rollbackTransaction());
+
+        EXPECT_EQ(script1, m_logicEngine.findByName<LuaScript>("script1"));
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_F(ALogicEngine_Transactions, FailsToBeginTransactionIfAnotherIsOpen)
+    {
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        EXPECT_FALSE(m_logicEngine.beginTransaction());
+        expectError("Cannot begin transaction, there is already an open transaction!");
+        EXPECT_TRUE(m_logicEngine.commitTransaction());
+    }
+
+    TEST_F(ALogicEngine_Transactions, FailsToCommitOrRollbackWithoutOpenTransaction)
+    {
+        EXPECT_FALSE(m_logicEngine.commitTransaction());
+        expectError("Cannot commit transaction, there is no open transaction!");
+        EXPECT_FALSE(m_logicEngine.rollbackTransaction());
+        expectError("Cannot roll back transaction, there is no open transaction!");
+
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+        EXPECT_TRUE(m_logicEngine.commitTransaction());
+        EXPECT_FALSE(m_logicEngine.commitTransaction());
+    }
+
+    TEST_F(ALogicEngine_Transactions, RejectsOperationsWhichRequireValidGraphWhileTransactionIsOpen)
+    {
+        const LogicEngineState state = m_logicEngine.captureState();
+        ASSERT_TRUE(m_logicEngine.beginTransaction());
+
+        EXPECT_FALSE(m_logicEngine.update());
+        expectError("Cannot update while a transaction is open, commit or roll back the transaction first!");
+
+        std::vector<uint8_t> buffer;
+        EXPECT_FALSE(m_logicEngine.saveToBuffer(buffer));
+        expectError("Cannot save content while a transaction is open, commit or roll back the transaction first!");
+
+        EXPECT_FALSE(m_logicEngine.loadFromBuffer(buffer.data(), buffer.size()));
+        expectError("Cannot load content while a transaction is open, commit or roll back the transaction first!");
+
+        EXPECT_FALSE(m_logicEngine.unloadPackage(1u));
+        expectError("Cannot unload package while a transaction is open, commit or roll back the transaction first!");
+
+        EXPECT_FALSE(m_logicEngine.restoreState(state));
+        expectError("Cannot restore state while a transaction is open, commit or roll back the transaction first!");
+
+        ASSERT_TRUE(m_logicEngine.commitTransaction());
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+}
@@ -15,6 +15,7 @@
 #include "ramses-logic/RamsesAppearanceBinding.h"
 #include "ramses-logic/RamsesNodeBinding.h"
 #include "ramses-logic/RamsesCameraBinding.h"
+#include "ramses-logic/TimerNode.h"
 
 #include "ramses-logic/Property.h"
 
@@ -473,4 +474,92 @@ namespace rlogic
         EXPECT_EQ(sourceScript, executedNodes[0].first);
         EXPECT_EQ(targetScript, executedNodes[1].first);
     }
+
+    TEST_F(ALogicEngine_Update, AlwaysUpdatesTimerNodesCreatedOrLinkedAfterPreviousUpdate)
+    {
+        m_logicEngine.enableUpdateReport(true);
+
+        auto timer1 = m_logicEngine.createTimerNode("timer1");
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesExecuted(), ::testing::ElementsAre(::testing::Pair(timer1, ::testing::_)));
+
+        // timer created after update is forced dirty on following updates as well
+        auto timer2 = m_logicEngine.createTimerNode("timer2");
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesExecuted(), ::testing::UnorderedElementsAre(::testing::Pair(timer1, ::testing::_), ::testing::Pair(timer2, ::testing::_)));
+
+        // execution order follows new link
+        ASSERT_TRUE(m_logicEngine.link(*timer2->getOutputs()->getChild("ticker_us"), *timer1->getInputs()->getChild("ticker_us")));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesExecuted(), ::testing::ElementsAre(::testing::Pair(timer2, ::testing::_), ::testing::Pair(timer1, ::testing::_)));
+
+        // destroyed timer is not executed anymore
+        ASSERT_TRUE(m_logicEngine.destroy(*timer2));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesExecuted(), ::testing::ElementsAre(::testing::Pair(timer1, ::testing::_)));
+    }
+
+    TEST_F(ALogicEngine_Update, UpdatesOnlyGivenNodesAndNodesDependingOnThem)
+    {
+        m_logicEngine.enableUpdateReport(true);
+
+        auto scriptSource = R"(
+            function interface(IN,OUT)
+                IN.inFloat = Type:Float()
+                OUT.outFloat = Type:Float()
+            end
+            function run(IN,OUT)
+                OUT.outFloat = IN.inFloat
+            end
+        )";
+
+        // script1 -> script2 -> script3, script4 not linked
+        auto script1 = m_logicEngine.createLuaScript(scriptSource, {}, "script1");
+        auto script2 = m_logicEngine.createLuaScript(scriptSource, {}, "script2");
+        auto script3 = m_logicEngine.createLuaScript(scriptSource, {}, "script3");
+        auto script4 = m_logicEngine.createLuaScript(scriptSource, {}, "script4");
+        ASSERT_TRUE(m_logicEngine.link(*script1->getOutputs()->getChild("outFloat"), *script2->getInputs()->getChild("inFloat")));
+        ASSERT_TRUE(m_logicEngine.link(*script2->getOutputs()->getChild("outFloat"), *script3->getInputs()->getChild("inFloat")));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        script1->getInputs()->getChild("inFloat")->set(1.f);
+        script4->getInputs()->getChild("inFloat")->set(4.f);
+
+        // dirty script1 is upstream of given node, so it is not executed and nothing is propagated
+        ASSERT_TRUE(m_logicEngine.updateNodes({ script2 }));
+        EXPECT_TRUE(m_logicEngine.getLastUpdateReport().getNodesExecuted().empty());
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesSkippedExecution(), ::testing::ElementsAre(script2, script3));
+        EXPECT_FLOAT_EQ(0.f, *script3->getOutputs()->getChild("outFloat")->get<float>());
+
+        // only dirty nodes of the subgraph are executed, in same order as in full update
+        ASSERT_TRUE(m_logicEngine.updateNodes({ script1 }));
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesExecuted(),
+            ::testing::ElementsAre(::testing::Pair(script1, ::testing::_), ::testing::Pair(script2, ::testing::_), ::testing::Pair(script3, ::testing::_)));
+        EXPECT_FLOAT_EQ(1.f, *script3->getOutputs()->getChild("outFloat")->get<float>());
+        EXPECT_FLOAT_EQ(0.f, *script4->getOutputs()->getChild("outFloat")->get<float>());
+
+        // node outside of previously updated subgraphs is still dirty and executed by full update
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesExecuted(), ::testing::ElementsAre(::testing::Pair(script4, ::testing::_)));
+        EXPECT_FLOAT_EQ(4.f, *script4->getOutputs()->getChild("outFloat")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_Update, FailsToUpdateNodesNotBelongingToLogicEngine)
+    {
+        auto timer = m_logicEngine.createTimerNode("timer");
+
+        LogicEngine otherLogicEngine{ m_logicEngine.getFeatureLevel() };
+        auto otherTimer = otherLogicEngine.createTimerNode("timer");
+
+        EXPECT_FALSE(m_logicEngine.updateNodes({ timer, otherTimer }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to update nodes: one or more of the provided nodes was not found in this logic instance.", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.updateNodes({ nullptr }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+
+        EXPECT_TRUE(m_logicEngine.updateNodes({ timer }));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+    }
 }
@@ -814,6 +814,87 @@ namespace rlogic::internal
             ::testing::HasSubstr("Unexpected global variable definition 'globalVariable' in run()! Use the init() function to declare global data and functions, or use modules!"));
     }
 
+    TEST_P(ALuaScript_Serialization, DefersCompilationUntilFirstUpdate_WhenLoadedLazily)
+    {
+        {
+            std::unique_ptr<LuaScriptImpl> script = createTestScript(R"(
+                function init()
+                    GLOBAL.offset = 10
+                end
+                function interface(IN,OUT)
+                    IN.value = Type:Int32()
+                    OUT.value = Type:Int32()
+                end
+                function run(IN,OUT)
+                    OUT.value = IN.value + GLOBAL.offset
+                end
+            )", "script");
+            (void)LuaScriptImpl::Serialize(*script, m_flatBufferBuilder, m_serializationMap, ELuaSavingMode::SourceAndByteCode);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap, m_featureLevel, true);
+
+        ASSERT_TRUE(deserialized);
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+        EXPECT_FALSE(deserialized->isCompiled());
+
+        // properties are available before compilation
+        ASSERT_NE(nullptr, deserialized->getInputs()->getChild("value"));
+        ASSERT_NE(nullptr, deserialized->getOutputs()->getChild("value"));
+        EXPECT_TRUE(deserialized->getInputs()->getChild("value")->set<int32_t>(5));
+        EXPECT_FALSE(deserialized->isCompiled());
+
+        EXPECT_FALSE(deserialized->update());
+        EXPECT_TRUE(deserialized->isCompiled());
+        EXPECT_EQ(15, *deserialized->getOutputs()->getChild("value")->get<int32_t>());
+
+        EXPECT_TRUE(deserialized->getInputs()->getChild("value")->set<int32_t>(7));
+        EXPECT_FALSE(deserialized->update());
+        EXPECT_EQ(17, *deserialized->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_P(ALuaScript_Serialization, ReportsLoadingErrorsOnFirstUpdate_WhenLoadedLazily)
+    {
+        {
+            std::string_view brokenScript = R"(
+            globalVariable = 5 -- breaks sandbox
+
+            function interface(IN,OUT)
+            end
+
+            function run(IN,OUT)
+            end
+        )";
+            auto script = rlogic_serialization::CreateLuaScript(
+                m_flatBufferBuilder,
+                rlogic_serialization::CreateLogicObject(m_flatBufferBuilder,
+                    m_flatBufferBuilder.CreateString("script"),
+                    1u),
+                m_featureLevel == EFeatureLevel_01 ? m_flatBufferBuilder.CreateString(brokenScript) : 0,
+                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>>{}),
+                m_flatBufferBuilder.CreateVector(std::vector<uint8_t>{}),
+                m_testUtils.serializeTestProperty(""),
+                m_testUtils.serializeTestProperty(""),
+                m_featureLevel >= EFeatureLevel_02 ? m_flatBufferBuilder.CreateVector(GetByteCodeForSource(brokenScript)) : 0
+            );
+            m_flatBufferBuilder.Finish(script);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap, m_featureLevel, true);
+
+        ASSERT_TRUE(deserialized);
+        EXPECT_TRUE(m_errorReporting.getErrors().empty());
+
+        auto expectedError = deserialized->update();
+        ASSERT_TRUE(expectedError);
+        EXPECT_THAT(expectedError->message, ::testing::HasSubstr("Failed to load LuaScript 'script' from serialized data"));
+        EXPECT_THAT(expectedError->message,
+            ::testing::HasSubstr("Declaring global variables is forbidden (exceptions: the functions 'init', 'interface' and 'run')! (found value of type 'number')"));
+        EXPECT_FALSE(deserialized->isCompiled());
+    }
+
     TEST_P(ALuaScript_Serialization, ProducesErrorWhenLuaScriptSourceHasRuntimeErrors)
     {
         if (m_featureLevel != EFeatureLevel_01)
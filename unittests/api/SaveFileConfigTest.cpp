@@ -25,6 +25,7 @@ namespace rlogic::internal
             config.setExporterVersion(1u, 2u, 3u, 4u);
             config.setValidationEnabled(false);
             config.setLuaSavingMode(ELuaSavingMode::SourceAndByteCode);
+            config.setCompression(EFileCompression::LZ4);
         }
 
         static void checkValues(const SaveFileConfig& config)
@@ -36,6 +37,7 @@ namespace rlogic::internal
             EXPECT_EQ(4u, config.m_impl->getExporterFileFormatVersion());
             EXPECT_FALSE(config.m_impl->getValidationEnabled());
             EXPECT_EQ(ELuaSavingMode::SourceAndByteCode, config.m_impl->getLuaSavingMode());
+            EXPECT_EQ(EFileCompression::LZ4, config.m_impl->getCompression());
         }
     };
 
@@ -49,6 +51,7 @@ namespace rlogic::internal
         EXPECT_EQ(0u, config.m_impl->getExporterFileFormatVersion());
         EXPECT_TRUE(config.m_impl->getValidationEnabled());
         EXPECT_EQ(ELuaSavingMode::SourceAndByteCode, config.m_impl->getLuaSavingMode());
+        EXPECT_EQ(EFileCompression::None, config.m_impl->getCompression());
     }
 
     TEST_F(ASaveFileConfig, IsCopied)
@@ -281,6 +281,138 @@ namespace rlogic::internal
             EXPECT_NEAR(expectedMat2[i], mat2[i], 1e-4f) << i;
     }
 
+    TEST_F(ASkinBinding, DoesNotRecalculateUniformIfJointsDidNotChange)
+    {
+        EXPECT_TRUE(m_logicEngine.update());
+
+        // overwrite uniform directly in Ramses, skin binding does not set it again unless any of its joints changes
+        const std::array<float, 32u> dummyData{ 0.f };
+        m_appearance->setInputValueMatrix44f(m_uniform, 2u, dummyData.data());
+        EXPECT_TRUE(m_logicEngine.update());
+
+        std::array<float, 32u> uniformData{};
+        m_appearance->getInputValueMatrix44f(m_uniform, 2u, uniformData.data());
+        EXPECT_EQ(dummyData, uniformData);
+
+        m_jointNodes[1]->setTranslation(-1.f, -2.f, -3.f);
+        EXPECT_TRUE(m_logicEngine.update());
+
+        const matrix44f expectedMat2 = {
+            1.f, 0.f, 0.f, 0.f,
+            0.f, 1.f, 0.f, 0.f,
+            0.f, 0.f, 1.f, 0.f,
+            -1.f, -2.f, -3.f, 1.f
+        };
+        m_appearance->getInputValueMatrix44f(m_uniform, 2u, uniformData.data());
+        for (size_t i = 0u; i < 16u; ++i)
+            EXPECT_NEAR(expectedMat2[i], uniformData[16u + i], 1e-4f) << i;
+    }
+
+    TEST_F(ASkinBinding, UpdatesMultipleSkinsSharingJoints)
+    {
+        auto appearance = m_scene->createAppearance(createTestEffect(), "skinAppearance2");
+        ramses::UniformInput uniform;
+        appearance->getEffect().findUniformInput("jointMat", uniform);
+        RamsesAppearanceBinding* appearanceBinding{ m_logicEngine.createRamsesAppearanceBinding(*appearance) };
+
+        // identity inverse bind mats, resulting joint mats are equal to world mats of joints
+        const matrix44f identityMat = {
+            1.f, 0.f, 0.f, 0.f,
+            0.f, 1.f, 0.f, 0.f,
+            0.f, 0.f, 1.f, 0.f,
+            0.f, 0.f, 0.f, 1.f
+        };
+        auto skin2 = m_logicEngine.createSkinBinding(m_joints, { identityMat, identityMat }, *appearanceBinding, uniform, "skin2");
+        ASSERT_NE(nullptr, skin2);
+
+        m_jointNodes[0]->setRotation(1.f, 2.f, 3.f);
+        m_jointNodes[1]->setTranslation(-1.f, -2.f, -3.f);
+        EXPECT_TRUE(m_logicEngine.update());
+
+        // joints are shared, world matrix of each is retrieved only once
+        EXPECT_EQ(2u, m_logicEngine.m_impl->getApiObjects().getSkinningBatch().getUniqueJointCount());
+
+        const auto expectUniformMatchesJointMats = [&](const ramses::Appearance& app, const ramses::UniformInput& uni, const matrix44f& expectedMat1, const matrix44f& expectedMat2) {
+            std::array<float, 32u> uniformData{};
+            app.getInputValueMatrix44f(uni, 2u, uniformData.data());
+            for (size_t i = 0u; i < 16u; ++i)
+                EXPECT_NEAR(expectedMat1[i], uniformData[i], 1e-4f) << i;
+            for (size_t i = 0u; i < 16u; ++i)
+                EXPECT_NEAR(expectedMat2[i], uniformData[16u + i], 1e-4f) << i;
+        };
+
+        const matrix44f expectedMat1 = {
+            0.998f, -0.0523f, 0.0349f, 0.f,
+            0.0529f, 0.9984f, -0.0174f, 0.f,
+            -0.0339f, 0.01925f, 0.9992f, 0.f,
+            -0.00209f, -0.00235f, 0.00227f, 1.f
+        };
+        const matrix44f expectedMat2 = {
+            1.f, 0.f, 0.f, 0.f,
+            0.f, 1.f, 0.f, 0.f,
+            0.f, 0.f, 1.f, 0.f,
+            -1.f, -2.f, -3.f, 1.f
+        };
+        expectUniformMatchesJointMats(*m_appearance, m_uniform, expectedMat1, expectedMat2);
+
+        matrix44f jointWorldMat1{};
+        matrix44f jointWorldMat2{};
+        float tempData[16]; // NOLINT(modernize-avoid-c-arrays) Ramses uses C array in matrix getters
+        m_jointNodes[0]->getModelMatrix(tempData);
+        std::copy(std::begin(tempData), std::end(tempData), jointWorldMat1.begin());
+        m_jointNodes[1]->getModelMatrix(tempData);
+        std::copy(std::begin(tempData), std::end(tempData), jointWorldMat2.begin());
+        expectUniformMatchesJointMats(*appearance, uniform, jointWorldMat1, jointWorldMat2);
+
+        // destroying one skin leaves the other one updating correctly
+        EXPECT_TRUE(m_logicEngine.destroy(*skin2));
+        m_jointNodes[0]->setRotation(0.f, 0.f, 0.f);
+        m_jointNodes[1]->setTranslation(0.f, 0.f, 0.f);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2u, m_logicEngine.m_impl->getApiObjects().getSkinningBatch().getUniqueJointCount());
+
+        // joints are back in their initial transformations, result of remaining skin are identity matrices
+        expectUniformMatchesJointMats(*m_appearance, m_uniform, identityMat, identityMat);
+    }
+
+    TEST_F(ASkinBinding, FetchesJointsOnlyOfSkinsWhichAreNotSuspended)
+    {
+        auto appearance = m_scene->createAppearance(createTestEffect(), "skinAppearance2");
+        ramses::UniformInput uniform;
+        appearance->getEffect().findUniformInput("jointMat", uniform);
+        RamsesAppearanceBinding* appearanceBinding{ m_logicEngine.createRamsesAppearanceBinding(*appearance) };
+        ramses::Node* jointNode3 = m_scene->createNode();
+        const RamsesNodeBinding* joint3 = m_logicEngine.createRamsesNodeBinding(*jointNode3);
+
+        const matrix44f identityMat = {
+            1.f, 0.f, 0.f, 0.f,
+            0.f, 1.f, 0.f, 0.f,
+            0.f, 0.f, 1.f, 0.f,
+            0.f, 0.f, 0.f, 1.f
+        };
+        // shares one joint with other skin
+        ASSERT_NE(nullptr, m_logicEngine.createSkinBinding({ m_joints[1], joint3 }, { identityMat, identityMat }, *appearanceBinding, uniform, "skin2"));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(3u, m_logicEngine.m_impl->getApiObjects().getSkinningBatch().getUniqueJointCount());
+
+        std::array<float, 32u> uniformData{};
+        m_appearance->getInputValueMatrix44f(m_uniform, 2u, uniformData.data());
+        const std::array<float, 32u> uniformDataBeforeSuspend = uniformData;
+
+        ASSERT_TRUE(m_logicEngine.suspendNodes({ m_skin }));
+        m_jointNodes[0]->setTranslation(-1.f, -2.f, -3.f);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2u, m_logicEngine.m_impl->getApiObjects().getSkinningBatch().getUniqueJointCount());
+        m_appearance->getInputValueMatrix44f(m_uniform, 2u, uniformData.data());
+        EXPECT_EQ(uniformDataBeforeSuspend, uniformData);
+
+        ASSERT_TRUE(m_logicEngine.resumeNodes({ m_skin }));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(3u, m_logicEngine.m_impl->getApiObjects().getSkinningBatch().getUniqueJointCount());
+        m_appearance->getInputValueMatrix44f(m_uniform, 2u, uniformData.data());
+        EXPECT_NE(uniformDataBeforeSuspend, uniformData);
+    }
+
     class ASkinBinding_SerializationLifecycle : public ASkinBinding
     {
     protected:
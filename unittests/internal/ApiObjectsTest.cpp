@@ -172,6 +172,25 @@ namespace rlogic::internal
         EXPECT_EQ(script, m_apiObjects.getApiObjectContainer<LogicObject>().back());
     }
 
+    TEST_P(AnApiObjects, ReservesContainersForGivenObjectCount)
+    {
+        const LuaScript* script = createScript();
+        m_apiObjects.reserve(100u, 90u);
+        EXPECT_GE(m_apiObjects.getApiObjectContainer<LogicObject>().capacity(), 100u);
+        EXPECT_GE(m_apiObjects.getApiObjectOwningContainer().capacity(), 100u);
+
+        // existing objects are not affected and lower count does not shrink anything
+        m_apiObjects.reserve(0u, 0u);
+        EXPECT_GE(m_apiObjects.getApiObjectContainer<LogicObject>().capacity(), 100u);
+        EXPECT_EQ(script, m_apiObjects.getApiObject(script->m_impl));
+        EXPECT_EQ(script, m_apiObjects.getApiObjectById(script->getId()));
+
+        for (size_t i = 0u; i < 99u; ++i)
+            EXPECT_NE(nullptr, m_apiObjects.createTimerNode("timer"));
+        EXPECT_EQ(100u, m_apiObjects.getApiObjectContainer<LogicObject>().size());
+        EXPECT_EQ(100u, m_apiObjects.getReverseImplMapping().size());
+    }
+
     TEST_P(AnApiObjects, DestroysScriptWithoutErrors)
     {
         LuaScript* script = createScript();
@@ -1954,6 +1973,7 @@ namespace rlogic::internal
             expectedObjCount = 8u;
             break;
         case EFeatureLevel_05:
+        case EFeatureLevel_06:
             expectedObjCount = 9u;
             break;
         }
@@ -0,0 +1,131 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/CompressedContainer.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace rlogic::internal
+{
+    class ACompressedContainer : public ::testing::Test
+    {
+    protected:
+        static std::vector<uint8_t> CreateCompressibleData(size_t size)
+        {
+            std::vector<uint8_t> data(size);
+            for (size_t i = 0u; i < size; ++i)
+                data[i] = static_cast<uint8_t>((i % 97u) * (i % 13u));
+            return data;
+        }
+
+        static std::vector<uint8_t> CreateRandomData(size_t size)
+        {
+            std::mt19937 generator(42u);
+            std::vector<uint8_t> data(size);
+            std::generate(data.begin(), data.end(), [&generator]() { return static_cast<uint8_t>(generator()); });
+            return data;
+        }
+
+        static void ExpectRoundTrip(const std::vector<uint8_t>& data)
+        {
+            const std::vector<uint8_t> compressed = CompressedContainer::Compress(data.data(), data.size());
+            EXPECT_TRUE(CompressedContainer::IsCompressed(compressed.data(), compressed.size()));
+            const auto decompressed = CompressedContainer::Decompress(compressed.data(), compressed.size());
+            ASSERT_TRUE(decompressed);
+            EXPECT_EQ(data, *decompressed);
+        }
+    };
+
+    TEST_F(ACompressedContainer, CompressesAndDecompressesData)
+    {
+        const std::vector<uint8_t> data = CreateCompressibleData(10000u);
+        const std::vector<uint8_t> compressed = CompressedContainer::Compress(data.data(), data.size());
+        EXPECT_LT(compressed.size(), data.size() / 4u);
+        ExpectRoundTrip(data);
+    }
+
+    TEST_F(ACompressedContainer, StoresIncompressibleDataWithMinimalOverhead)
+    {
+        const std::vector<uint8_t> data = CreateRandomData(10000u);
+        const std::vector<uint8_t> compressed = CompressedContainer::Compress(data.data(), data.size());
+        EXPECT_EQ(data.size() + CompressedContainer::HeaderSize + 4u, compressed.size());
+        ExpectRoundTrip(data);
+    }
+
+    TEST_F(ACompressedContainer, CompressesDataSpanningMultipleBlocks)
+    {
+        std::vector<uint8_t> data = CreateCompressibleData(2u * CompressedContainer::BlockSize + 123u);
+        const std::vector<uint8_t> randomPart = CreateRandomData(CompressedContainer::BlockSize / 2u);
+        std::copy(randomPart.cbegin(), randomPart.cend(), data.begin() + CompressedContainer::BlockSize);
+        ExpectRoundTrip(data);
+    }
+
+    TEST_F(ACompressedContainer, CompressesSmallData)
+    {
+        ExpectRoundTrip({ 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u });
+        ExpectRoundTrip(std::vector<uint8_t>(13u, 0u));
+        ExpectRoundTrip(std::vector<uint8_t>(1000u, 0u));
+    }
+
+    TEST_F(ACompressedContainer, KeepsFileIdentifierBytesAtSamePosition)
+    {
+        std::vector<uint8_t> data = CreateCompressibleData(1000u);
+        const std::vector<uint8_t> fileId{ 'r', 'l', '0', '5' };
+        std::copy(fileId.cbegin(), fileId.cend(), data.begin() + 4);
+
+        const std::vector<uint8_t> compressed = CompressedContainer::Compress(data.data(), data.size());
+        EXPECT_TRUE(std::equal(fileId.cbegin(), fileId.cend(), compressed.cbegin() + 4));
+    }
+
+    TEST_F(ACompressedContainer, DoesNotRecognizeUncompressedData)
+    {
+        const std::vector<uint8_t> data = CreateCompressibleData(1000u);
+        EXPECT_FALSE(CompressedContainer::IsCompressed(data.data(), data.size()));
+        EXPECT_FALSE(CompressedContainer::Decompress(data.data(), data.size()));
+
+        const std::vector<uint8_t> compressed = CompressedContainer::Compress(data.data(), data.size());
+        EXPECT_FALSE(CompressedContainer::IsCompressed(compressed.data(), CompressedContainer::HeaderSize - 1u));
+    }
+
+    TEST_F(ACompressedContainer, FailsToDecompressTruncatedData)
+    {
+        const std::vector<uint8_t> data = CreateCompressibleData(10000u);
+        const std::vector<uint8_t> compressed = CompressedContainer::Compress(data.data(), data.size());
+        for (size_t size = CompressedContainer::HeaderSize; size < compressed.size(); ++size)
+        {
+            EXPECT_FALSE(CompressedContainer::Decompress(compressed.data(), size));
+        }
+    }
+
+    TEST_F(ACompressedContainer, FailsToDecompressCorruptedData)
+    {
+        const std::vector<uint8_t> data = CreateCompressibleData(10000u);
+        std::vector<uint8_t> compressed = CompressedContainer::Compress(data.data(), data.size());
+
+        // corrupt uncompressed size in header
+        std::vector<uint8_t> corruptedHeader = compressed;
+        corruptedHeader[16] ^= 0x01u;
+        EXPECT_FALSE(CompressedContainer::Decompress(corruptedHeader.data(), corruptedHeader.size()));
+
+        // corrupted block content must never decode out of bounds
+        for (size_t i = CompressedContainer::HeaderSize; i < compressed.size(); ++i)
+        {
+            std::vector<uint8_t> corrupted = compressed;
+            corrupted[i] ^= 0xFFu;
+            const auto decompressed = CompressedContainer::Decompress(corrupted.data(), corrupted.size());
+            if (decompressed)
+            {
+                EXPECT_EQ(data.size(), decompressed->size());
+            }
+        }
+    }
+}
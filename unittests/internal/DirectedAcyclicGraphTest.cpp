@@ -517,6 +517,130 @@ namespace rlogic::internal
         EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
     }
 
+    TEST_F(ADirectedAcyclicGraph, SortsOnlyGivenSubsetOfNodes)
+    {
+        addTestNodesToGraph(6);
+
+        // N1 -> N2, separate subset N6 -> N4 -> N5, N3 -> N5
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N6, N4);
+        m_graph.addEdge(N4, N5);
+        m_graph.addEdge(N4, N5);
+        m_graph.addEdge(N3, N5);
+
+        const auto sortedSubset = m_graph.getTopologicallySortedNodes({ &N5, &N4, &N3, &N6 });
+        ASSERT_TRUE(sortedSubset);
+        ASSERT_EQ(4u, sortedSubset->size());
+        const auto rank = [&sortedSubset](const LogicNodeImpl& node) {
+            return std::find(sortedSubset->cbegin(), sortedSubset->cend(), &node) - sortedSubset->cbegin();
+        };
+        EXPECT_LT(rank(N6), rank(N4));
+        EXPECT_LT(rank(N4), rank(N5));
+        EXPECT_LT(rank(N3), rank(N5));
+
+        EXPECT_EQ((NodeVector{ &N1, &N2 }), *m_graph.getTopologicallySortedNodes({ &N2, &N1 }));
+        EXPECT_TRUE(m_graph.getTopologicallySortedNodes(NodeVector{})->empty());
+    }
+
+    TEST_F(ADirectedAcyclicGraph, ReportsCycleWhenSortingSubsetOfNodes)
+    {
+        addTestNodesToGraph(4);
+
+        // N1 -> N2 -> N3 -> N2
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N2);
+
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes({ &N1, &N2, &N3 }).has_value());
+        EXPECT_EQ((NodeVector{ &N4 }), *m_graph.getTopologicallySortedNodes({ &N4 }));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, IgnoresEdgesToNodesOutsideOfSortedSubset)
+    {
+        addTestNodesToGraph(4);
+
+        // N1 -> N2 -> N3 -> N1 is a cycle only if N3 is part of the subset, N4 -> N2
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N1);
+        m_graph.addEdge(N4, N2);
+
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes({ &N1, &N2, &N3 }).has_value());
+        EXPECT_EQ((NodeVector{ &N1, &N2 }), *m_graph.getTopologicallySortedNodes({ &N2, &N1 }));
+        EXPECT_EQ((NodeVector{ &N3, &N1 }), *m_graph.getTopologicallySortedNodes({ &N1, &N3 }));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, ProvidesAllNodes)
+    {
+        EXPECT_TRUE(m_graph.getNodes().empty());
+
+        addTestNodesToGraph(3);
+        m_graph.addEdge(N1, N2);
+        m_graph.removeNode(N3);
+
+        const NodeVector nodes = m_graph.getNodes();
+        EXPECT_EQ(2u, nodes.size());
+        EXPECT_THAT(nodes, ::testing::UnorderedElementsAre(&N1, &N2));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, ProvidesNodesReachableFromGivenRootsInGivenOrder)
+    {
+        addTestNodesToGraph(6);
+
+        /*
+         * N1 -> N2 -> N3 <- N5
+         * N1 -> N4
+         * N6 (not linked)
+         */
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N1, N4);
+        m_graph.addEdge(N5, N3);
+
+        const NodeVector sortedNodes = *m_graph.getTopologicallySortedNodes();
+        const auto inSortedOrder = [&sortedNodes](NodeVector nodes) {
+            std::sort(nodes.begin(), nodes.end(), [&sortedNodes](LogicNodeImpl* n1, LogicNodeImpl* n2) {
+                return std::find(sortedNodes.cbegin(), sortedNodes.cend(), n1) < std::find(sortedNodes.cbegin(), sortedNodes.cend(), n2);
+            });
+            return nodes;
+        };
+
+        EXPECT_EQ(inSortedOrder({ &N1, &N2, &N3, &N4 }), m_graph.getReachableNodes({ &N1 }, sortedNodes));
+        EXPECT_EQ(inSortedOrder({ &N2, &N3 }), m_graph.getReachableNodes({ &N2 }, sortedNodes));
+        EXPECT_EQ(inSortedOrder({ &N2, &N3, &N5 }), m_graph.getReachableNodes({ &N5, &N2, &N5 }, sortedNodes));
+        EXPECT_EQ((NodeVector{ &N6 }), m_graph.getReachableNodes({ &N6 }, sortedNodes));
+        EXPECT_TRUE(m_graph.getReachableNodes({}, sortedNodes).empty());
+    }
+
+    TEST_F(ADirectedAcyclicGraph, ReusesIndexOfRemovedNodeForNextAddedNode)
+    {
+        addTestNodesToGraph(3);
+        EXPECT_EQ(1u, N2.getGraphIndex());
+
+        m_graph.removeNode(N2);
+        EXPECT_EQ(LogicNodeImpl::InvalidGraphIndex, N2.getGraphIndex());
+        EXPECT_FALSE(m_graph.containsNode(N2));
+
+        m_graph.addNode(N4);
+        EXPECT_EQ(1u, N4.getGraphIndex());
+        EXPECT_TRUE(m_graph.containsNode(N4));
+
+        m_graph.addEdge(N4, N1);
+        m_graph.addEdge(N3, N4);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N3, &N4, &N1));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, DoesNotContainNodeOfOtherGraphWithSameIndex)
+    {
+        addTestNodesToGraph(1);
+
+        DirectedAcyclicGraph otherGraph;
+        otherGraph.addNode(N2);
+        EXPECT_EQ(N1.getGraphIndex(), N2.getGraphIndex());
+        EXPECT_FALSE(m_graph.containsNode(N2));
+        EXPECT_FALSE(otherGraph.containsNode(N1));
+    }
+
     TEST_F(ADirectedAcyclicGraph, RemovesMultiLinksBetweenTwoNodes_OneByOne)
     {
         addTestNodesToGraph(2);
@@ -156,6 +156,40 @@ namespace rlogic::internal
         expectNoLinks(input);
     }
 
+    TEST_F(ALogicNodeDependencies, ChangesLinksVersionOnlyWhenLinksAreCreatedOrRemoved)
+    {
+        auto nodeToDelete = std::make_unique<LogicNodeDummyImpl>("node");
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+        m_dependencies.addNode(*nodeToDelete);
+
+        PropertyImpl& output = *m_nodeA.getOutputs()->getChild("output1")->m_impl;
+        PropertyImpl& input = *m_nodeB.getInputs()->getChild("input1")->m_impl;
+
+        auto version = m_dependencies.getLinksVersion();
+        EXPECT_TRUE(m_dependencies.link(output, input, false, m_errorReporting));
+        EXPECT_NE(version, m_dependencies.getLinksVersion());
+
+        // failed link or unlink does not change anything
+        version = m_dependencies.getLinksVersion();
+        EXPECT_FALSE(m_dependencies.link(output, input, false, m_errorReporting));
+        EXPECT_FALSE(m_dependencies.unlink(output, *m_nodeA.getInputs()->getChild("input1")->m_impl, m_errorReporting));
+        EXPECT_EQ(version, m_dependencies.getLinksVersion());
+
+        EXPECT_TRUE(m_dependencies.unlink(output, input, m_errorReporting));
+        EXPECT_NE(version, m_dependencies.getLinksVersion());
+
+        version = m_dependencies.getLinksVersion();
+        EXPECT_TRUE(m_dependencies.link(*nodeToDelete->getOutputs()->getChild("output1")->m_impl, input, true, m_errorReporting));
+        EXPECT_NE(version, m_dependencies.getLinksVersion());
+
+        version = m_dependencies.getLinksVersion();
+        m_dependencies.removeNode(*nodeToDelete);
+        nodeToDelete = nullptr;
+        EXPECT_NE(version, m_dependencies.getLinksVersion());
+        expectNoLinks(input);
+    }
+
     TEST_F(ALogicNodeDependencies, RemovingTargetNode_RemovesLinks)
     {
         auto nodeToDelete = std::make_unique<LogicNodeDummyImpl>("node");
@@ -9,6 +9,8 @@
 #include "gtest/gtest.h"
 #include "internals/Math.h"
 #include <numeric>
+#include <cmath>
+#include <cstring>
 
 namespace rlogic::internal::math
 {
@@ -263,4 +265,58 @@ namespace rlogic::internal::math
         EXPECT_EQ(444.0f, mat3.m43);
         EXPECT_EQ(386.0f, mat3.m44);
     }
+
+    TEST_F(Matrix44Test, DataIsColumnMajor)
+    {
+        std::array<float, 16> data{};
+        std::memcpy(data.data(), m_mat.data(), sizeof(data));
+        EXPECT_EQ(m_mat.toStdArray(), data);
+    }
+
+    TEST_F(Matrix44Test, MultiplicationGivesSameResultsAsScalarReference)
+    {
+        // non-trivial values to make sure SIMD kernels (if enabled) give same results as scalar code (up to rounding)
+        std::array<float, 16> data1{};
+        std::array<float, 16> data2{};
+        for (size_t i = 0u; i < 16u; ++i)
+        {
+            data1[i] = std::sin(float(i) * 0.7f) * 3.3f;
+            data2[i] = std::cos(float(i) * 1.3f) / 7.1f;
+        }
+        const Matrix44f mat1{ data1 };
+        const Matrix44f mat2{ data2 };
+
+        Matrix44f expectedMat;
+        Matrix44f::MultiplyScalar(mat1, mat2, expectedMat);
+        const std::array<float, 16> expectedData = expectedMat.toStdArray();
+        const std::array<float, 16> resultData = (mat1 * mat2).toStdArray();
+        for (size_t i = 0u; i < 16u; ++i)
+        {
+            EXPECT_FLOAT_EQ(expectedData[i], resultData[i]);
+        }
+
+        const Vector4 vec{ 0.3f, -1.7f, 2.9f, 1.f };
+        const Vector4 expectedVec = Matrix44f::MultiplyScalar(mat1, vec);
+        const Vector4 resultVec = mat1 * vec;
+        EXPECT_FLOAT_EQ(expectedVec.x, resultVec.x);
+        EXPECT_FLOAT_EQ(expectedVec.y, resultVec.y);
+        EXPECT_FLOAT_EQ(expectedVec.z, resultVec.z);
+        EXPECT_FLOAT_EQ(expectedVec.w, resultVec.w);
+    }
+
+    TEST_F(Matrix44Test, ComparesAllElements)
+    {
+        EXPECT_TRUE(m_mat == m_mat);
+        EXPECT_FALSE(m_mat != m_mat);
+        EXPECT_FALSE(m_mat == Matrix44f{});
+
+        for (size_t i = 0u; i < 16u; ++i)
+        {
+            auto data = m_mat.toStdArray();
+            data[i] += 1.f;
+            const Matrix44f otherMat{ data };
+            EXPECT_FALSE(m_mat == otherMat) << i;
+            EXPECT_TRUE(m_mat != otherMat) << i;
+        }
+    }
 }
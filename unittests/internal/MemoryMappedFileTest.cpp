@@ -0,0 +1,80 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "WithTempDirectory.h"
+#include "FileDescriptorHelper.h"
+#include "internals/MemoryMappedFile.h"
+#include "internals/FileUtils.h"
+
+#include <array>
+#include <vector>
+#include <cstring>
+
+namespace rlogic::internal
+{
+    class AMemoryMappedFile : public ::testing::Test
+    {
+    protected:
+        WithTempDirectory m_tempDirectory;
+    };
+
+    TEST_F(AMemoryMappedFile, MapsWholeFileContent)
+    {
+        const std::array<char, 5> data{ 'a', 'b', 'c', 'd', 'e' };
+        ASSERT_TRUE(FileUtils::SaveBinary("file.bin", data.data(), data.size()));
+
+        const auto mappedFile = MemoryMappedFile::Map("file.bin");
+        ASSERT_TRUE(mappedFile);
+        ASSERT_EQ(data.size(), mappedFile->getSize());
+        EXPECT_EQ(0, std::memcmp(data.data(), mappedFile->getData(), data.size()));
+    }
+
+    TEST_F(AMemoryMappedFile, MapsRegionOfFileWithUnalignedOffset)
+    {
+        std::vector<char> data(10000u);
+        for (size_t i = 0u; i < data.size(); ++i)
+            data[i] = static_cast<char>(i % 127);
+        ASSERT_TRUE(FileUtils::SaveBinary("file.bin", data.data(), data.size()));
+
+        const int fd = FileDescriptorHelper::OpenFileDescriptorBinary("file.bin");
+        ASSERT_LT(0, fd);
+        for (const size_t offset : { 0u, 1u, 4095u, 4096u, 5003u, 9999u })
+        {
+            const auto mappedRegion = MemoryMappedFile::MapRegion(fd, offset, data.size() - offset);
+            ASSERT_TRUE(mappedRegion) << offset;
+            ASSERT_EQ(data.size() - offset, mappedRegion->getSize());
+            EXPECT_EQ(0, std::memcmp(data.data() + offset, mappedRegion->getData(), data.size() - offset)) << offset; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic) comparing region of buffer
+        }
+
+        EXPECT_FALSE(MemoryMappedFile::MapRegion(fd, 1u, data.size()));
+        EXPECT_FALSE(MemoryMappedFile::MapRegion(fd, data.size(), 1u));
+        EXPECT_FALSE(MemoryMappedFile::MapRegion(fd, 0u, 0u));
+
+        // descriptor is not closed by mapping
+        EXPECT_EQ(0, ::close(fd));
+    }
+
+    TEST_F(AMemoryMappedFile, FailsToMapNonExistingFile)
+    {
+        EXPECT_FALSE(MemoryMappedFile::Map("doesNotExist.bin"));
+    }
+
+    TEST_F(AMemoryMappedFile, FailsToMapDirectory)
+    {
+        fs::create_directory("folder");
+        EXPECT_FALSE(MemoryMappedFile::Map("folder"));
+    }
+
+    TEST_F(AMemoryMappedFile, FailsToMapEmptyFile)
+    {
+        ASSERT_TRUE(FileUtils::SaveBinary("empty.bin", nullptr, 0u));
+        EXPECT_FALSE(MemoryMappedFile::Map("empty.bin"));
+    }
+}
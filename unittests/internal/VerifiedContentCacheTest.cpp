@@ -0,0 +1,122 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/VerifiedContentCache.h"
+
+#include <numeric>
+#include <vector>
+
+namespace rlogic::internal
+{
+    class AVerifiedContentCache : public ::testing::Test
+    {
+    protected:
+        // key 00 01 02 ... 0f of the SipHash reference test vectors
+        static constexpr VerifiedContentCache::Key ReferenceKey{ 0x0706050403020100u, 0x0f0e0d0c0b0a0908u };
+
+        static std::vector<uint8_t> CreateSequence(size_t size)
+        {
+            std::vector<uint8_t> data(size);
+            std::iota(data.begin(), data.end(), uint8_t{ 0u });
+            return data;
+        }
+    };
+
+    TEST_F(AVerifiedContentCache, ComputesSipHash128MatchingReferenceTestVectors)
+    {
+        EXPECT_EQ((std::array<uint64_t, 2>{ 0xe6a825ba047f81a3u, 0x930255c71472f66du }), VerifiedContentCache::SipHash128(ReferenceKey, nullptr, 0u));
+
+        const std::vector<uint8_t> data15 = CreateSequence(15u);
+        EXPECT_EQ((std::array<uint64_t, 2>{ 0x11a8b03399e99354u, 0xd9c3cf970fec087eu }), VerifiedContentCache::SipHash128(ReferenceKey, data15.data(), data15.size()));
+
+        const std::vector<uint8_t> data63 = CreateSequence(63u);
+        EXPECT_EQ((std::array<uint64_t, 2>{ 0x4a83502f77d15051u, 0x7cbd3f979a063e50u }), VerifiedContentCache::SipHash128(ReferenceKey, data63.data(), data63.size()));
+    }
+
+    TEST_F(AVerifiedContentCache, ContainsOnlyInsertedContent)
+    {
+        VerifiedContentCache cache;
+        const std::vector<uint8_t> data = CreateSequence(100u);
+        std::vector<uint8_t> modifiedData = data;
+        modifiedData[50] ^= 1u;
+
+        const auto contentId = cache.computeContentId(data.data(), data.size());
+        EXPECT_FALSE(cache.contains(contentId));
+        cache.insert(contentId);
+        EXPECT_TRUE(cache.contains(contentId));
+        EXPECT_TRUE(cache.contains(cache.computeContentId(data.data(), data.size())));
+
+        EXPECT_FALSE(cache.contains(cache.computeContentId(modifiedData.data(), modifiedData.size())));
+        EXPECT_FALSE(cache.contains(cache.computeContentId(data.data(), data.size() - 1u)));
+    }
+
+    TEST_F(AVerifiedContentCache, UsesDifferentKeyForEveryInstance)
+    {
+        const std::vector<uint8_t> data = CreateSequence(100u);
+        VerifiedContentCache cache1;
+        VerifiedContentCache cache2;
+        EXPECT_NE(cache1.computeContentId(data.data(), data.size()).hash, cache2.computeContentId(data.data(), data.size()).hash);
+    }
+
+    TEST_F(AVerifiedContentCache, ImportsEntriesExportedWithSameKey)
+    {
+        VerifiedContentCache cache{ ReferenceKey };
+        const std::vector<uint8_t> data = CreateSequence(100u);
+        const auto contentId = cache.computeContentId(data.data(), data.size());
+        cache.insert(contentId);
+        const std::vector<uint8_t> exported = cache.exportEntries();
+
+        VerifiedContentCache otherCache{ ReferenceKey };
+        EXPECT_FALSE(otherCache.contains(contentId));
+        EXPECT_TRUE(otherCache.importEntries(exported));
+        EXPECT_TRUE(otherCache.contains(contentId));
+        EXPECT_EQ(exported, otherCache.exportEntries());
+    }
+
+    TEST_F(AVerifiedContentCache, FailsToImportEntriesExportedWithDifferentKeyOrCorrupted)
+    {
+        VerifiedContentCache cache{ ReferenceKey };
+        const std::vector<uint8_t> data = CreateSequence(100u);
+        cache.insert(cache.computeContentId(data.data(), data.size()));
+        const std::vector<uint8_t> exported = cache.exportEntries();
+
+        VerifiedContentCache otherKeyCache{ VerifiedContentCache::Key{ ReferenceKey[0], ReferenceKey[1] + 1u } };
+        EXPECT_FALSE(otherKeyCache.importEntries(exported));
+
+        VerifiedContentCache sameKeyCache{ ReferenceKey };
+        std::vector<uint8_t> corrupted = exported;
+        corrupted[0] = 'x';
+        EXPECT_FALSE(sameKeyCache.importEntries(corrupted));
+        corrupted = exported;
+        corrupted.pop_back();
+        EXPECT_FALSE(sameKeyCache.importEntries(corrupted));
+        EXPECT_FALSE(sameKeyCache.importEntries({}));
+        // nothing was imported from invalid data
+        EXPECT_NE(exported, sameKeyCache.exportEntries());
+    }
+
+    TEST_F(AVerifiedContentCache, DropsOldestEntryWhenFull)
+    {
+        VerifiedContentCache cache{ ReferenceKey };
+        std::vector<VerifiedContentCache::ContentId> contentIds;
+        for (size_t i = 0u; i <= VerifiedContentCache::MaxEntries; ++i)
+        {
+            const std::vector<uint8_t> data = CreateSequence(i + 1u);
+            contentIds.push_back(cache.computeContentId(data.data(), data.size()));
+            cache.insert(contentIds.back());
+            // inserting same content again has no effect
+            cache.insert(contentIds.back());
+        }
+
+        EXPECT_FALSE(cache.contains(contentIds.front()));
+        for (size_t i = 1u; i < contentIds.size(); ++i)
+            EXPECT_TRUE(cache.contains(contentIds[i]));
+    }
+}
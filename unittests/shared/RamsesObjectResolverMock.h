@@ -23,5 +23,6 @@ namespace rlogic::internal
         MOCK_METHOD(ramses::RenderPass*, findRamsesRenderPassInScene, (std::string_view logicNodeName, ramses::sceneObjectId_t objectId), (const, override));
         MOCK_METHOD(ramses::RenderGroup*, findRamsesRenderGroupInScene, (std::string_view logicNodeName, ramses::sceneObjectId_t objectId), (const, override));
         MOCK_METHOD(ramses::SceneObject*, findRamsesSceneObjectInScene, (std::string_view logicNodeName, ramses::sceneObjectId_t objectId), (const, override));
+        MOCK_METHOD(std::unique_ptr<IRamsesObjectResolver>, createWithErrorReporting, (ErrorReporting& errorReporting), (const, override));
     };
 }
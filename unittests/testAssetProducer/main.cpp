@@ -93,7 +93,7 @@ int main(int argc, char* argv[])
 
     ramses::Scene* scene = ramsesClient->createScene(ramses::sceneId_t(123u), ramses::SceneConfig(), "");
     scene->flush();
-    rlogic::LogicEngine logicEngine{ rlogic::EFeatureLevel_05 };
+    rlogic::LogicEngine logicEngine{ rlogic::EFeatureLevel_06 };
 
     rlogic::LuaScript* script1 = logicEngine.createLuaScript(R"(
         function interface(IN,OUT)
@@ -231,6 +231,12 @@ int main(int argc, char* argv[])
     logicEngine.createAnimationNode(animConfig, "animNodeWithDataProperties");
     logicEngine.createTimerNode("timerNode");
 
+    rlogic::AnimationNodeConfig playbackAnimConfig;
+    playbackAnimConfig.addChannel({ "channel", dataArray, dataArray, rlogic::EInterpolationType::Linear });
+    playbackAnimConfig.setPlaybackControlEnabled(true);
+    const auto animNodeWithPlaybackControl = logicEngine.createAnimationNode(playbackAnimConfig, "animNodeWithPlaybackControl");
+    logicEngine.createAnimationBlendNode({ animNode, animNodeWithPlaybackControl }, "animBlendNode");
+
     logicEngine.link(*intf->getOutputs()->getChild("struct")->getChild("floatInput"), *script1->getInputs()->getChild("floatInput"));
     logicEngine.link(*script1->getOutputs()->getChild("floatOutput"), *script2->getInputs()->getChild("floatInput"));
     logicEngine.link(*script1->getOutputs()->getChild("nodeTranslation"), *nodeBinding->getInputs()->getChild("translation"));